@@ -61,6 +61,7 @@ zsLib/cpp/zsLib_helpers.cpp \
 zsLib/cpp/zsLib_IPAddress.cpp \
 zsLib/cpp/zsLib_Log.cpp \
 zsLib/cpp/zsLib_MessageQueue.cpp \
+zsLib/cpp/zsLib_MessageQueueStatistics.cpp \
 zsLib/cpp/zsLib_MessageQueueThread.cpp \
 zsLib/cpp/zsLib_MessageQueueThreadBasic.cpp \
 zsLib/cpp/zsLib_MessageQueueThreadUsingBlackberryChannels.cpp \
@@ -85,6 +86,7 @@ zsLib/cpp/zsLib_XMLNode.cpp \
 zsLib/cpp/zsLib_XMLParser.cpp \
 zsLib/cpp/zsLib_XMLParserPos.cpp \
 zsLib/cpp/zsLib_XMLParserWarningTypes.cpp \
+zsLib/cpp/zsLib_XMLPath.cpp \
 zsLib/cpp/zsLib_XMLText.cpp \
 zsLib/cpp/zsLib_XMLUnknown.cpp \
 zsLib/extras/uuid/clear.c \
@@ -0,0 +1,84 @@
+/*
+
+ Copyright (c) 2016, Robin Raymond
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation
+ and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ The views and conclusions contained in the software and documentation are those
+ of the authors and should not be interpreted as representing official policies,
+ either expressed or implied, of the FreeBSD Project.
+ 
+ */
+
+#pragma once
+
+#include <zsLib/Promise.h>
+
+#include <zsLib/internal/zsLib_Coroutine.h>
+
+#ifdef ZSLIB_COROUTINES
+
+namespace zsLib
+{
+  //---------------------------------------------------------------------------
+  // PURPOSE: C++20 coroutine support (only available when the compiler
+  //          supports coroutines, see ZSLIB_COROUTINES).
+  //
+  //          A coroutine returning PromisePtr (or a PromiseWith<...> pointer)
+  //          gets a new promise that the coroutine settles: co_return resolves
+  //          it with the returned value and an escaping exception rejects it
+  //          with an AnyHolder<std::exception_ptr> reason. Coroutine frames are
+  //          recycled through a per thread cache.
+  //
+  //          co_await on a promise continues once the promise settles and
+  //          yields the settled promise. The coroutine resumes on the awaited
+  //          promise's queue with exactly one message (or immediately when the
+  //          promise has no queue, or was already settled).
+  //
+  // EXAMPLE:
+  //
+  // PromisePtr Object::refresh() {
+  //   co_await zsLib::resumeOn(mQueue);
+  //
+  //   PromisePtr fetched = co_await mService->fetch();
+  //   if (fetched->isRejected()) co_return nullptr;
+  //
+  //   co_return fetched->value<Any>();
+  // }
+  //
+
+  //---------------------------------------------------------------------------
+  // PURPOSE: Await to continue the coroutine on another queue (a single
+  //          message is posted unless already running on that queue).
+  inline internal::CoroutineQueueAwaiter resumeOn(IMessageQueuePtr queue) noexcept
+  {
+    return internal::CoroutineQueueAwaiter(queue);
+  }
+
+  template <typename PROMISE_TYPE, typename = typename std::enable_if<std::is_base_of<Promise, PROMISE_TYPE>::value>::type>
+  internal::CoroutinePromiseAwaiter<PROMISE_TYPE> operator co_await(const std::shared_ptr<PROMISE_TYPE> &promise) noexcept
+  {
+    return internal::CoroutinePromiseAwaiter<PROMISE_TYPE>(promise);
+  }
+}
+
+#endif //ZSLIB_COROUTINES
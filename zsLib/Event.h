@@ -53,6 +53,7 @@ namespace zsLib
 
     void reset() noexcept;   // after an event has been notified, reset must be called to cause the wait to happen again
     void wait() noexcept;    // once an event is notified via "notify()", "wait()" will no longer wait until "reset()" is called
+    bool waitUntil(const Time &deadline) noexcept;   // as "wait()" but gives up at the deadline (returns false if never notified)
     void notify() noexcept;  // breaks the wait from executing until the reset is called
   };
 }
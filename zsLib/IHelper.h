@@ -197,6 +197,12 @@ namespace zsLib
     static ElementPtr toJSON(const char *str) noexcept;
     static ElementPtr toXML(const char *str) noexcept;
 
+    // dump of IMessageQueueStatistics::getSnapshot() (empty unless enabled)
+    static String getMessageQueueStatistics(
+                                            bool formatAsJson = true,
+                                            bool reset = false
+                                            ) noexcept;
+
     static String getAttributeID(ElementPtr el) noexcept;
     static void setAttributeIDWithText(ElementPtr el, const String &value) noexcept;
     static void setAttributeIDWithNumber(ElementPtr el, const String &value) noexcept;
@@ -34,12 +34,79 @@
 #include <zsLib/types.h>
 #include <zsLib/Exception.h>
 
+#include <functional>
+#include <iterator>
+#include <vector>
+
 namespace zsLib
 {
+  // messages within a queue are processed highest priority first (with
+  // starvation protection for lower priorities) but remain in FIFO order
+  // relative to other messages of the same priority
+  enum MessagePriorities
+  {
+    MessagePriority_Low,
+    MessagePriority_Normal,
+    MessagePriority_High,
+  };
+
+  const char *toString(MessagePriorities priority) noexcept;
+
+  // what a bounded queue does with a post once it holds its maximum
+  enum MessageQueueOverflowPolicies
+  {
+    MessageQueueOverflowPolicy_Block,           // the posting thread waits for room (unless posting from the queue's own thread)
+    MessageQueueOverflowPolicy_Fail,            // the post throws IMessageQueue::Exceptions::MessageQueueFull
+    MessageQueueOverflowPolicy_DropOldest,      // the oldest waiting message (lowest priority first) is discarded
+    MessageQueueOverflowPolicy_DropDroppable,   // a message marked droppable is discarded, any other is still accepted
+  };
+
+  const char *toString(MessageQueueOverflowPolicies policy) noexcept;
+
+  struct MessageQueueCapacity
+  {
+    size_t mMaxMessages {};                     // 0 is unbounded
+    MessageQueueOverflowPolicies mOverflowPolicy {MessageQueueOverflowPolicy_Block};
+
+    bool hasData() const noexcept {return 0 != mMaxMessages;}
+
+    bool operator==(const MessageQueueCapacity &other) const noexcept {return (mMaxMessages == other.mMaxMessages) && (mOverflowPolicy == other.mOverflowPolicy);}
+    bool operator!=(const MessageQueueCapacity &other) const noexcept {return !(*this == other);}
+
+    static MessageQueueCapacity bounded(
+                                        size_t maxMessages,
+                                        MessageQueueOverflowPolicies policy = MessageQueueOverflowPolicy_Block
+                                        ) noexcept {MessageQueueCapacity result; result.mMaxMessages = maxMessages; result.mOverflowPolicy = policy; return result;}
+  };
+
+  struct MessageQueueCounters
+  {
+    size_t mHighWaterMark {};                   // most messages waiting at once
+    size_t mDropped {};                         // discarded by a drop policy
+    size_t mRejected {};                        // posts that failed with MessageQueueFull
+    size_t mBlocked {};                         // posts that had to wait for room
+    size_t mCoalesced {};                       // posts that replaced a waiting message with the same coalesce key
+  };
+
+  // a message posted while another message with the same key is still
+  // waiting replaces that message in place (keeping its queue position)
+  struct MessageCoalesceKey
+  {
+    const void *mTarget {};                     // e.g. the delegate object
+    const void *mMethod {};                     // e.g. the identity of a proxy method stub
+
+    bool hasData() const noexcept {return NULL != mMethod;}
+
+    bool operator<(const MessageCoalesceKey &other) const noexcept {return (mTarget == other.mTarget ? std::less<const void *>()(mMethod, other.mMethod) : std::less<const void *>()(mTarget, other.mTarget));}
+  };
+
   interaction IMessageQueueMessage
   {
     virtual const char *getDelegateName() const noexcept = 0;
     virtual const char *getMethodName() const noexcept = 0;
+    virtual MessagePriorities getPriority() const noexcept {return MessagePriority_Normal;}
+    virtual bool isDroppable() const noexcept {return false;}    // may be discarded by a full queue (see MessageQueueOverflowPolicy_DropDroppable)
+    virtual MessageCoalesceKey getCoalesceKey() const noexcept {return MessageCoalesceKey();}
 
     virtual void processMessage() noexcept = 0;
 
@@ -49,19 +116,32 @@ namespace zsLib
   template <class Closure>
   interaction IMessageQueueMessageClosure : public IMessageQueueMessage
   {
-    explicit IMessageQueueMessageClosure(const Closure &closure) noexcept : mClosure(closure) {}
-
-    virtual const char *getDelegateName() const noexcept {return __func__;}
-    virtual const char *getMethodName() const noexcept {return __func__;}
+    explicit IMessageQueueMessageClosure(
+                                         const Closure &closure,
+                                         MessagePriorities priority = MessagePriority_Normal,
+                                         bool droppable = false
+                                         ) noexcept : mClosure(closure), mPriority(priority), mDroppable(droppable) {}
+
+    virtual const char *getDelegateName() const noexcept {return "IMessageQueue";}   // every closure shares one statistics entry
+    virtual const char *getMethodName() const noexcept {return "postClosure";}
+    virtual MessagePriorities getPriority() const noexcept {return mPriority;}
+    virtual bool isDroppable() const noexcept {return mDroppable;}
     virtual void processMessage() noexcept {mClosure();}
 
     Closure mClosure;
+    MessagePriorities mPriority;
+    bool mDroppable;
   };
 
   interaction IMessageQueueNotify
   {
     virtual void notifyMessagePosted() noexcept = 0;
 
+    // a delayed message now has the earliest deadline in the queue; return
+    // true if the queue will be processed by then without further help (a
+    // notifier returning false gets a timer driven fallback instead)
+    virtual bool notifyMessageScheduled(const Time &deadline) noexcept {return false;}
+
     virtual bool isCurrentThread() const noexcept = 0;
   };
 
@@ -70,19 +150,72 @@ namespace zsLib
     struct Exceptions
     {
       ZS_DECLARE_CUSTOM_EXCEPTION(MessageQueueGone)
+      ZS_DECLARE_CUSTOM_EXCEPTION(MessageQueueFull)
     };
 
     typedef size_t size_type;
+    typedef std::vector<IMessageQueueMessageUniPtr> MessageList;
 
-    static IMessageQueuePtr create(IMessageQueueNotifyPtr notify) noexcept;
+    static IMessageQueuePtr create(
+                                   IMessageQueueNotifyPtr notify,
+                                   const MessageQueueCapacity &capacity = MessageQueueCapacity()
+                                   ) noexcept;
 
     virtual void post(IMessageQueueMessageUniPtr message) noexcept(false) = 0;
 
+    // appends every message in order under a single lock and notifies the
+    // queue's thread once; the list is emptied (a bounded queue using
+    // MessageQueueOverflowPolicy_Fail rejects a batch that does not fit as a
+    // whole and leaves it untouched, while a blocking queue may interleave
+    // other posts while it waits for room)
+    virtual void postBatch(MessageList &messages) noexcept(false) = 0;
+
+    template <class ClosureIterator>
+    void postClosureBatch(ClosureIterator begin, ClosureIterator end, MessagePriorities priority = MessagePriority_Normal) noexcept(false)
+    {
+      typedef typename std::iterator_traits<ClosureIterator>::value_type Closure;
+      MessageList messages;
+      for (; begin != end; ++begin) {
+        messages.push_back(IMessageQueueMessageUniPtr(new IMessageQueueMessageClosure<Closure>(*begin, priority)));
+      }
+      postBatch(messages);
+    }
+
+    // delayed messages are not processed before their deadline and are not
+    // counted by getTotalUnprocessedMessages() until that deadline is reached
+    virtual void postAt(
+                        IMessageQueueMessageUniPtr message,
+                        const Time &deadline
+                        ) noexcept(false) = 0;
+
+    void postDelayed(
+                     IMessageQueueMessageUniPtr message,
+                     Microseconds delay
+                     ) noexcept(false) {postAt(std::move(message), std::chrono::system_clock::now() + delay);}
+
     template <class Closure>
     void postClosure(const Closure &closure) noexcept(false) {post(IMessageQueueMessageUniPtr(new IMessageQueueMessageClosure<Closure>(closure)));}
 
+    template <class Closure>
+    void postClosure(const Closure &closure, MessagePriorities priority) noexcept(false) {post(IMessageQueueMessageUniPtr(new IMessageQueueMessageClosure<Closure>(closure, priority)));}
+
+    template <class Closure>
+    void postDroppableClosure(const Closure &closure, MessagePriorities priority = MessagePriority_Normal) noexcept(false) {post(IMessageQueueMessageUniPtr(new IMessageQueueMessageClosure<Closure>(closure, priority, true)));}
+
+    template <class Closure>
+    void postClosureAt(const Closure &closure, const Time &deadline, MessagePriorities priority = MessagePriority_Normal) noexcept(false) {postAt(IMessageQueueMessageUniPtr(new IMessageQueueMessageClosure<Closure>(closure, priority)), deadline);}
+
+    template <class Closure>
+    void postClosureDelayed(const Closure &closure, Microseconds delay, MessagePriorities priority = MessagePriority_Normal) noexcept(false) {postDelayed(IMessageQueueMessageUniPtr(new IMessageQueueMessageClosure<Closure>(closure, priority)), delay);}
+
     virtual size_type getTotalUnprocessedMessages() const noexcept = 0;
 
+    // a bounded queue applies its overflow policy to messages posted for
+    // immediate processing (delayed messages are admitted when they are due)
+    virtual void setCapacity(const MessageQueueCapacity &capacity) noexcept = 0;
+    virtual MessageQueueCapacity getCapacity() const noexcept = 0;
+    virtual MessageQueueCounters getCounters() const noexcept = 0;
+
     virtual bool isCurrentThread() const noexcept = 0;
   };
 }
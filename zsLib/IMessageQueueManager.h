@@ -32,6 +32,7 @@
 #pragma once
 
 #include <zsLib/IMessageQueueThread.h>
+#include <zsLib/IMessageQueueThreadPool.h>
 
 #include <map>
 
@@ -85,6 +86,41 @@ namespace zsLib
                                                    ThreadPriorities priority
                                                    ) noexcept;
 
+    //-------------------------------------------------------------------------
+    // PURPOSE: Registers the processor / NUMA node affinity for a thread (or
+    //          the dispatcher threads of a pool) that may be created by way
+    //          of "getMessageQueue" or "getThreadPoolQueue"
+    //
+    // NOTE:    Threads that already exist are updated immediately.
+    static void registerMessageQueueThreadAffinity(
+                                                   const char *assignedQueueName,
+                                                   const ThreadAffinity &affinity
+                                                   ) noexcept;
+
+    //-------------------------------------------------------------------------
+    // PURPOSE: Registers the capacity / overflow policy for a thread queue
+    //          (or every queue of a pool) obtained by way of
+    //          "getMessageQueue" or "getThreadPoolQueue"
+    //
+    // NOTE:    An existing thread queue is updated immediately, queues
+    //          previously handed out from a pool keep their capacity.
+    static void registerMessageQueueCapacity(
+                                             const char *assignedQueueName,
+                                             const MessageQueueCapacity &capacity
+                                             ) noexcept;
+
+    //-------------------------------------------------------------------------
+    // PURPOSE: Registers elastic scaling for a thread pool obtained by way
+    //          of "getThreadPoolQueue"
+    //
+    // NOTE:    With scaling registered the pool sizes itself between the
+    //          scaling minimum and maximum and "minThreadsRequired" is
+    //          ignored. An existing pool is updated immediately.
+    static void registerThreadPoolScaling(
+                                          const char *assignedThreadPoolQueueName,
+                                          const ThreadPoolScaling &scaling
+                                          ) noexcept;
+
     //-------------------------------------------------------------------------
     // PURPOSE: Count the number of unprocessed messages in each queue and
     //          return the summary total
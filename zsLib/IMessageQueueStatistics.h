@@ -0,0 +1,119 @@
+/*
+
+ Copyright (c) 2016, Robin Raymond
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation
+ and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ The views and conclusions contained in the software and documentation are those
+ of the authors and should not be interpreted as representing official policies,
+ either expressed or implied, of the FreeBSD Project.
+ 
+ */
+
+#pragma once
+
+#include <zsLib/types.h>
+#include <zsLib/String.h>
+
+#include <list>
+#include <vector>
+
+namespace zsLib
+{
+  //-------------------------------------------------------------------------
+  //-------------------------------------------------------------------------
+  //-------------------------------------------------------------------------
+  //-------------------------------------------------------------------------
+  //
+  // IMessageQueueStatistics
+  //
+
+  interaction IMessageQueueStatistics
+  {
+    ZS_DECLARE_TYPEDEF_PTR(XML::Element, Element);
+
+    //-------------------------------------------------------------------------
+    // PURPOSE: HDR style histogram of microsecond durations. Values below 16
+    //          are exact, every larger power of two range is split into 16
+    //          linear sub-buckets (i.e. about 6% worst case precision).
+    struct Histogram
+    {
+      ULONGLONG mCount {};
+      ULONGLONG mTotal {};
+      ULONGLONG mMin {};
+      ULONGLONG mMax {};
+      std::vector<ULONGLONG> mBuckets;          // grows to the highest bucket used
+
+      void record(ULONGLONG value) noexcept;
+      void merge(const Histogram &source) noexcept;
+      void reset() noexcept;
+
+      ULONGLONG getMean() const noexcept;
+      ULONGLONG getPercentile(double percentile) const noexcept;   // e.g. 99.9
+
+      static size_t toBucket(ULONGLONG value) noexcept;
+      static ULONGLONG fromBucket(size_t bucket) noexcept;            // lowest value recorded into the bucket
+    };
+
+    struct MethodStatistics
+    {
+      String mDelegateName;
+      String mMethodName;
+
+      Histogram mWaitTime;                      // enqueue to dispatch
+      Histogram mProcessingTime;                // time spent inside the message
+    };
+    typedef std::list<MethodStatistics> MethodStatisticsList;
+
+    struct QueueStatistics
+    {
+      PUID mID {};
+      String mName;                             // empty unless the queue was given a name
+
+      Histogram mWaitTime;
+      Histogram mProcessingTime;
+      MethodStatisticsList mMethods;
+    };
+    typedef std::list<QueueStatistics> QueueStatisticsList;
+
+    //-------------------------------------------------------------------------
+    // PURPOSE: Enable or disable recording on every message queue. Recording
+    //          is disabled by default and costs a single branch per message
+    //          while disabled.
+    static void enable(bool enable = true) noexcept;
+    static bool isEnabled() noexcept;
+
+    //-------------------------------------------------------------------------
+    // PURPOSE: Obtain a copy of the statistics for every live queue that
+    //          recorded at least one message, optionally resetting them.
+    static QueueStatisticsList getSnapshot(bool reset = false) noexcept;
+
+    //-------------------------------------------------------------------------
+    // PURPOSE: Discard all recorded statistics.
+    static void reset() noexcept;
+
+    //-------------------------------------------------------------------------
+    // PURPOSE: Convert a snapshot into a debug element (see IHelper::toString).
+    static ElementPtr toDebug(const QueueStatisticsList &statistics) noexcept;
+  };
+
+} // namespace zsLib
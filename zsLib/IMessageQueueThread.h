@@ -34,6 +34,8 @@
 #include <zsLib/types.h>
 #include <zsLib/IMessageQueue.h>
 
+#include <set>
+
 namespace zsLib
 {
 
@@ -56,15 +58,59 @@ namespace zsLib
                          ThreadPriorities threadPriority
                          ) noexcept;
 
+  //---------------------------------------------------------------------------
+  // PURPOSE: Describes which logical processors a thread may be scheduled on.
+  //          An empty affinity leaves the thread to the OS scheduler.
+  struct ThreadAffinity
+  {
+    typedef std::set<size_t> ProcessorSet;
+
+    ProcessorSet mProcessors;     // logical processors allowed (empty = all processors of mNUMANode)
+    int mNUMANode {-1};           // preferred NUMA node (-1 = no preference)
+    bool mPinEachThread {};       // thread pools only: pin each dispatcher to one processor (round robin) instead of the whole set
+
+    bool hasData() const noexcept {return (mProcessors.size() > 0) || (mNUMANode >= 0);}
+
+    bool operator==(const ThreadAffinity &rValue) const noexcept {return (mProcessors == rValue.mProcessors) && (mNUMANode == rValue.mNUMANode) && (mPinEachThread == rValue.mPinEachThread);}
+    bool operator!=(const ThreadAffinity &rValue) const noexcept {return !(*this == rValue);}
+
+    static ThreadAffinity forProcessor(size_t processor) noexcept;
+    static ThreadAffinity forNUMANode(int numaNode, bool pinEachThread = false) noexcept;
+
+    ProcessorSet resolve() const noexcept;    // the processors the affinity maps to (empty if unrestricted)
+
+    String toString() const noexcept;
+  };
+
+  //---------------------------------------------------------------------------
+  // PURPOSE: Restricts a thread to the processors described by the affinity.
+  //          Returns false if the platform does not support thread affinity
+  //          or the processors could not be applied.
+  bool setThreadAffinity(
+                         Thread &thread,
+                         const ThreadAffinity &affinity
+                         ) noexcept;
+
+  size_t getTotalProcessors() noexcept;
+  size_t getTotalNUMANodes() noexcept;                            // always at least 1
+  ThreadAffinity::ProcessorSet getNUMANodeProcessors(int numaNode) noexcept;
+
   interaction IMessageQueueThread : public IMessageQueue
   {
-    static IMessageQueueThreadPtr createBasic(const char *threadName = NULL, ThreadPriorities threadPriority = ThreadPriority_Normal) noexcept;
+    static IMessageQueueThreadPtr createBasic(
+                                              const char *threadName = NULL,
+                                              ThreadPriorities threadPriority = ThreadPriority_Normal,
+                                              const ThreadAffinity &affinity = ThreadAffinity(),
+                                              const MessageQueueCapacity &capacity = MessageQueueCapacity()
+                                              ) noexcept;
     static IMessageQueueThreadPtr singletonUsingCurrentGUIThreadsMessageQueue() noexcept;
 
     virtual void waitForShutdown() noexcept = 0;
 
     virtual void setThreadPriority(ThreadPriorities priority) noexcept = 0;
 
+    virtual void setThreadAffinity(const ThreadAffinity &affinity) noexcept = 0;
+
     virtual void processMessagesFromThread() noexcept = 0;
   };
 
@@ -36,22 +36,72 @@
 
 namespace zsLib
 {
+  //---------------------------------------------------------------------------
+  // PURPOSE: Elastic sizing for a thread pool. A dispatcher is added while
+  //          queues wait on a busy pool (too many at once or for too long)
+  //          and a dispatcher idle for "mIdleTimeout" is retired again.
+  struct ThreadPoolScaling
+  {
+    size_t mMinThreads {1};                       // dispatchers are never retired below this count
+    size_t mMaxThreads {};                        // 0 disables elastic scaling
+    size_t mGrowBacklog {4};                      // grow once this many queues wait for a dispatcher...
+    Milliseconds mGrowWaitTime {20};              // ...or the oldest waiting queue has waited this long
+    Milliseconds mGrowInterval {50};              // minimum time between two dispatchers being added
+    Milliseconds mIdleTimeout {Seconds(30)};      // idle time before a surplus dispatcher is retired
+    String mThreadNamePrefix;                     // added dispatchers are named "<prefix>.elastic.<n>"
+    ThreadPriorities mThreadPriority {ThreadPriority_Normal};
+
+    bool hasData() const noexcept {return mMaxThreads > 0;}
+
+    static ThreadPoolScaling elastic(size_t minThreads, size_t maxThreads) noexcept;
+  };
+
+  struct ThreadPoolScalingCounters
+  {
+    size_t mThreads {};                           // dispatchers currently running
+    size_t mPeakThreads {};                       // most dispatchers running at once
+    size_t mGrown {};                             // dispatchers added because of backlog
+    size_t mRetired {};                           // idle dispatchers retired
+    size_t mGrowDeferred {};                      // backlog seen but growth held back (interval or maximum reached)
+  };
+
   interaction IMessageQueueThreadPool
   {
     static IMessageQueueThreadPoolPtr create() noexcept;
 
+    //-------------------------------------------------------------------------
+    // PURPOSE: Adds a dispatcher thread to the pool. Without an explicit
+    //          affinity the pool affinity (see "setThreadAffinity") is used.
     virtual void createThread(
                               const char *threadName = NULL,
-                              ThreadPriorities threadPriority = ThreadPriority_Normal
+                              ThreadPriorities threadPriority = ThreadPriority_Normal,
+                              const ThreadAffinity &affinity = ThreadAffinity()
                               ) noexcept = 0;
 
     virtual void waitForShutdown() noexcept = 0;
 
     virtual bool hasPendingMessages() noexcept = 0;
 
-    virtual IMessageQueuePtr createQueue() noexcept = 0;
+    //-------------------------------------------------------------------------
+    // PURPOSE: Creates a queue serviced by the pool. Posts from any pool
+    //          thread to a full "Block" queue are accepted over capacity
+    //          since blocking a dispatcher could starve the pool.
+    virtual IMessageQueuePtr createQueue(const MessageQueueCapacity &capacity = MessageQueueCapacity()) noexcept = 0;
 
     virtual void setThreadPriority(ThreadPriorities threadPriority) noexcept = 0;
+
+    //-------------------------------------------------------------------------
+    // PURPOSE: Applies an affinity to every existing and future dispatcher
+    //          thread. With "mPinEachThread" each dispatcher is given a single
+    //          processor from the resolved set in round robin order.
+    virtual void setThreadAffinity(const ThreadAffinity &affinity) noexcept = 0;
+
+    //-------------------------------------------------------------------------
+    // PURPOSE: Enables (or with an empty scaling disables) elastic sizing.
+    //          Dispatchers are created immediately up to "mMinThreads".
+    virtual void setScaling(const ThreadPoolScaling &scaling) noexcept = 0;
+    virtual ThreadPoolScaling getScaling() const noexcept = 0;
+    virtual ThreadPoolScalingCounters getScalingCounters() const noexcept = 0;
   };
 
 } // namespace zsLib
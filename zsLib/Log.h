@@ -364,8 +364,10 @@ namespace zsLib
     Log(const make_private &);
 
   protected:
+    struct SingletonHolder;
 
     static LogPtr singleton();
+    static SingletonHolder &singletonHolder();
     static LogPtr create();
   };
 
@@ -157,6 +157,11 @@ namespace zsLib
 
     void then(IPromiseDelegatePtr delegate) noexcept;
     void thenWeak(IPromiseDelegatePtr delegate) noexcept;
+
+    // replaces any then() delegate; once settled the message is posted as-is
+    // to the promise's queue (or processed at once when there is no queue),
+    // i.e. exactly one message instead of a proxied delegate per callback
+    void thenMessage(IMessageQueueMessageUniPtr message) noexcept;
     template <class Closure>
     void thenClosure(const Closure &closure) noexcept             { then(std::make_shared< IPromiseClosureDelegate<Closure> >(closure)); }
     template <class ClosureResolve, class ClosureReject>
@@ -190,6 +195,8 @@ namespace zsLib
     void setReferenceHolder(AnyPtr referenceHolder) noexcept      {mReferenceHolder = referenceHolder;}
 
   protected:
+    void postThenMessage(IMessageQueueMessageUniPtr message) noexcept;
+
     void onPromiseSettled(PromisePtr promise) override;
     void onPromiseResolved(PromisePtr promise) override;
     void onPromiseRejected(PromisePtr promise) override;
@@ -435,6 +442,77 @@ namespace zsLib
     UseUserTypePtr userData() const noexcept { auto result = Promise::userData<AnyHolderUseUserType>(); if (result) return result->value_; return UseUserTypePtr(); }
   };
 
+#ifdef ZS_HAS_STD_OPTIONAL
+
+  // Holds the resolved value (and the rejection reason) inline inside the
+  // promise object instead of boxing it into an AnyPtr, so settling does not
+  // allocate and move-only types can be carried. It is still a Promise, i.e.
+  // then(), all(), race() etc. work as usual. The generic value<>() / reason<>()
+  // only see the payload when it is itself a pointer convertible to AnyPtr.
+  template <typename DataType, typename ReasonType = zsLib::AnyPtr>
+  class PromiseOf : public Promise
+  {
+  public:
+    typedef DataType UseDataType;
+    typedef ReasonType UseReasonType;
+
+    typedef PromiseOf<DataType, ReasonType> PromiseOfType;
+    typedef std::shared_ptr<PromiseOfType> PromiseOfTypePtr;
+    typedef std::weak_ptr<PromiseOfType> PromiseOfTypeWeakPtr;
+
+  public:
+    PromiseOf(
+              const make_private &,
+              IMessageQueuePtr queue = IMessageQueuePtr()
+              ) noexcept : Promise(make_private {}, queue) {}
+
+  public:
+    static PromiseOfTypePtr create(IMessageQueuePtr queue = IMessageQueuePtr()) noexcept {
+      PromiseOfTypePtr pThis(std::make_shared<PromiseOfType>(make_private{}, queue));
+      pThis->mThisWeak = pThis;
+      return pThis;
+    }
+
+    static PromiseOfTypePtr convert(PromisePtr promise) noexcept  {return ZS_DYNAMIC_PTR_CAST(PromiseOfType, promise);}
+
+    static PromiseOfTypePtr createResolved(
+                                           DataType value,
+                                           IMessageQueuePtr queue = IMessageQueuePtr()
+                                           ) noexcept {
+      PromiseOfTypePtr pThis = create(queue);
+      pThis->resolve(std::move(value));
+      return pThis;
+    }
+    static PromiseOfTypePtr createRejected(
+                                           ReasonType reason,
+                                           IMessageQueuePtr queue = IMessageQueuePtr()
+                                           ) noexcept {
+      PromiseOfTypePtr pThis = create(queue);
+      pThis->reject(std::move(reason));
+      return pThis;
+    }
+
+    // the payload is stored before the (locked) state change so anyone who
+    // observes isResolved() / isRejected() also observes the payload
+    void resolve(DataType &&value) noexcept       { ZS_ASSERT(!isSettled()); mTypedValue.emplace(std::move(value)); Promise::resolve(internal::PromiseOfAny<DataType>::get(*mTypedValue)); }
+    void resolve(const DataType &value) noexcept  { ZS_ASSERT(!isSettled()); mTypedValue.emplace(value); Promise::resolve(internal::PromiseOfAny<DataType>::get(*mTypedValue)); }
+    void reject(ReasonType &&reason) noexcept     { ZS_ASSERT(!isSettled()); mTypedReason.emplace(std::move(reason)); Promise::reject(internal::PromiseOfAny<ReasonType>::get(*mTypedReason)); }
+    void reject(const ReasonType &reason) noexcept { ZS_ASSERT(!isSettled()); mTypedReason.emplace(reason); Promise::reject(internal::PromiseOfAny<ReasonType>::get(*mTypedReason)); }
+
+    // NULL unless settled that way and the payload was not taken
+    const DataType *value() const noexcept        { if ((!isResolved()) || (!mTypedValue)) return NULL; return &(*mTypedValue); }
+    const ReasonType *reason() const noexcept     { if ((!isRejected()) || (!mTypedReason)) return NULL; return &(*mTypedReason); }
+
+    // moves the payload out (e.g. for move-only types), only once
+    std::optional<DataType> takeValue() noexcept  { std::optional<DataType> result; if (!isResolved()) return result; result.swap(mTypedValue); return result; }
+    std::optional<ReasonType> takeReason() noexcept { std::optional<ReasonType> result; if (!isRejected()) return result; result.swap(mTypedReason); return result; }
+
+  protected:
+    std::optional<DataType> mTypedValue;
+    std::optional<ReasonType> mTypedReason;
+  };
+
+#endif //ZS_HAS_STD_OPTIONAL
 
   interaction IPromiseSettledDelegate : public IPromiseDelegate
   {
@@ -161,6 +161,20 @@ namespace zsLib
     //
     static DelegatePtr createNoop(IMessageQueuePtr queue, bool throwsDelegateGone = false, int line = __LINE__, const char *fileName = __FILE__)                                    {return DelegatePtr()->proxy_implementation_for_this_interface_is_not_defined();}
 
+    //------------------------------------------------------------------------
+    // PURPOSE: Same as create() except an asynchronous method called from
+    //          the delegate's own queue thread while nothing else is waiting
+    //          on that queue invokes the delegate immediately instead of
+    //          posting a message. Ordering with queued messages is kept but
+    //          the call is now re-entrant (and exceptions thrown by the
+    //          delegate reach the caller).
+    // EXAMPLE:
+    //
+    // void Object::subscribeEvents(IDelegatePtr delegate) {
+    //   IDelegatePtr delegateProxy = zsLib::Proxy<IDelegate>::createDirectWhenSameQueue(delegate);
+    //
+    static DelegatePtr createDirectWhenSameQueue(DelegatePtr delegate, bool throwDelegateGone = false, int line = __LINE__, const char *fileName = __FILE__)                        {return delegate->proxy_implementation_for_this_interface_is_not_defined();}
+
     //------------------------------------------------------------------------
     // PURPOSE: Returns true if the delegate passed in is a proxy.
     // EXAMPLE:
@@ -195,11 +209,37 @@ namespace zsLib
 
 #include <zsLib/internal/zsLib_Proxy.h>
 
+#include <vector>
+
+// bool, counts proxies per creating call site (file and line) in any build
+#define ZSLIB_SETTING_PROXY_CENSUS "zsLib/proxy/census"
+
 namespace zsLib
 {
   // get the total number of proxies that are currently constructed and not destroyed
   ULONG proxyGetTotalConstructed();
   void proxyDump();
+
+  struct ProxyCensusEntry
+  {
+    const char *mFileName {};       // NULL sums up call sites that did not fit a thread's table
+    int mLine {};
+    ULONGLONG mTotalCreated {};     // over the process lifetime while the census was enabled (never reset)
+    LONGLONG mTotalLive {};
+  };
+  typedef std::vector<ProxyCensusEntry> ProxyCensusList;
+
+  //---------------------------------------------------------------------------
+  // PURPOSE: Returns the busiest proxy creating call sites, ordered by live
+  //          proxies (leaks) or by total proxies created (creation rate).
+  // NOTES:   Only collected while ZSLIB_SETTING_PROXY_CENSUS is true (each
+  //          thread re-reads the setting every few thousand proxies). Each
+  //          thread counts into its own table; the tables are summed up
+  //          when queried.
+  ProxyCensusList proxyCensus(
+                              size_t maxEntries = 20,
+                              bool orderByCreated = false
+                              );
 }
 
 #if 0
@@ -228,4 +268,10 @@ namespace zsLib
 #define ZS_DECLARE_PROXY_METHOD_SYNC_RETURN_THROWS(xMethod, xReturnType, ...)                                                                                 ZS_INTERNAL_MACRO_SELECT_WITH_PROPERTY_6(ZS_INTERNAL_DECLARE_PROXY_METHOD_SYNC, ZS_INTERNAL_PROXY_RETURN_KEYWORD, xReturnType, ZS_INTERNAL_PROXY_NO_IGNORE_CHECK, ZS_INTERNAL_PROXY_NO_CONST, ZS_INTERNAL_PROXY_THROW, xMethod, __VA_ARGS__)
 #define ZS_DECLARE_PROXY_METHOD_SYNC_RETURN_CONST_THROWS(xMethod, xReturnType, ...)                                                                           ZS_INTERNAL_MACRO_SELECT_WITH_PROPERTY_6(ZS_INTERNAL_DECLARE_PROXY_METHOD_SYNC, ZS_INTERNAL_PROXY_RETURN_KEYWORD, xReturnType, ZS_INTERNAL_PROXY_NO_IGNORE_CHECK, ZS_INTERNAL_PROXY_CONST, ZS_INTERNAL_PROXY_THROW, xMethod, __VA_ARGS__)
 
-#define ZS_DECLARE_PROXY_METHOD(...)                                                                                                                          ZS_INTERNAL_MACRO_SELECT_WITH_PROPERTY_1(ZS_INTERNAL_DECLARE_PROXY_METHOD, __VA_ARGS__)
+#define ZS_DECLARE_PROXY_METHOD(...)                                                                                                                          ZS_INTERNAL_MACRO_SELECT_WITH_PROPERTY_3(ZS_INTERNAL_DECLARE_PROXY_METHOD, zsLib::MessagePriority_Normal, ZS_INTERNAL_PROXY_NO_COALESCE, __VA_ARGS__)
+#define ZS_DECLARE_PROXY_METHOD_WITH_PRIORITY(xPriority, ...)                                                                                                 ZS_INTERNAL_MACRO_SELECT_WITH_PROPERTY_3(ZS_INTERNAL_DECLARE_PROXY_METHOD, xPriority, ZS_INTERNAL_PROXY_NO_COALESCE, __VA_ARGS__)
+
+// only the latest call matters: a call made while an earlier call to the same
+// method of the same delegate is still waiting replaces the waiting call
+#define ZS_DECLARE_PROXY_METHOD_COALESCE(...)                                                                                                                 ZS_INTERNAL_MACRO_SELECT_WITH_PROPERTY_3(ZS_INTERNAL_DECLARE_PROXY_METHOD, zsLib::MessagePriority_Normal, ZS_INTERNAL_PROXY_COALESCE, __VA_ARGS__)
+#define ZS_DECLARE_PROXY_METHOD_COALESCE_WITH_PRIORITY(xPriority, ...)                                                                                        ZS_INTERNAL_MACRO_SELECT_WITH_PROPERTY_3(ZS_INTERNAL_DECLARE_PROXY_METHOD, xPriority, ZS_INTERNAL_PROXY_COALESCE, __VA_ARGS__)
@@ -110,16 +110,19 @@ namespace zsLib
   //
 
   template <typename T, bool allowDestroy = true>
-  class SingletonLazySharedPtr : BoxedAllocation< std::weak_ptr<T>, false >
+  class SingletonLazySharedPtr : BoxedAllocation< internal::SingletonLazyState<T>, false >
   {
   public:
     ZS_DECLARE_PTR(T)
 
+    typedef internal::SingletonLazyState<T> State;
+
   public:
     SingletonLazySharedPtr(TPtr pThis) noexcept
     {
       mThis = pThis;
-      weakRef() = pThis;
+      state().mWeak = pThis;
+      state().mRaw.store(pThis.get(), std::memory_order_release);
 
       if (!allowDestroy) {
         // throw away an extra reference to "pThis" intentionally
@@ -128,21 +131,85 @@ namespace zsLib
       }
     }
 
+    ~SingletonLazySharedPtr() noexcept
+    {
+      if (!allowDestroy) return;  // object is intentionally never destroyed
+
+      T *object = state().mRaw.exchange(NULL);
+      if (!object) return;
+
+      // outstanding Access objects still use the raw pointer
+      internal::SingletonHazards::waitUntilUnprotected(object);
+    }
+
     TPtr singleton() noexcept
     {
-      return weakRef().lock();
+      return state().mWeak.lock();
     }
 
+    //-------------------------------------------------------------------------
+    // PURPOSE: Scoped access to the singleton without touching its reference
+    //          count (for hot paths that only use it for the current call).
+    // NOTES:   The object is guaranteed to stay alive until the Access object
+    //          goes out of scope. Do not keep the raw pointer beyond that,
+    //          use lock() to obtain a strong reference instead.
+    class Access
+    {
+    public:
+      explicit Access(SingletonLazySharedPtr &holder) noexcept :
+        mState(holder.state()),
+        mSlot(internal::SingletonHazards::acquireSlot())
+      {
+        if (!mSlot) {
+          // no hazard slot available (e.g. thread is exiting)
+          mStrong = mState.mWeak.lock();
+          mObject = mStrong.get();
+          return;
+        }
+
+        T *object = mState.mRaw.load(std::memory_order_acquire);
+        while (true) {
+          mSlot->store(object);
+          T *again = mState.mRaw.load();
+          if (again == object) break;
+          object = again;
+        }
+        mObject = object;
+      }
+
+      ~Access() noexcept
+      {
+        if (!mSlot) return;
+        internal::SingletonHazards::releaseSlot(mSlot);
+      }
+
+      Access(const Access &) = delete;
+      Access &operator=(const Access &) = delete;
+
+      T *get() const noexcept                 {return mObject;}
+      T *operator->() const noexcept          {return mObject;}
+      T &operator*() const noexcept           {return *mObject;}
+      explicit operator bool() const noexcept {return NULL != mObject;}
+
+      TPtr lock() const noexcept              {if (mStrong) return mStrong; return mState.mWeak.lock();}
+
+    private:
+      State &mState;
+      std::atomic<const void *> *mSlot {};
+      T *mObject {};
+      TPtr mStrong;
+    };
+
   private:
-    TWeakPtr &weakRef() noexcept
+    State &state() noexcept
     {
-      return BoxedAllocation< TWeakPtr, false >::ref();
+      return BoxedAllocation< State, false >::ref();
     }
-    
+
   private:
     TPtr mThis;
   };
-  
+
   //---------------------------------------------------------------------------
   //---------------------------------------------------------------------------
   //---------------------------------------------------------------------------
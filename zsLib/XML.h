@@ -757,6 +757,15 @@ namespace zsLib
     public:
       typedef internal::Parser::NoChildrenElementList NoChildrenElementList;
 
+      struct BatchResult
+      {
+        DocumentPtr mDocument;
+        Warnings mWarnings;
+      };
+
+      typedef std::vector<const char *> BatchInputVector;
+      typedef std::vector<BatchResult> BatchResultVector;
+
     public:
       static ParserPtr createXMLParser() noexcept;
       static ParserPtr createJSONParser(
@@ -775,6 +784,18 @@ namespace zsLib
                                 bool inAttributeNameIsCaseSensative = true
                                 ) noexcept;  // must be terminated with a NUL character
 
+      // parses every input buffer (each NUL terminated) in parallel using
+      // this parser's settings; the calling thread participates alongside
+      // the pool so the call is safe from any thread, results are returned
+      // in the same order as the inputs
+      BatchResultVector parseBatch(
+                                   IMessageQueueThreadPoolPtr pool,
+                                   const BatchInputVector &inDocuments,
+                                   bool inElementNameIsCaseSensative = true,
+                                   bool inAttributeNameIsCaseSensative = true,
+                                   size_t maxThreads = 0
+                                   ) noexcept;
+
       void clearWarnings() noexcept;
       const Warnings &getWarnings() const noexcept;
       void enableWarnings(bool inEnableWarnings) noexcept {mEnableWarnings = inEnableWarnings;}
@@ -853,6 +874,56 @@ namespace zsLib
                 ) noexcept;
     };
 
+    //-------------------------------------------------------------------------
+    //-------------------------------------------------------------------------
+    //-------------------------------------------------------------------------
+    //-------------------------------------------------------------------------
+    //
+    // Path
+    //
+    // A pre-compiled element query. The steps are relative to the node the
+    // path is evaluated against, i.e. "a/b" finds the "b" children of the
+    // "a" children of the context node.
+    //
+    // XPath-like form:   a/b[1]/*/c     ("*" matches any element name and
+    //                                    "[n]" picks the zero based n-th
+    //                                    matching sibling)
+    // JSON pointer form: /a/1/b/c       (numeric tokens index the previous
+    //                                    name, "~0" and "~1" escape "~"
+    //                                    and "/")
+    //
+
+    class Path : public internal::Path
+    {
+    public:
+      typedef std::list<ElementPtr> ElementList;
+      typedef std::vector<PathPtr> PathList;
+      typedef std::vector<ElementPtr> ElementVector;
+
+    public:
+      static PathPtr create(const char *inPath) noexcept;                   // returns NULL if the path is illegal
+      static PathPtr createFromJSONPointer(const char *inPointer) noexcept;  // returns NULL if the pointer is illegal
+
+      virtual const String &getPath() const noexcept;
+      virtual size_t getStepCount() const noexcept;
+
+      virtual ElementPtr findFirst(const NodePtr &inContext) const noexcept;
+      virtual ElementPtr findFirstChecked(const NodePtr &inContext) const noexcept(false); // throws Exceptions::CheckFailed
+
+      virtual size_t findAll(const NodePtr &inContext, ElementList &outResults) const noexcept;   // returns total found
+
+      // evaluates every path in a single walk of the tree, outResults[n]
+      // holds the first match for inPaths[n] (or NULL)
+      static void findFirst(
+                            const NodePtr &inContext,
+                            const PathList &inPaths,
+                            ElementVector &outResults
+                            ) noexcept;
+
+    public:
+      Path(const make_private &) noexcept;
+    };
+
   } // namespace XML
 
 } // namespace zsLib
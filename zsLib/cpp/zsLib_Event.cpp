@@ -33,16 +33,69 @@
 #include <zsLib/helpers.h>
 #include <zsLib/Exception.h>
 
+#ifdef ZSLIB_INTERNAL_USE_FUTEX_EVENT
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <errno.h>
+#include <limits.h>
+#endif //ZSLIB_INTERNAL_USE_FUTEX_EVENT
+
+#if (defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64)))
+#include <intrin.h>
+#endif //(defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64)))
+
 //namespace zsLib {ZS_DECLARE_SUBSYSTEM(zslib)}
 
 namespace zsLib
 {
   namespace internal
   {
+#ifndef ZSLIB_INTERNAL_USE_WIN32_EVENT
+
+    // the spin budget adapts between these bounds; a wait that is satisfied
+    // while spinning grows the budget, a wait that had to park shrinks it
+    static const uint32_t kEventSpinMin = 16;
+    static const uint32_t kEventSpinInitial = 256;
+    static const uint32_t kEventSpinMax = 4096;
+
+    //-------------------------------------------------------------------------
+    static inline void cpuRelax() noexcept
+    {
+#if (defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64)))
+      _mm_pause();
+#elif (defined(__i386__) || defined(__x86_64__))
+      __builtin_ia32_pause();
+#elif (defined(__aarch64__) || (defined(__ARM_ARCH) && (__ARM_ARCH >= 7)))
+      __asm__ __volatile__("yield");
+#endif
+    }
+
+    //-------------------------------------------------------------------------
+    static bool spinningAllowed() noexcept
+    {
+      // spinning only helps when the notifier can run at the same time
+      static const bool allowed = (std::thread::hardware_concurrency() > 1);
+      return allowed;
+    }
+
+#ifdef ZSLIB_INTERNAL_USE_FUTEX_EVENT
+    static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "futex word must be a plain 32 bit integer");
+
+    //-------------------------------------------------------------------------
+    static inline uint32_t *futexWord(std::atomic<uint32_t> &value) noexcept
+    {
+      return reinterpret_cast<uint32_t *>(&value);
+    }
+#endif //ZSLIB_INTERNAL_USE_FUTEX_EVENT
+
+#endif //ndef ZSLIB_INTERNAL_USE_WIN32_EVENT
+
     //-------------------------------------------------------------------------
     Event::Event(bool manualReset) noexcept
 #ifndef ZSLIB_INTERNAL_USE_WIN32_EVENT
-    : mManualReset(manualReset)
+    : mManualReset(manualReset),
+      mSpinLimit(kEventSpinInitial)
 #endif //ndef 
     {
 #ifdef ZSLIB_INTERNAL_USE_WIN32_EVENT
@@ -61,6 +114,114 @@ namespace zsLib
 #endif //_WIN32
     }
 
+#ifndef ZSLIB_INTERNAL_USE_WIN32_EVENT
+
+    //-------------------------------------------------------------------------
+    bool Event::tryConsume() noexcept
+    {
+      if (mManualReset) return (0 != mState.load());
+
+      uint32_t expected = 1;
+      return mState.compare_exchange_strong(expected, 0);
+    }
+
+    //-------------------------------------------------------------------------
+    bool Event::trySpin() noexcept
+    {
+      if (!spinningAllowed()) return false;
+
+      uint32_t limit = mSpinLimit.load(std::memory_order_relaxed);
+
+      for (uint32_t spin = 0; spin < limit; ++spin) {
+        if (0 != mState.load(std::memory_order_relaxed)) {
+          if (tryConsume()) {
+            // aim the budget at roughly twice what this wait needed
+            uint32_t target = spin * 2;
+            uint32_t next = (target > limit ? limit + ((target - limit) / 8) : limit - ((limit - target) / 8));
+            next = (next < kEventSpinMin ? kEventSpinMin : (next > kEventSpinMax ? kEventSpinMax : next));
+            mSpinLimit.store(next, std::memory_order_relaxed);
+            return true;
+          }
+        }
+        cpuRelax();
+      }
+
+      uint32_t next = limit / 2;
+      mSpinLimit.store(next < kEventSpinMin ? kEventSpinMin : next, std::memory_order_relaxed);
+      return false;
+    }
+
+    //-------------------------------------------------------------------------
+    bool Event::park(const Time *deadline) noexcept
+    {
+      bool result = true;
+
+      // the waiter count is raised before the state is re-checked and the
+      // notifier sets the state before reading the count (both sequentially
+      // consistent) so at least one side always sees the other
+#ifdef ZSLIB_INTERNAL_USE_FUTEX_EVENT
+      ++mWaiters;
+      while (!tryConsume()) {
+        if (!deadline) {
+          // only sleeps if the word is still 0 (i.e. nobody notified in between)
+          syscall(SYS_futex, futexWord(mState), FUTEX_WAIT_PRIVATE, 0, NULL, NULL, 0);
+          continue;
+        }
+
+        auto remaining = std::chrono::duration_cast<Nanoseconds>((*deadline) - zsLib::now());
+        if (remaining.count() <= 0) {
+          result = false;
+          break;
+        }
+
+        struct timespec timeout {};
+        timeout.tv_sec = static_cast<time_t>(remaining.count() / 1000000000);
+        timeout.tv_nsec = static_cast<long>(remaining.count() % 1000000000);
+        syscall(SYS_futex, futexWord(mState), FUTEX_WAIT_PRIVATE, 0, &timeout, NULL, 0);
+      }
+      --mWaiters;
+#else
+      std::unique_lock<std::mutex> lock(mMutex);
+      ++mWaiters;
+      while (!tryConsume()) {
+        if (!deadline) {
+          mCondition.wait(lock);
+          continue;
+        }
+        if (std::cv_status::timeout == mCondition.wait_until(lock, *deadline)) {
+          result = tryConsume();
+          break;
+        }
+      }
+      --mWaiters;
+#endif //ZSLIB_INTERNAL_USE_FUTEX_EVENT
+
+      return result;
+    }
+
+    //-------------------------------------------------------------------------
+    void Event::wake() noexcept
+    {
+      if (0 == mWaiters.load()) return;   // nobody parked, no syscall / lock needed
+
+#ifdef ZSLIB_INTERNAL_USE_FUTEX_EVENT
+      syscall(SYS_futex, futexWord(mState), FUTEX_WAKE_PRIVATE, (mManualReset ? INT_MAX : 1), NULL, NULL, 0);
+#else
+      {
+        // a parked thread holds the lock from raising the waiter count until
+        // it sleeps so acquiring it here guarantees the notify is observed
+        std::lock_guard<std::mutex> lock(mMutex);
+      }
+      if (mManualReset) {
+        mCondition.notify_all();
+      } else {
+        mCondition.notify_one();
+      }
+#endif //ZSLIB_INTERNAL_USE_FUTEX_EVENT
+    }
+
+#endif //ndef ZSLIB_INTERNAL_USE_WIN32_EVENT
+
   }
 
   //---------------------------------------------------------------------------
@@ -76,7 +237,7 @@ namespace zsLib
     if (NULL == mEvent) return;
     ::ResetEvent(mEvent);
 #else
-    mNotified = false;
+    mState = 0;
 #endif //_WIN32
   }
 
@@ -87,15 +248,24 @@ namespace zsLib
     if (NULL == mEvent) return;
     ::WaitForSingleObjectEx(mEvent, INFINITE, FALSE);
 #else
-    std::unique_lock<std::mutex> lock(mMutex);
-
-    if (mManualReset) {
-      auto &notified = mNotified;
-      mCondition.wait(lock, [&notified]() { return (bool)notified; });
-    } else {
-      mCondition.wait(lock);
+    if (tryConsume()) return;
+    if (trySpin()) return;
+    park();
+#endif //WIN32
   }
 
+  //---------------------------------------------------------------------------
+  bool Event::waitUntil(const Time &deadline) noexcept
+  {
+#ifdef ZSLIB_INTERNAL_USE_WIN32_EVENT
+    if (NULL == mEvent) return false;
+    auto remaining = std::chrono::duration_cast<Milliseconds>(deadline - zsLib::now());
+    DWORD timeout = static_cast<DWORD>(remaining.count() > 0 ? remaining.count() : 0);
+    return WAIT_OBJECT_0 == ::WaitForSingleObjectEx(mEvent, timeout, FALSE);
+#else
+    if (tryConsume()) return true;
+    if (trySpin()) return true;
+    return park(&deadline);
 #endif //WIN32
   }
 
@@ -106,13 +276,8 @@ namespace zsLib
     if (NULL == mEvent) return;
     ::SetEvent(mEvent);
 #else
-    std::lock_guard<std::mutex> lock(mMutex);
-    mNotified = true;
-    if (mManualReset) {
-      mCondition.notify_all();
-    } else {
-      mCondition.notify_one();
-    }
+    mState = 1;
+    wake();
 #endif //_WIN32
   }
 
@@ -42,6 +42,7 @@
 #include <zsLib/Numeric.h>
 #include <zsLib/helpers.h>
 #include <zsLib/IPAddress.h>
+#include <zsLib/IMessageQueueStatistics.h>
 #include <zsLib/XML.h>
 
 namespace zsLib { ZS_DECLARE_SUBSYSTEM(zslib) }
@@ -1448,6 +1449,15 @@ namespace zsLib
     return output.get();
   }
 
+  //---------------------------------------------------------------------------
+  String IHelper::getMessageQueueStatistics(
+                                            bool formatAsJson,
+                                            bool reset
+                                            ) noexcept
+  {
+    return toString(IMessageQueueStatistics::toDebug(IMessageQueueStatistics::getSnapshot(reset)), formatAsJson);
+  }
+
   //---------------------------------------------------------------------------
   ElementPtr IHelper::toJSON(const char *str) noexcept
   {
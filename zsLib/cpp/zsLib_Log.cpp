@@ -313,11 +313,23 @@ namespace zsLib
     }
   }
 
+  //---------------------------------------------------------------------------
+  struct Log::SingletonHolder : public SingletonLazySharedPtr<Log>
+  {
+    SingletonHolder() noexcept : SingletonLazySharedPtr<Log>(Log::create()) {}
+  };
+
+  //---------------------------------------------------------------------------
+  Log::SingletonHolder &Log::singletonHolder()
+  {
+    static SingletonHolder singleton;
+    return singleton;
+  }
+
   //---------------------------------------------------------------------------
   LogPtr Log::singleton()
   {
-    static SingletonLazySharedPtr<Log> singleton(create());
-    return singleton.singleton();
+    return singletonHolder().singleton();
   }
 
   //---------------------------------------------------------------------------
@@ -607,7 +619,7 @@ namespace zsLib
     if (inLevel > inSubsystem.getOutputLevel())
       return;
 
-    LogPtr log = Log::singleton();
+    SingletonLazySharedPtr<Log>::Access log(singletonHolder());
     if (!log) return;
 
     Log &refThis = (*log);
@@ -31,7 +31,12 @@
 
 #include <zsLib/internal/zsLib_MessageQueue.h>
 
+#include <zsLib/ITimer.h>
 #include <zsLib/Log.h>
+#include <zsLib/MessageQueueAssociator.h>
+#include <zsLib/helpers.h>
+
+#include <algorithm>
 
 #ifndef ZSLIB_EVENTING_NOOP
 #include <zsLib/internal/zsLib.events.h>
@@ -47,6 +52,68 @@ namespace zsLib
 
   namespace internal
   {
+    // a waiting lower priority message is processed after being passed over
+    // this many times for higher priority messages
+    static const size_t kStarvationLimit = 32;
+
+    //-------------------------------------------------------------------------
+    //-------------------------------------------------------------------------
+    //-------------------------------------------------------------------------
+    //-------------------------------------------------------------------------
+    //
+    // MessageQueueDeadlineTimer
+    //
+
+    // wakes a queue at its next deadline when the queue's notifier has no way
+    // to wait on a deadline itself (e.g. a GUI thread's native message loop)
+    class MessageQueueDeadlineTimer : public MessageQueueAssociator,
+                                      public ITimerDelegate
+    {
+    protected:
+      struct make_private {};
+
+    public:
+      //-----------------------------------------------------------------------
+      MessageQueueDeadlineTimer(
+                                const make_private &,
+                                MessageQueuePtr queue
+                                ) noexcept :
+        MessageQueueAssociator(queue),
+        mQueue(queue)
+      {
+      }
+
+      //-----------------------------------------------------------------------
+      static MessageQueueDeadlineTimerPtr create(
+                                                 MessageQueuePtr queue,
+                                                 const Time &deadline
+                                                 ) noexcept
+      {
+        MessageQueueDeadlineTimerPtr pThis(make_shared<MessageQueueDeadlineTimer>(make_private{}, queue));
+        pThis->mTimer = ITimer::create(pThis, deadline);
+        return pThis;
+      }
+
+      //-----------------------------------------------------------------------
+      void cancel() noexcept
+      {
+        if (mTimer) mTimer->cancel();
+      }
+
+      //-----------------------------------------------------------------------
+      void onTimer(ITimerPtr timer) override
+      {
+        // due messages were already moved ahead of this one when it was popped
+        auto queue = mQueue.lock();
+        if (!queue) return;
+        queue->notifyDeadlineTimer(this);
+      }
+
+    protected:
+      MessageQueueWeakPtr mQueue;
+      ITimerPtr mTimer;
+    };
+
     //-------------------------------------------------------------------------
     MessageQueue::MessageQueue(
                                const make_private &,
@@ -60,13 +127,20 @@ namespace zsLib
     //-------------------------------------------------------------------------
     MessageQueue::~MessageQueue() noexcept
     {
+      if (mDeadlineTimer) mDeadlineTimer->cancel();
       ZS_EVENTING_1(x, i, Trace, MessageQueueDestroy, zs, MessageQueue, Stop, this, this, this);
     }
 
     //-------------------------------------------------------------------------
-    MessageQueuePtr MessageQueue::create(IMessageQueueNotifyPtr notify) noexcept
+    MessageQueuePtr MessageQueue::create(
+                                         IMessageQueueNotifyPtr notify,
+                                         const MessageQueueCapacity &capacity
+                                         ) noexcept
     {
-      return make_shared<MessageQueue>(make_private{}, notify);
+      MessageQueuePtr pThis(make_shared<MessageQueue>(make_private{}, notify));
+      pThis->mThisWeak = pThis;
+      pThis->mCapacity = capacity;
+      return pThis;
     }
 
     //-------------------------------------------------------------------------
@@ -74,67 +148,489 @@ namespace zsLib
     {
       ZS_EVENTING_1(x, i, Insane, MessageQueuePost, zs, MessageQueue, Send, this, this, this);
 
+      PendingMessage pending;
+      pending.mMessage = std::move(message);
+      if (MessageQueueStatistics::isEnabled()) pending.mPosted = MessageQueueStatistics::Clock::now();
+
+      PendingMessage discarded;   // destroyed outside of the lock
+      bool unnotified = false;
+
       {
-        AutoLock lock(mLock);
-        mMessages.push(std::move(message));
+        std::unique_lock<Lock> lock(mLock);
+        if (!admitMessage(pending, discarded, lock, unnotified)) return;
       }
       mNotify->notifyMessagePosted();
     }
 
+    //-------------------------------------------------------------------------
+    void MessageQueue::postBatch(MessageList &messages) noexcept(false)
+    {
+      if (messages.size() < 1) return;
+
+      ZS_EVENTING_1(x, i, Insane, MessageQueuePost, zs, MessageQueue, Send, this, this, this);
+
+      MessageQueueStatistics::TimePoint posted;
+      if (MessageQueueStatistics::isEnabled()) posted = MessageQueueStatistics::Clock::now();
+
+      std::vector<PendingMessage> discarded;   // destroyed outside of the lock
+      bool unnotified = false;
+
+      {
+        std::unique_lock<Lock> lock(mLock);
+
+        if ((mCapacity.hasData()) &&
+            (MessageQueueOverflowPolicy_Fail == mCapacity.mOverflowPolicy) &&
+            (mTotalMessages + messages.size() > mCapacity.mMaxMessages)) {
+          // the batch is rejected as a whole and is left untouched
+          ++mCounters.mRejected;
+          lock.unlock();
+          ZS_THROW_CUSTOM(IMessageQueue::Exceptions::MessageQueueFull, "message batch posted to message queue without room for the batch.");
+        }
+
+        for (auto iter = messages.begin(); iter != messages.end(); ++iter) {
+          PendingMessage pending;
+          pending.mMessage = std::move(*iter);
+          pending.mPosted = posted;
+
+          PendingMessage dropped;
+          if (admitMessage(pending, dropped, lock, unnotified)) unnotified = true;
+          if (dropped.mMessage) discarded.push_back(std::move(dropped));
+        }
+      }
+
+      messages.clear();
+
+      if (unnotified) mNotify->notifyMessagePosted();
+    }
+
+    //-------------------------------------------------------------------------
+    void MessageQueue::postAt(
+                              IMessageQueueMessageUniPtr message,
+                              const Time &deadline
+                              ) noexcept(false)
+    {
+      Time now = zsLib::now();
+      if (deadline <= now) {
+        post(std::move(message));
+        return;
+      }
+
+      DelayedMessage delayed;
+      delayed.mDeadline = deadline;
+      delayed.mPending.mMessage = std::move(message);
+      if (MessageQueueStatistics::isEnabled()) {
+        // the wait of a delayed message is measured from its deadline
+        delayed.mPending.mPosted = MessageQueueStatistics::Clock::now() + std::chrono::duration_cast<MessageQueueStatistics::Clock::duration>(deadline - now);
+      }
+
+      bool earliest = false;
+
+      {
+        AutoLock lock(mLock);
+        delayed.mOrder = ++mDelayedOrder;
+        mDelayed.push_back(std::move(delayed));
+        std::push_heap(mDelayed.begin(), mDelayed.end());
+        earliest = (mDelayed.front().mOrder == mDelayedOrder);
+      }
+
+      if (!earliest) return;
+      if (mNotify->notifyMessageScheduled(deadline)) return;
+
+      armDeadlineTimer();
+    }
+
     //-------------------------------------------------------------------------
     void MessageQueue::process() noexcept
     {
       do
       {
-        IMessageQueueMessagePtr message;
+        PendingMessage pending;
 
         {
           AutoLock lock(mLock);
-          if (0 == mMessages.size())
+          if (!popNextMessage(pending))
             return;
-          message = std::move(mMessages.front());
-          mMessages.pop();
         }
 
         ZS_EVENTING_1(x, i, Insane, MessageQueueProcess, zs, MessageQueue, Receive, this, this, this);
 
         // process the next message
-        message->processMessage();
+        processMessage(pending);
       } while (true);
     }
 
     //-------------------------------------------------------------------------
     void MessageQueue::processOnlyOneMessage() noexcept
     {
-      IMessageQueueMessagePtr message;
+      PendingMessage pending;
 
       {
         AutoLock lock(mLock);
-        if (0 == mMessages.size())
+        if (!popNextMessage(pending))
           return;
-        message = std::move(mMessages.front());
-        mMessages.pop();
       }
 
       ZS_EVENTING_1(x, i, Insane, MessageQueueProcess, zs, MessageQueue, Receive, this, this, this);
 
       // process the next message
-      message->processMessage();
+      processMessage(pending);
+    }
+
+    //-------------------------------------------------------------------------
+    bool MessageQueue::isCurrentThread() const noexcept
+    {
+      return std::this_thread::get_id() == mDispatchingThread.load(std::memory_order_relaxed);
+    }
+
+    //-------------------------------------------------------------------------
+    void MessageQueue::setName(const char *name) noexcept
+    {
+      MessageQueueStatisticsPtr statistics;
+
+      {
+        AutoLock lock(mLock);
+        mName = String(name);
+        statistics = mStatistics;
+      }
+
+      if (statistics) statistics->setName(name);
+    }
+
+    //-------------------------------------------------------------------------
+    Time MessageQueue::getNextDeadline() const noexcept
+    {
+      AutoLock lock(mLock);
+      if (mDelayed.size() < 1) return Time();
+      return mDelayed.front().mDeadline;
+    }
+
+    //-------------------------------------------------------------------------
+    void MessageQueue::processMessage(PendingMessage &pending) noexcept
+    {
+      // a queue is dispatched by one thread at a time (a pool queue may move
+      // between pool threads), so the thread in here is the queue's thread
+      auto previous = mDispatchingThread.exchange(std::this_thread::get_id(), std::memory_order_relaxed);
+
+      if (!MessageQueueStatistics::isEnabled()) {
+        pending.mMessage->processMessage();
+        mDispatchingThread.store(previous, std::memory_order_relaxed);
+        return;
+      }
+
+      // only the thread dispatching this queue creates the statistics
+      if (!mStatistics) {
+        MessageQueueStatisticsPtr statistics = MessageQueueStatistics::create();
+
+        AutoLock lock(mLock);
+        statistics->setName(mName);
+        mStatistics = statistics;
+      }
+
+      auto started = MessageQueueStatistics::Clock::now();
+      pending.mMessage->processMessage();
+      auto finished = MessageQueueStatistics::Clock::now();
+
+      mDispatchingThread.store(previous, std::memory_order_relaxed);
+
+      mStatistics->record(*(pending.mMessage), pending.mPosted, started, finished);
+    }
+
+    //-------------------------------------------------------------------------
+    bool MessageQueue::popNextMessage(PendingMessage &outPending) noexcept
+    {
+      if (mDelayed.size() > 0) promoteDueMessages();
+      if (0 == mTotalMessages) return false;
+
+      MessageLane *lanes[Lane_Total] = {mLowMessages.get(), &mMessages, mHighMessages.get()};
+
+      size_t highest = Lane_Total;
+      for (size_t index = Lane_Total; index > 0; --index) {
+        MessageLane *lane = lanes[index - 1];
+        if ((lane) && (lane->size() > 0)) {
+          highest = index - 1;
+          break;
+        }
+      }
+      ZS_ASSERT(highest < Lane_Total);
+
+      // serve a lower lane that has waited long enough, otherwise the highest
+      size_t serve = highest;
+      for (size_t index = 0; index < highest; ++index) {
+        MessageLane *lane = lanes[index];
+        if ((!lane) || (0 == lane->size())) continue;
+        if (mStarved[index] < kStarvationLimit) continue;
+        serve = index;
+        break;
+      }
+
+      for (size_t index = 0; index < highest; ++index) {
+        if (index == serve) continue;
+        MessageLane *lane = lanes[index];
+        if ((!lane) || (0 == lane->size())) continue;
+        ++mStarved[index];
+      }
+      mStarved[serve] = 0;
+
+      MessageLane &lane = *(lanes[serve]);
+      if (lane.front().mCoalescable) forgetCoalescable(lane.front());
+      outPending = std::move(lane.front());
+      lane.pop();
+      --mTotalMessages;
+
+      if (mBlockedPosts > 0) mSpaceAvailable.notify_one();
+      return true;
+    }
+
+    //-------------------------------------------------------------------------
+    MessageQueue::PendingMessage &MessageQueue::pushMessage(PendingMessage &pending) noexcept
+    {
+      MessageLane *lane = &mMessages;
+
+      switch (pending.mMessage->getPriority()) {
+        case MessagePriority_Normal: break;
+        case MessagePriority_High: {
+          if (!mHighMessages) mHighMessages = MessageLaneUniPtr(new MessageLane);
+          lane = mHighMessages.get();
+          break;
+        }
+        case MessagePriority_Low: {
+          if (!mLowMessages) mLowMessages = MessageLaneUniPtr(new MessageLane);
+          lane = mLowMessages.get();
+          break;
+        }
+      }
+      lane->push(std::move(pending));
+
+      ++mTotalMessages;
+      if (mTotalMessages > mCounters.mHighWaterMark) mCounters.mHighWaterMark = mTotalMessages;
+      return lane->back();
+    }
+
+    //-------------------------------------------------------------------------
+    void MessageQueue::forgetCoalescable(PendingMessage &pending) noexcept
+    {
+      auto found = mCoalescing.find(pending.mMessage->getCoalesceKey());
+      if (found == mCoalescing.end()) return;
+      if ((*found).second != &pending) return;
+      mCoalescing.erase(found);
+    }
+
+    //-------------------------------------------------------------------------
+    void MessageQueue::promoteDueMessages() noexcept
+    {
+      Time now = zsLib::now();
+
+      while ((mDelayed.size() > 0) && (mDelayed.front().mDeadline <= now)) {
+        std::pop_heap(mDelayed.begin(), mDelayed.end());
+        pushMessage(mDelayed.back().mPending);
+        mDelayed.pop_back();
+      }
+    }
+
+    //-------------------------------------------------------------------------
+    bool MessageQueue::admitMessage(
+                                    PendingMessage &pending,
+                                    PendingMessage &outDiscarded,
+                                    std::unique_lock<Lock> &lock,
+                                    bool &ioUnnotified
+                                    ) noexcept(false)
+    {
+      MessageCoalesceKey key = pending.mMessage->getCoalesceKey();
+
+      if (key.hasData()) {
+        auto found = mCoalescing.find(key);
+        if (found != mCoalescing.end()) {
+          // the waiting message is replaced in place and was already notified
+          std::swap((*found).second->mMessage, pending.mMessage);
+          ++mCounters.mCoalesced;
+          outDiscarded = std::move(pending);
+          return false;
+        }
+        pending.mCoalescable = true;
+      }
+
+      if ((mCapacity.hasData()) && (mTotalMessages >= mCapacity.mMaxMessages)) {
+        if (!makeRoom(pending, outDiscarded, lock, ioUnnotified)) return false;
+      }
+
+      PendingMessage &pushed = pushMessage(pending);
+      if (key.hasData()) mCoalescing[key] = &pushed;
+      return true;
+    }
+
+    //-------------------------------------------------------------------------
+    bool MessageQueue::makeRoom(
+                                PendingMessage &pending,
+                                PendingMessage &outDiscarded,
+                                std::unique_lock<Lock> &lock,
+                                bool &ioUnnotified
+                                ) noexcept(false)
+    {
+      switch (mCapacity.mOverflowPolicy) {
+        case MessageQueueOverflowPolicy_Block: {
+          lock.unlock();
+          if (ioUnnotified) {
+            // the consumer must learn about the messages this batch already
+            // queued or it never makes the room being waited for
+            ioUnnotified = false;
+            mNotify->notifyMessagePosted();
+          }
+          bool fromQueueThread = mNotify->isCurrentThread();
+          lock.lock();
+
+          // the queue's own thread is the only one able to make room
+          if (fromQueueThread) return true;
+
+          bool counted = false;
+          while ((mCapacity.hasData()) && (mTotalMessages >= mCapacity.mMaxMessages)) {
+            if (!counted) {
+              ++mCounters.mBlocked;
+              counted = true;
+            }
+            ++mBlockedPosts;
+            mSpaceAvailable.wait(lock);
+            --mBlockedPosts;
+          }
+          return true;
+        }
+        case MessageQueueOverflowPolicy_Fail: {
+          ++mCounters.mRejected;
+          lock.unlock();
+          ZS_THROW_CUSTOM(IMessageQueue::Exceptions::MessageQueueFull, "message posted to message queue that is already full.");
+        }
+        case MessageQueueOverflowPolicy_DropOldest: {
+          MessageLane *lanes[Lane_Total] = {mLowMessages.get(), &mMessages, mHighMessages.get()};
+          for (size_t index = 0; index < Lane_Total; ++index) {
+            MessageLane *lane = lanes[index];
+            if ((!lane) || (0 == lane->size())) continue;
+
+            if (lane->front().mCoalescable) forgetCoalescable(lane->front());
+            outDiscarded = std::move(lane->front());
+            lane->pop();
+            --mTotalMessages;
+            ++mCounters.mDropped;
+            break;
+          }
+          return true;
+        }
+        case MessageQueueOverflowPolicy_DropDroppable: {
+          if (!pending.mMessage->isDroppable()) return true;
+
+          outDiscarded = std::move(pending);
+          ++mCounters.mDropped;
+          return false;
+        }
+      }
+      return true;
+    }
+
+    //-------------------------------------------------------------------------
+    void MessageQueue::armDeadlineTimer() noexcept
+    {
+      Time deadline = getNextDeadline();
+      if (Time() == deadline) return;
+
+      {
+        AutoLock lock(mLock);
+        if ((mDeadlineTimer) && (mDeadlineTimerDeadline <= deadline)) return;
+      }
+
+      // the timer monitor is never called while holding the queue's lock
+      MessageQueueDeadlineTimerPtr timer = MessageQueueDeadlineTimer::create(mThisWeak.lock(), deadline);
+      MessageQueueDeadlineTimerPtr replaced;
+
+      {
+        AutoLock lock(mLock);
+        if ((mDeadlineTimer) && (mDeadlineTimerDeadline <= deadline)) {
+          replaced = timer;   // lost a race with an earlier deadline
+        } else {
+          replaced = mDeadlineTimer;
+          mDeadlineTimer = timer;
+          mDeadlineTimerDeadline = deadline;
+        }
+      }
+
+      if (replaced) replaced->cancel();
+    }
+
+    //-------------------------------------------------------------------------
+    void MessageQueue::notifyDeadlineTimer(MessageQueueDeadlineTimer *timer) noexcept
+    {
+      MessageQueueDeadlineTimerPtr fired;
+
+      {
+        AutoLock lock(mLock);
+        if (mDeadlineTimer.get() != timer) return;
+        fired = mDeadlineTimer;   // released outside the lock
+        mDeadlineTimer.reset();
+      }
+
+      armDeadlineTimer();
     }
 
     //-------------------------------------------------------------------------
     IMessageQueue::size_type MessageQueue::getTotalUnprocessedMessages() const noexcept
     {
       AutoLock lock(mLock);
-      ZS_EVENTING_2(x, i, Insane, MessageQueueTotalUnprocessedMessages, zs, MessageQueue, Info, this, this, this, size_t, messages, mMessages.size());
-      return static_cast<size_type>(mMessages.size());
+      ZS_EVENTING_2(x, i, Insane, MessageQueueTotalUnprocessedMessages, zs, MessageQueue, Info, this, this, this, size_t, messages, mTotalMessages);
+      return static_cast<size_type>(mTotalMessages);
+    }
+
+    //-------------------------------------------------------------------------
+    void MessageQueue::setCapacity(const MessageQueueCapacity &capacity) noexcept
+    {
+      AutoLock lock(mLock);
+      mCapacity = capacity;
+      if (mBlockedPosts > 0) mSpaceAvailable.notify_all();
+    }
+
+    //-------------------------------------------------------------------------
+    MessageQueueCapacity MessageQueue::getCapacity() const noexcept
+    {
+      AutoLock lock(mLock);
+      return mCapacity;
+    }
+
+    //-------------------------------------------------------------------------
+    MessageQueueCounters MessageQueue::getCounters() const noexcept
+    {
+      AutoLock lock(mLock);
+      return mCounters;
     }
   } // namespace internal
 
   //---------------------------------------------------------------------------
-  IMessageQueuePtr IMessageQueue::create(IMessageQueueNotifyPtr notify) noexcept
+  const char *toString(MessagePriorities priority) noexcept
+  {
+    switch (priority) {
+      case MessagePriority_Low:     return "Low";
+      case MessagePriority_Normal:  return "Normal";
+      case MessagePriority_High:    return "High";
+    }
+    ZS_ASSERT_FAIL("unknown message priority");
+    return "UNDEFINED";
+  }
+
+  //---------------------------------------------------------------------------
+  const char *toString(MessageQueueOverflowPolicies policy) noexcept
+  {
+    switch (policy) {
+      case MessageQueueOverflowPolicy_Block:          return "Block";
+      case MessageQueueOverflowPolicy_Fail:           return "Fail";
+      case MessageQueueOverflowPolicy_DropOldest:     return "Drop oldest";
+      case MessageQueueOverflowPolicy_DropDroppable:  return "Drop droppable";
+    }
+    ZS_ASSERT_FAIL("unknown message queue overflow policy");
+    return "UNDEFINED";
+  }
+
+  //---------------------------------------------------------------------------
+  IMessageQueuePtr IMessageQueue::create(
+                                         IMessageQueueNotifyPtr notify,
+                                         const MessageQueueCapacity &capacity
+                                         ) noexcept
   {
-    return internal::MessageQueue::create(notify);
+    return internal::MessageQueue::create(notify, capacity);
   }
 
 } // namespace zsLib
@@ -126,12 +126,51 @@ namespace zsLib
       queue_->post(std::move(message));
     }
 
+    //-------------------------------------------------------------------------
+    void MessageQueueDispatcherForCppWinrt::postBatch(MessageList &messages) noexcept(false)
+    {
+      if (isShutdown_) {
+        ZS_THROW_CUSTOM(IMessageQueue::Exceptions::MessageQueueGone, "message posted to message queue after message queue was deleted.")
+      }
+      queue_->postBatch(messages);
+    }
+
+    //-------------------------------------------------------------------------
+    void MessageQueueDispatcherForCppWinrt::postAt(
+                                                   IMessageQueueMessageUniPtr message,
+                                                   const Time &deadline
+                                                   ) noexcept(false)
+    {
+      if (isShutdown_) {
+        ZS_THROW_CUSTOM(IMessageQueue::Exceptions::MessageQueueGone, "message posted to message queue after message queue was deleted.")
+      }
+      queue_->postAt(std::move(message), deadline);
+    }
+
     //-------------------------------------------------------------------------
     IMessageQueue::size_type MessageQueueDispatcherForCppWinrt::getTotalUnprocessedMessages() const noexcept
     {
       return queue_->getTotalUnprocessedMessages();
     }
 
+    //-------------------------------------------------------------------------
+    void MessageQueueDispatcherForCppWinrt::setCapacity(const MessageQueueCapacity &capacity) noexcept
+    {
+      queue_->setCapacity(capacity);
+    }
+
+    //-------------------------------------------------------------------------
+    MessageQueueCapacity MessageQueueDispatcherForCppWinrt::getCapacity() const noexcept
+    {
+      return queue_->getCapacity();
+    }
+
+    //-------------------------------------------------------------------------
+    MessageQueueCounters MessageQueueDispatcherForCppWinrt::getCounters() const noexcept
+    {
+      return queue_->getCounters();
+    }
+
     //-------------------------------------------------------------------------
     bool MessageQueueDispatcherForCppWinrt::isCurrentThread() const noexcept
     {
@@ -177,6 +216,12 @@ namespace zsLib
       AutoLock lock(lock_);
       priority_ = convert(threadPriority);
     }
+
+    //-------------------------------------------------------------------------
+    void MessageQueueDispatcherForCppWinrt::setThreadAffinity(const ThreadAffinity &affinity) noexcept
+    {
+      // no-op
+    }
   }
 }
 
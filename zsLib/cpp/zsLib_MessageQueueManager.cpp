@@ -137,11 +137,18 @@ namespace zsLib
     //-------------------------------------------------------------------------
     MessageQueueManagerPtr MessageQueueManager::singleton() noexcept
     {
-      AutoRecursiveLock lock(*IHelper::getGlobalLock());
-      static SingletonLazySharedPtr<MessageQueueManager> singleton(create());
-      MessageQueueManagerPtr result = singleton.singleton();
+      // the global lock is only needed while the singleton is constructed
+      static std::atomic<SingletonLazySharedPtr<MessageQueueManager> *> created {};
+      SingletonLazySharedPtr<MessageQueueManager> *holder = created.load(std::memory_order_acquire);
+      if (!holder) {
+        AutoRecursiveLock lock(*IHelper::getGlobalLock());
+        static SingletonLazySharedPtr<MessageQueueManager> singleton(create());
+        static zsLib::SingletonManager::Register registerSingleton("org.zsLib.MessageQueueManager", singleton.singleton());
+        holder = &singleton;
+        created.store(holder, std::memory_order_release);
+      }
 
-      static zsLib::SingletonManager::Register registerSingleton("org.zsLib.MessageQueueManager", result);
+      MessageQueueManagerPtr result = holder->singleton();
 
       if (!result) {
         ZS_LOG_WARNING(Detail, slog("singleton gone"))
@@ -188,10 +195,19 @@ namespace zsLib
         }
       }
 
+      MessageQueueCapacity capacity;
+
+      {
+        auto foundCapacity = mCapacities.find(name);
+        if (foundCapacity != mCapacities.end()) {
+          capacity = (*foundCapacity).second;
+        }
+      }
+
       {
         auto found = mPools.find(name);
         if (found != mPools.end()) {
-          return ((*found).second.first)->createQueue();
+          return ((*found).second.first)->createQueue(capacity);
         }
       }
 
@@ -210,9 +226,16 @@ namespace zsLib
           priority = (*foundPriority).second;
         }
 
-        ZS_LOG_TRACE(log("creating thread queue") + ZS_PARAM("name", name) + ZS_PARAM("priority", zsLib::toString(priority)))
+        ThreadAffinity affinity;
+
+        auto foundAffinity = mThreadAffinities.find(name);
+        if (foundAffinity != mThreadAffinities.end()) {
+          affinity = (*foundAffinity).second;
+        }
 
-        queue = IMessageQueueThread::createBasic(name, priority);
+        ZS_LOG_TRACE(log("creating thread queue") + ZS_PARAM("name", name) + ZS_PARAM("priority", zsLib::toString(priority)) + ZS_PARAM("affinity", affinity.toString()))
+
+        queue = IMessageQueueThread::createBasic(name, priority, affinity, capacity);
       }
 
       mQueues[name] = queue;
@@ -260,12 +283,24 @@ namespace zsLib
         }
       }
 
+      ThreadPoolScaling scaling = resolveScaling(poolName);
+
       if (!pool) {
         ZS_LOG_TRACE(log("creating thread pool") + ZS_PARAM("name", poolName));
         pool = IMessageQueueThreadPool::create();
+
+        auto foundAffinity = mThreadAffinities.find(poolName);
+        if (foundAffinity != mThreadAffinities.end()) {
+          pool->setThreadAffinity((*foundAffinity).second);
+        }
+
+        if (scaling.hasData()) {
+          ZS_LOG_TRACE(log("thread pool is elastic") + ZS_PARAM("name", poolName) + ZS_PARAM("min", scaling.mMinThreads) + ZS_PARAM("max", scaling.mMaxThreads));
+          pool->setScaling(scaling);
+        }
       }
 
-      while (totalThreadsCreated < minThreadsRequired) {
+      while ((!scaling.hasData()) && (totalThreadsCreated < minThreadsRequired)) {
         ++totalThreadsCreated;
         ZS_LOG_TRACE(log("creating pool thread") + ZS_PARAM("poolName", poolName + "." + string(totalThreadsCreated)) + ZS_PARAM("priority", zsLib::toString(priority)));
         pool->createThread((poolName + "." + string(totalThreadsCreated)).c_str(), priority);
@@ -273,7 +308,14 @@ namespace zsLib
 
       mPools[poolName] = MessageQueueThreadPoolPair(pool, totalThreadsCreated);
 
-      IMessageQueuePtr queue = pool->createQueue();
+      MessageQueueCapacity capacity;
+
+      auto foundCapacity = mCapacities.find(poolName);
+      if (foundCapacity != mCapacities.end()) {
+        capacity = (*foundCapacity).second;
+      }
+
+      IMessageQueuePtr queue = pool->createQueue(capacity);
       return queue;
     }
 
@@ -328,6 +370,106 @@ namespace zsLib
       }
     }
 
+    //-------------------------------------------------------------------------
+    void MessageQueueManager::registerMessageQueueThreadAffinity(
+                                                                 const char *assignedQueueName,
+                                                                 const ThreadAffinity &affinity
+                                                                 ) noexcept
+    {
+      ZS_DECLARE_TYPEDEF_PTR(zsLib::IMessageQueueThread, IMessageQueueThread);
+
+      AutoRecursiveLock lock(mLock);
+
+      String name(assignedQueueName);
+      mThreadAffinities[name] = affinity;
+
+      bool inUse = false;
+
+      // scope: fix existing queue thread affinity
+      {
+        auto found = mQueues.find(name);
+        if (found != mQueues.end()) {
+          ZS_LOG_DEBUG(log("updating message queue thread") + ZS_PARAM("name", name) + ZS_PARAM("affinity", affinity.toString()));
+
+          IMessageQueuePtr queue = (*found).second;
+
+          IMessageQueueThreadPtr thread = ZS_DYNAMIC_PTR_CAST(IMessageQueueThread, queue);
+          if (thread) {
+            thread->setThreadAffinity(affinity);
+            inUse = true;
+          } else {
+            ZS_LOG_WARNING(Detail, log("found thread was not recognized as a message queue thread") + ZS_PARAM("name", name));
+          }
+        }
+      }
+
+      // scope: fix existing pool queue thread affinity
+      {
+        auto found = mPools.find(name);
+        if (found != mPools.end()) {
+          ZS_LOG_DEBUG(log("updating message queue thread pool") + ZS_PARAM("name", name) + ZS_PARAM("affinity", affinity.toString()));
+
+          IMessageQueueThreadPoolPtr pool = (*found).second.first;
+
+          pool->setThreadAffinity(affinity);
+          inUse = true;
+        }
+      }
+
+      if (!inUse) {
+        ZS_LOG_DEBUG(log("message queue specified is not in use at yet") + ZS_PARAM("name", name) + ZS_PARAM("affinity", affinity.toString()));
+      }
+    }
+
+    //-------------------------------------------------------------------------
+    void MessageQueueManager::registerMessageQueueCapacity(
+                                                           const char *assignedQueueName,
+                                                           const MessageQueueCapacity &capacity
+                                                           ) noexcept
+    {
+      AutoRecursiveLock lock(mLock);
+
+      String name(assignedQueueName);
+      mCapacities[name] = capacity;
+
+      // scope: fix existing queue thread capacity
+      {
+        auto found = mQueues.find(name);
+        if (found != mQueues.end()) {
+          ZS_LOG_DEBUG(log("updating message queue capacity") + ZS_PARAM("name", name) + ZS_PARAM("max messages", capacity.mMaxMessages) + ZS_PARAM("policy", zsLib::toString(capacity.mOverflowPolicy)));
+
+          IMessageQueuePtr queue = (*found).second;
+          queue->setCapacity(capacity);
+          return;
+        }
+      }
+
+      ZS_LOG_DEBUG(log("message queue capacity registered for future queues") + ZS_PARAM("name", name) + ZS_PARAM("max messages", capacity.mMaxMessages) + ZS_PARAM("policy", zsLib::toString(capacity.mOverflowPolicy)));
+    }
+
+    //-------------------------------------------------------------------------
+    void MessageQueueManager::registerThreadPoolScaling(
+                                                        const char *assignedThreadPoolQueueName,
+                                                        const ThreadPoolScaling &scaling
+                                                        ) noexcept
+    {
+      AutoRecursiveLock lock(mLock);
+
+      String name(assignedThreadPoolQueueName);
+      mScalings[name] = scaling;
+
+      auto found = mPools.find(name);
+      if (found == mPools.end()) {
+        ZS_LOG_DEBUG(log("thread pool scaling registered for future pool") + ZS_PARAM("name", name) + ZS_PARAM("min", scaling.mMinThreads) + ZS_PARAM("max", scaling.mMaxThreads));
+        return;
+      }
+
+      ZS_LOG_DEBUG(log("updating thread pool scaling") + ZS_PARAM("name", name) + ZS_PARAM("min", scaling.mMinThreads) + ZS_PARAM("max", scaling.mMaxThreads));
+
+      IMessageQueueThreadPoolPtr pool = (*found).second.first;
+      pool->setScaling(resolveScaling(name));
+    }
+
     //-------------------------------------------------------------------------
     size_t MessageQueueManager::getTotalUnprocessedMessages() const noexcept
     {
@@ -566,6 +708,9 @@ namespace zsLib
 
       IHelper::debugAppend(resultEl, "total queues", mQueues.size());
       IHelper::debugAppend(resultEl, "total priorities", mThreadPriorities.size());
+      IHelper::debugAppend(resultEl, "total affinities", mThreadAffinities.size());
+      IHelper::debugAppend(resultEl, "total capacities", mCapacities.size());
+      IHelper::debugAppend(resultEl, "total scalings", mScalings.size());
 
       IHelper::debugAppend(resultEl, "pools", mPools.size());
 
@@ -574,6 +719,24 @@ namespace zsLib
       return resultEl;
     }
 
+    //-------------------------------------------------------------------------
+    ThreadPoolScaling MessageQueueManager::resolveScaling(const String &poolName) const noexcept
+    {
+      AutoRecursiveLock lock(mLock);
+
+      auto found = mScalings.find(poolName);
+      if (found == mScalings.end()) return ThreadPoolScaling();
+
+      ThreadPoolScaling scaling = (*found).second;
+      if (scaling.mThreadNamePrefix.isEmpty()) scaling.mThreadNamePrefix = poolName;
+
+      auto foundPriority = mThreadPriorities.find(poolName);
+      if (foundPriority != mThreadPriorities.end()) {
+        scaling.mThreadPriority = (*foundPriority).second;
+      }
+      return scaling;
+    }
+
     //-------------------------------------------------------------------------
     void MessageQueueManager::cancel() noexcept
     {
@@ -695,6 +858,39 @@ namespace zsLib
     singleton->registerMessageQueueThreadPriority(assignedQueueName, priority);
   }
 
+  //---------------------------------------------------------------------------
+  void IMessageQueueManager::registerMessageQueueThreadAffinity(
+                                                                const char *assignedQueueName,
+                                                                const ThreadAffinity &affinity
+                                                                ) noexcept
+  {
+    internal::MessageQueueManagerPtr singleton = internal::MessageQueueManager::singleton();
+    if (!singleton) return;
+    singleton->registerMessageQueueThreadAffinity(assignedQueueName, affinity);
+  }
+
+  //---------------------------------------------------------------------------
+  void IMessageQueueManager::registerMessageQueueCapacity(
+                                                          const char *assignedQueueName,
+                                                          const MessageQueueCapacity &capacity
+                                                          ) noexcept
+  {
+    internal::MessageQueueManagerPtr singleton = internal::MessageQueueManager::singleton();
+    if (!singleton) return;
+    singleton->registerMessageQueueCapacity(assignedQueueName, capacity);
+  }
+
+  //---------------------------------------------------------------------------
+  void IMessageQueueManager::registerThreadPoolScaling(
+                                                       const char *assignedThreadPoolQueueName,
+                                                       const ThreadPoolScaling &scaling
+                                                       ) noexcept
+  {
+    internal::MessageQueueManagerPtr singleton = internal::MessageQueueManager::singleton();
+    if (!singleton) return;
+    singleton->registerThreadPoolScaling(assignedThreadPoolQueueName, scaling);
+  }
+
   //---------------------------------------------------------------------------
   size_t IMessageQueueManager::getTotalUnprocessedMessages() noexcept
   {
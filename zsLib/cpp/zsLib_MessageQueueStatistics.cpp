@@ -0,0 +1,406 @@
+/*
+
+ Copyright (c) 2016, Robin Raymond
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation
+ and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ The views and conclusions contained in the software and documentation are those
+ of the authors and should not be interpreted as representing official policies,
+ either expressed or implied, of the FreeBSD Project.
+ 
+ */
+
+#include <zsLib/internal/zsLib_MessageQueueStatistics.h>
+
+#include <zsLib/IHelper.h>
+#include <zsLib/XML.h>
+
+#include <list>
+
+namespace zsLib
+{
+  namespace internal
+  {
+    ZS_DECLARE_USING_PTR(zsLib::XML, Element);
+
+    std::atomic<bool> gMessageQueueStatisticsEnabled {false};
+
+    namespace
+    {
+      typedef std::list<MessageQueueStatisticsWeakPtr> StatisticsWeakList;
+
+      //-----------------------------------------------------------------------
+      static Lock &registryLock() noexcept
+      {
+        static Lock lock;
+        return lock;
+      }
+
+      //-----------------------------------------------------------------------
+      static StatisticsWeakList &registry() noexcept
+      {
+        static StatisticsWeakList list;
+        return list;
+      }
+
+      //-----------------------------------------------------------------------
+      static void appendHistogram(
+                                  ElementPtr &parentEl,
+                                  const char *name,
+                                  const IMessageQueueStatistics::Histogram &histogram
+                                  ) noexcept
+      {
+        ElementPtr histogramEl = Element::create(name);
+
+        IHelper::debugAppend(histogramEl, "count", histogram.mCount, false);
+        IHelper::debugAppend(histogramEl, "min", histogram.mMin, false);
+        IHelper::debugAppend(histogramEl, "mean", histogram.getMean(), false);
+        IHelper::debugAppend(histogramEl, "p50", histogram.getPercentile(50.0), false);
+        IHelper::debugAppend(histogramEl, "p90", histogram.getPercentile(90.0), false);
+        IHelper::debugAppend(histogramEl, "p99", histogram.getPercentile(99.0), false);
+        IHelper::debugAppend(histogramEl, "p999", histogram.getPercentile(99.9), false);
+        IHelper::debugAppend(histogramEl, "max", histogram.mMax, false);
+
+        IHelper::debugAppend(parentEl, histogramEl);
+      }
+    }
+
+    //-------------------------------------------------------------------------
+    //-------------------------------------------------------------------------
+    //-------------------------------------------------------------------------
+    //-------------------------------------------------------------------------
+    //
+    // MessageQueueStatistics
+    //
+
+    //-------------------------------------------------------------------------
+    MessageQueueStatistics::MessageQueueStatistics(const make_private &) noexcept
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    MessageQueueStatistics::~MessageQueueStatistics() noexcept
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    MessageQueueStatisticsPtr MessageQueueStatistics::create() noexcept
+    {
+      MessageQueueStatisticsPtr pThis(make_shared<MessageQueueStatistics>(make_private{}));
+
+      AutoLock lock(registryLock());
+      auto &list = registry();
+      for (auto iter_doNotUse = list.begin(); iter_doNotUse != list.end(); ) {
+        auto current = iter_doNotUse;
+        ++iter_doNotUse;
+        if ((*current).expired()) list.erase(current);
+      }
+      list.push_back(pThis);
+      return pThis;
+    }
+
+    //-------------------------------------------------------------------------
+    void MessageQueueStatistics::setName(const char *name) noexcept
+    {
+      AutoLock lock(mLock);
+      mName = String(name);
+    }
+
+    //-------------------------------------------------------------------------
+    void MessageQueueStatistics::record(
+                                        const IMessageQueueMessage &message,
+                                        TimePoint posted,
+                                        TimePoint started,
+                                        TimePoint finished
+                                        ) noexcept
+    {
+      // messages posted before recording was enabled have no post time
+      bool hasWaitTime = (TimePoint() != posted);
+      ULONGLONG waitTime = (hasWaitTime ? toMicroseconds(posted, started) : 0);
+      ULONGLONG processingTime = toMicroseconds(started, finished);
+
+      MethodKey key(message.getDelegateName(), message.getMethodName());
+
+      AutoLock lock(mLock);
+
+      MethodEntry &entry = mMethods[key];
+      if (hasWaitTime) {
+        mWaitTime.record(waitTime);
+        entry.mWaitTime.record(waitTime);
+      }
+      mProcessingTime.record(processingTime);
+      entry.mProcessingTime.record(processingTime);
+    }
+
+    //-------------------------------------------------------------------------
+    bool MessageQueueStatistics::snapshot(
+                                          IMessageQueueStatistics::QueueStatistics &outStatistics,
+                                          bool reset
+                                          ) noexcept
+    {
+      AutoLock lock(mLock);
+      if (mMethods.size() < 1) return false;
+
+      outStatistics.mID = mID;
+      outStatistics.mName = mName;
+      outStatistics.mWaitTime = mWaitTime;
+      outStatistics.mProcessingTime = mProcessingTime;
+
+      for (auto iter = mMethods.begin(); iter != mMethods.end(); ++iter) {
+        const MethodEntry &entry = (*iter).second;
+
+        IMessageQueueStatistics::MethodStatistics method;
+        method.mDelegateName = (*iter).first.first;
+        method.mMethodName = (*iter).first.second;
+        method.mWaitTime = entry.mWaitTime;
+        method.mProcessingTime = entry.mProcessingTime;
+        outStatistics.mMethods.push_back(method);
+      }
+
+      if (reset) {
+        mWaitTime.reset();
+        mProcessingTime.reset();
+        mMethods.clear();
+      }
+      return true;
+    }
+
+    //-------------------------------------------------------------------------
+    void MessageQueueStatistics::reset() noexcept
+    {
+      AutoLock lock(mLock);
+      mWaitTime.reset();
+      mProcessingTime.reset();
+      mMethods.clear();
+    }
+
+    //-------------------------------------------------------------------------
+    ULONGLONG MessageQueueStatistics::toMicroseconds(TimePoint from, TimePoint to) noexcept
+    {
+      if (to <= from) return 0;
+      return static_cast<ULONGLONG>(std::chrono::duration_cast<std::chrono::microseconds>(to - from).count());
+    }
+
+  } // namespace internal
+
+  //---------------------------------------------------------------------------
+  //---------------------------------------------------------------------------
+  //---------------------------------------------------------------------------
+  //---------------------------------------------------------------------------
+  //
+  // IMessageQueueStatistics::Histogram
+  //
+
+  //---------------------------------------------------------------------------
+  void IMessageQueueStatistics::Histogram::record(ULONGLONG value) noexcept
+  {
+    size_t bucket = toBucket(value);
+    if (bucket >= mBuckets.size()) mBuckets.resize(bucket + 1);
+    ++(mBuckets[bucket]);
+
+    if ((0 == mCount) || (value < mMin)) mMin = value;
+    if (value > mMax) mMax = value;
+    ++mCount;
+    mTotal += value;
+  }
+
+  //---------------------------------------------------------------------------
+  void IMessageQueueStatistics::Histogram::merge(const Histogram &source) noexcept
+  {
+    if (source.mCount < 1) return;
+
+    if (source.mBuckets.size() > mBuckets.size()) mBuckets.resize(source.mBuckets.size());
+    for (size_t index = 0; index < source.mBuckets.size(); ++index) {
+      mBuckets[index] += source.mBuckets[index];
+    }
+
+    if ((0 == mCount) || (source.mMin < mMin)) mMin = source.mMin;
+    if (source.mMax > mMax) mMax = source.mMax;
+    mCount += source.mCount;
+    mTotal += source.mTotal;
+  }
+
+  //---------------------------------------------------------------------------
+  void IMessageQueueStatistics::Histogram::reset() noexcept
+  {
+    mCount = 0;
+    mTotal = 0;
+    mMin = 0;
+    mMax = 0;
+    mBuckets.clear();
+  }
+
+  //---------------------------------------------------------------------------
+  ULONGLONG IMessageQueueStatistics::Histogram::getMean() const noexcept
+  {
+    if (mCount < 1) return 0;
+    return mTotal / mCount;
+  }
+
+  //---------------------------------------------------------------------------
+  ULONGLONG IMessageQueueStatistics::Histogram::getPercentile(double percentile) const noexcept
+  {
+    if (mCount < 1) return 0;
+    if (percentile <= 0.0) return mMin;
+    if (percentile >= 100.0) return mMax;
+
+    ULONGLONG target = static_cast<ULONGLONG>((percentile / 100.0) * static_cast<double>(mCount) + 0.5);
+    if (target < 1) target = 1;
+
+    ULONGLONG seen = 0;
+    for (size_t index = 0; index < mBuckets.size(); ++index) {
+      seen += mBuckets[index];
+      if (seen < target) continue;
+
+      // report the highest value the bucket can hold, bounded by what was seen
+      ULONGLONG result = fromBucket(index + 1) - 1;
+      if (result > mMax) result = mMax;
+      if (result < mMin) result = mMin;
+      return result;
+    }
+    return mMax;
+  }
+
+  //---------------------------------------------------------------------------
+  size_t IMessageQueueStatistics::Histogram::toBucket(ULONGLONG value) noexcept
+  {
+    if (value < 16) return static_cast<size_t>(value);
+
+    size_t highestBit = 0;
+    for (ULONGLONG temp = value; temp > 1; temp >>= 1) ++highestBit;
+
+    size_t shift = highestBit - 4;
+    return 16 + (shift * 16) + static_cast<size_t>((value >> shift) & 0xF);
+  }
+
+  //---------------------------------------------------------------------------
+  ULONGLONG IMessageQueueStatistics::Histogram::fromBucket(size_t bucket) noexcept
+  {
+    if (bucket < 16) return static_cast<ULONGLONG>(bucket);
+
+    size_t shift = (bucket - 16) / 16;
+    size_t subBucket = (bucket - 16) % 16;
+    if (shift >= 60) return ULONGLONG(-1);
+    return static_cast<ULONGLONG>(16 + subBucket) << shift;
+  }
+
+  //---------------------------------------------------------------------------
+  //---------------------------------------------------------------------------
+  //---------------------------------------------------------------------------
+  //---------------------------------------------------------------------------
+  //
+  // IMessageQueueStatistics
+  //
+
+  //---------------------------------------------------------------------------
+  void IMessageQueueStatistics::enable(bool enable) noexcept
+  {
+    internal::gMessageQueueStatisticsEnabled.store(enable);
+  }
+
+  //---------------------------------------------------------------------------
+  bool IMessageQueueStatistics::isEnabled() noexcept
+  {
+    return internal::MessageQueueStatistics::isEnabled();
+  }
+
+  //---------------------------------------------------------------------------
+  IMessageQueueStatistics::QueueStatisticsList IMessageQueueStatistics::getSnapshot(bool reset) noexcept
+  {
+    std::list<internal::MessageQueueStatisticsPtr> live;
+
+    {
+      AutoLock lock(internal::registryLock());
+      auto &list = internal::registry();
+      for (auto iter_doNotUse = list.begin(); iter_doNotUse != list.end(); ) {
+        auto current = iter_doNotUse;
+        ++iter_doNotUse;
+
+        auto statistics = (*current).lock();
+        if (!statistics) {
+          list.erase(current);
+          continue;
+        }
+        live.push_back(statistics);
+      }
+    }
+
+    QueueStatisticsList result;
+    for (auto iter = live.begin(); iter != live.end(); ++iter) {
+      QueueStatistics queue;
+      if (!(*iter)->snapshot(queue, reset)) continue;
+      result.push_back(queue);
+    }
+    return result;
+  }
+
+  //---------------------------------------------------------------------------
+  void IMessageQueueStatistics::reset() noexcept
+  {
+    std::list<internal::MessageQueueStatisticsPtr> live;
+
+    {
+      AutoLock lock(internal::registryLock());
+      auto &list = internal::registry();
+      for (auto iter = list.begin(); iter != list.end(); ++iter) {
+        auto statistics = (*iter).lock();
+        if (statistics) live.push_back(statistics);
+      }
+    }
+
+    for (auto iter = live.begin(); iter != live.end(); ++iter) {
+      (*iter)->reset();
+    }
+  }
+
+  //---------------------------------------------------------------------------
+  IMessageQueueStatistics::ElementPtr IMessageQueueStatistics::toDebug(const QueueStatisticsList &statistics) noexcept
+  {
+    ElementPtr resultEl = XML::Element::create("IMessageQueueStatistics");
+
+    for (auto iter = statistics.begin(); iter != statistics.end(); ++iter) {
+      const QueueStatistics &queue = (*iter);
+
+      ElementPtr queueEl = XML::Element::create("queue");
+      IHelper::debugAppend(queueEl, "id", queue.mID);
+      IHelper::debugAppend(queueEl, "name", queue.mName);
+      internal::appendHistogram(queueEl, "wait", queue.mWaitTime);
+      internal::appendHistogram(queueEl, "processing", queue.mProcessingTime);
+
+      for (auto iterMethod = queue.mMethods.begin(); iterMethod != queue.mMethods.end(); ++iterMethod) {
+        const MethodStatistics &method = (*iterMethod);
+
+        ElementPtr methodEl = XML::Element::create("method");
+        IHelper::debugAppend(methodEl, "delegate", method.mDelegateName);
+        IHelper::debugAppend(methodEl, "method", method.mMethodName);
+        internal::appendHistogram(methodEl, "wait", method.mWaitTime);
+        internal::appendHistogram(methodEl, "processing", method.mProcessingTime);
+        IHelper::debugAppend(queueEl, methodEl);
+      }
+
+      IHelper::debugAppend(resultEl, queueEl);
+    }
+
+    return resultEl;
+  }
+
+} // namespace zsLib
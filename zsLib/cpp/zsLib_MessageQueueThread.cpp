@@ -35,7 +35,19 @@
 #include <zsLib/internal/zsLib_MessageQueueThreadUsingCurrentGUIMessageQueueForWindows.h>
 #include <zsLib/internal/zsLib_MessageQueueThreadUsingMainThreadMessageQueueForApple.h>
 #include <zsLib/internal/zsLib_MessageQueueThreadUsingBlackberryChannels.h>
+#include <zsLib/internal/platform.h>
 #include <zsLib/Log.h>
+#include <zsLib/Stringize.h>
+
+#ifdef HAVE_PTHREAD_SETAFFINITY_NP
+#include <pthread.h>
+#include <sched.h>
+#endif //HAVE_PTHREAD_SETAFFINITY_NP
+
+#ifdef HAVE_SYSFS_NUMA_TOPOLOGY
+#include <cstdio>
+#include <cstdlib>
+#endif //HAVE_SYSFS_NUMA_TOPOLOGY
 
 //namespace zsLib { ZS_DECLARE_SUBSYSTEM(zslib) }
 
@@ -154,6 +166,118 @@ namespace zsLib
       return gPriorities;
     }
 
+#ifdef HAVE_SYSFS_NUMA_TOPOLOGY
+    //-------------------------------------------------------------------------
+    static bool readNUMANodeProcessors(
+                                       int numaNode,
+                                       ThreadAffinity::ProcessorSet &outProcessors
+                                       ) noexcept
+    {
+      // e.g. "0-7,16-23"
+      char path[128] {};
+      snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist", numaNode);
+
+      FILE *file = fopen(path, "r");
+      if (!file) return false;
+
+      char buffer[1024] {};
+      size_t read = fread(buffer, 1, sizeof(buffer) - 1, file);
+      fclose(file);
+      buffer[read] = 0;
+
+      const char *pos = buffer;
+      while (('\0' != *pos) && ('\n' != *pos)) {
+        char *end = NULL;
+        unsigned long first = strtoul(pos, &end, 10);
+        if (end == pos) break;
+        unsigned long last = first;
+        pos = end;
+        if ('-' == *pos) {
+          ++pos;
+          last = strtoul(pos, &end, 10);
+          if (end == pos) break;
+          pos = end;
+        }
+        for (unsigned long processor = first; processor <= last; ++processor) {
+          outProcessors.insert(static_cast<size_t>(processor));
+        }
+        if (',' == *pos) ++pos;
+      }
+      return true;
+    }
+#endif //HAVE_SYSFS_NUMA_TOPOLOGY
+
+#if defined(HAVE_PTHREAD_SETAFFINITY_NP)
+    //-------------------------------------------------------------------------
+    static const cpu_set_t &processAffinity() noexcept
+    {
+      // the processors the process was allowed to use when it started (e.g.
+      // as restricted by taskset), which unrestricted threads return to
+      static const cpu_set_t gProcessCPUs = []() -> cpu_set_t {
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        if (0 == sched_getaffinity(0, sizeof(cpus), &cpus)) return cpus;
+
+        CPU_ZERO(&cpus);
+        size_t total = zsLib::getTotalProcessors();
+        for (size_t processor = 0; (processor < total) && (processor < CPU_SETSIZE); ++processor) {
+          CPU_SET(processor, &cpus);
+        }
+        return cpus;
+      }();
+      return gProcessCPUs;
+    }
+
+    // captured during static initialization, before any thread is pinned
+    static const cpu_set_t &gProcessAffinityCaptured = processAffinity();
+#endif //HAVE_PTHREAD_SETAFFINITY_NP
+
+    //-------------------------------------------------------------------------
+    bool setThreadAffinity(
+                           ZS_MAYBE_USED() Thread::native_handle_type handle,
+                           ZS_MAYBE_USED() const ThreadAffinity &affinity
+                           ) noexcept
+    {
+      ZS_MAYBE_USED(handle);
+      ZS_MAYBE_USED(affinity);
+
+      ThreadAffinity::ProcessorSet processors = affinity.resolve();
+
+#if defined(HAVE_PTHREAD_SETAFFINITY_NP)
+      cpu_set_t cpus;
+      CPU_ZERO(&cpus);
+
+      if (processors.size() < 1) {
+        // unrestricted: return to the process wide affinity
+        cpus = processAffinity();
+      } else {
+        for (auto iter = processors.begin(); iter != processors.end(); ++iter) {
+          if ((*iter) >= CPU_SETSIZE) continue;
+          CPU_SET((*iter), &cpus);
+        }
+        if (0 == CPU_COUNT(&cpus)) return false;
+      }
+      return 0 == pthread_setaffinity_np(handle, sizeof(cpus), &cpus);
+#elif defined(HAVE_WIN32_THREAD_AFFINITY)
+      DWORD_PTR mask = 0;
+      if (processors.size() < 1) {
+        DWORD_PTR systemMask = 0;
+        DWORD_PTR processMask = 0;
+        if (!GetProcessAffinityMask(GetCurrentProcess(), &processMask, &systemMask)) return false;
+        mask = processMask;
+      } else {
+        for (auto iter = processors.begin(); iter != processors.end(); ++iter) {
+          if ((*iter) >= (sizeof(DWORD_PTR) * 8)) continue;   // only the first processor group is addressable
+          mask |= (static_cast<DWORD_PTR>(1) << (*iter));
+        }
+      }
+      if (0 == mask) return false;
+      return 0 != SetThreadAffinityMask(handle, mask);
+#else
+      return false;
+#endif //HAVE_PTHREAD_SETAFFINITY_NP
+    }
+
     //-------------------------------------------------------------------------
     //-------------------------------------------------------------------------
     //-------------------------------------------------------------------------
@@ -163,9 +287,14 @@ namespace zsLib
     //
 
     //-------------------------------------------------------------------------
-    MessageQueueThreadPtr MessageQueueThread::createBasic(const char *threadName, ThreadPriorities threadPriority) noexcept
+    MessageQueueThreadPtr MessageQueueThread::createBasic(
+                                                          const char *threadName,
+                                                          ThreadPriorities threadPriority,
+                                                          const ThreadAffinity &affinity,
+                                                          const MessageQueueCapacity &capacity
+                                                          ) noexcept
     {
-      return internal::MessageQueueThreadBasic::create(threadName, threadPriority);
+      return internal::MessageQueueThreadBasic::create(threadName, threadPriority, affinity, capacity);
     }
 
     //-------------------------------------------------------------------------
@@ -248,6 +377,117 @@ namespace zsLib
     internal::setThreadPriority(thread.native_handle(), threadPriority);
   }
 
+  //---------------------------------------------------------------------------
+  //---------------------------------------------------------------------------
+  //---------------------------------------------------------------------------
+  //---------------------------------------------------------------------------
+  //
+  // ThreadAffinity
+  //
+
+  //---------------------------------------------------------------------------
+  ThreadAffinity ThreadAffinity::forProcessor(size_t processor) noexcept
+  {
+    ThreadAffinity result;
+    result.mProcessors.insert(processor);
+    return result;
+  }
+
+  //---------------------------------------------------------------------------
+  ThreadAffinity ThreadAffinity::forNUMANode(
+                                             int numaNode,
+                                             bool pinEachThread
+                                             ) noexcept
+  {
+    ThreadAffinity result;
+    result.mNUMANode = numaNode;
+    result.mPinEachThread = pinEachThread;
+    return result;
+  }
+
+  //---------------------------------------------------------------------------
+  ThreadAffinity::ProcessorSet ThreadAffinity::resolve() const noexcept
+  {
+    if (mProcessors.size() > 0) return mProcessors;
+    if (mNUMANode < 0) return ProcessorSet();
+    return getNUMANodeProcessors(mNUMANode);
+  }
+
+  //---------------------------------------------------------------------------
+  String ThreadAffinity::toString() const noexcept
+  {
+    String result;
+    for (auto iter = mProcessors.begin(); iter != mProcessors.end(); ++iter) {
+      result += (result.hasData() ? "," : "") + string(*iter);
+    }
+    if (mNUMANode >= 0) result += String(result.hasData() ? " " : "") + "node=" + string(mNUMANode);
+    if (mPinEachThread) result += String(result.hasData() ? " " : "") + "pinned";
+    return result.hasData() ? result : String("any");
+  }
+
+  //---------------------------------------------------------------------------
+  bool setThreadAffinity(
+                         Thread &thread,
+                         const ThreadAffinity &affinity
+                         ) noexcept
+  {
+    return internal::setThreadAffinity(thread.native_handle(), affinity);
+  }
+
+  //---------------------------------------------------------------------------
+  size_t getTotalProcessors() noexcept
+  {
+    size_t result = static_cast<size_t>(std::thread::hardware_concurrency());
+    return (result < 1 ? 1 : result);
+  }
+
+  //---------------------------------------------------------------------------
+  size_t getTotalNUMANodes() noexcept
+  {
+#if defined(HAVE_SYSFS_NUMA_TOPOLOGY)
+    size_t total = 0;
+    while (true) {
+      ThreadAffinity::ProcessorSet ignored;
+      if (!internal::readNUMANodeProcessors(static_cast<int>(total), ignored)) break;
+      ++total;
+    }
+    return (total < 1 ? 1 : total);
+#elif defined(HAVE_WIN32_THREAD_AFFINITY)
+    ULONG highest = 0;
+    if (!GetNumaHighestNodeNumber(&highest)) return 1;
+    return static_cast<size_t>(highest) + 1;
+#else
+    return 1;
+#endif //HAVE_SYSFS_NUMA_TOPOLOGY
+  }
+
+  //---------------------------------------------------------------------------
+  ThreadAffinity::ProcessorSet getNUMANodeProcessors(int numaNode) noexcept
+  {
+    ThreadAffinity::ProcessorSet result;
+    if (numaNode < 0) return result;
+
+#if defined(HAVE_SYSFS_NUMA_TOPOLOGY)
+    if (internal::readNUMANodeProcessors(numaNode, result)) return result;
+#elif defined(HAVE_WIN32_THREAD_AFFINITY)
+    ULONGLONG mask = 0;
+    if (GetNumaNodeProcessorMask(static_cast<UCHAR>(numaNode), &mask)) {
+      for (size_t processor = 0; processor < (sizeof(mask) * 8); ++processor) {
+        if (0 != (mask & (static_cast<ULONGLONG>(1) << processor))) result.insert(processor);
+      }
+      return result;
+    }
+#endif //HAVE_SYSFS_NUMA_TOPOLOGY
+
+    // no topology information means everything is one node
+    if (0 != numaNode) return result;
+    size_t total = getTotalProcessors();
+    for (size_t processor = 0; processor < total; ++processor) {
+      result.insert(processor);
+    }
+    return result;
+  }
+
   //---------------------------------------------------------------------------
   //---------------------------------------------------------------------------
   //---------------------------------------------------------------------------
@@ -259,10 +499,12 @@ namespace zsLib
   //---------------------------------------------------------------------------
   IMessageQueueThreadPtr IMessageQueueThread::createBasic(
                                                           const char *threadName,
-                                                          ThreadPriorities threadPriority
+                                                          ThreadPriorities threadPriority,
+                                                          const ThreadAffinity &affinity,
+                                                          const MessageQueueCapacity &capacity
                                                           ) noexcept
   {
-    return internal::MessageQueueThread::createBasic(threadName, threadPriority);
+    return internal::MessageQueueThread::createBasic(threadName, threadPriority, affinity, capacity);
   }
 
   //---------------------------------------------------------------------------
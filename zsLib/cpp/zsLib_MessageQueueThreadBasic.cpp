@@ -42,14 +42,22 @@ namespace zsLib
   namespace internal
   {
     //-------------------------------------------------------------------------
-    MessageQueueThreadBasicPtr MessageQueueThreadBasic::create(const char *threadName, ThreadPriorities threadPriority) noexcept
+    MessageQueueThreadBasicPtr MessageQueueThreadBasic::create(
+                                                               const char *threadName,
+                                                               ThreadPriorities threadPriority,
+                                                               const ThreadAffinity &affinity,
+                                                               const MessageQueueCapacity &capacity
+                                                               ) noexcept
     {
       MessageQueueThreadBasicPtr thread(new MessageQueueThreadBasic(threadName));
-      thread->mQueue = MessageQueue::create(thread);
+      thread->mQueue = MessageQueue::create(thread, capacity);
+      if (threadName) thread->mQueue->setName(threadName);
       thread->mThreadPriority = threadPriority;
+      thread->mThreadAffinity = affinity;
       thread->mThread = ThreadPtr(new std::thread(std::ref(*thread.get())));
 
       zsLib::setThreadPriority(*(thread->mThread), threadPriority);
+      if (affinity.hasData()) zsLib::setThreadAffinity(*(thread->mThread), affinity);
       return thread;
     }
 
@@ -79,7 +87,13 @@ namespace zsLib
         shouldShutdown = mMustShutdown;
 
         if (!shouldShutdown) {
-          mEvent.wait();    // wait for the next event to arrive
+          // wait for the next event to arrive (or the earliest delayed message to become due)
+          Time deadline = queue->getNextDeadline();
+          if (Time() == deadline) {
+            mEvent.wait();
+          } else {
+            mEvent.waitUntil(deadline);
+          }
           queue->process(); // process data in case shutdown gets activated
         }
 
@@ -103,6 +117,27 @@ namespace zsLib
       mQueue->post(std::move(message));
     }
 
+    //-------------------------------------------------------------------------
+    void MessageQueueThreadBasic::postBatch(MessageList &messages) noexcept(false)
+    {
+      if (mIsShutdown) {
+        ZS_THROW_CUSTOM(IMessageQueue::Exceptions::MessageQueueGone, "message posted to message queue after message queue was deleted.");
+      }
+      mQueue->postBatch(messages);
+    }
+
+    //-------------------------------------------------------------------------
+    void MessageQueueThreadBasic::postAt(
+                                         IMessageQueueMessageUniPtr message,
+                                         const Time &deadline
+                                         ) noexcept(false)
+    {
+      if (mIsShutdown) {
+        ZS_THROW_CUSTOM(IMessageQueue::Exceptions::MessageQueueGone, "message posted to message queue after message queue was deleted.");
+      }
+      mQueue->postAt(std::move(message), deadline);
+    }
+
     //-------------------------------------------------------------------------
     IMessageQueue::size_type MessageQueueThreadBasic::getTotalUnprocessedMessages() const noexcept
     {
@@ -111,6 +146,30 @@ namespace zsLib
       return mQueue->getTotalUnprocessedMessages();
     }
 
+    //-------------------------------------------------------------------------
+    void MessageQueueThreadBasic::setCapacity(const MessageQueueCapacity &capacity) noexcept
+    {
+      AutoLock lock(mLock);
+      if (!mQueue) return;
+      mQueue->setCapacity(capacity);
+    }
+
+    //-------------------------------------------------------------------------
+    MessageQueueCapacity MessageQueueThreadBasic::getCapacity() const noexcept
+    {
+      AutoLock lock(mLock);
+      if (!mQueue) return MessageQueueCapacity();
+      return mQueue->getCapacity();
+    }
+
+    //-------------------------------------------------------------------------
+    MessageQueueCounters MessageQueueThreadBasic::getCounters() const noexcept
+    {
+      AutoLock lock(mLock);
+      if (!mQueue) return MessageQueueCounters();
+      return mQueue->getCounters();
+    }
+
     //-------------------------------------------------------------------------
     bool MessageQueueThreadBasic::isCurrentThread() const noexcept
     {
@@ -126,18 +185,30 @@ namespace zsLib
       mEvent.notify();
     }
 
+    //-------------------------------------------------------------------------
+    bool MessageQueueThreadBasic::notifyMessageScheduled(const Time &deadline) noexcept
+    {
+      mEvent.notify();    // the thread picks up the new deadline before waiting again
+      return true;
+    }
+
     //-------------------------------------------------------------------------
     void MessageQueueThreadBasic::waitForShutdown() noexcept
     {
       ThreadPtr thread;
+      MessageQueuePtr queue;
       {
         AutoLock lock(mLock);
         thread = mThread;
+        queue = mQueue;
 
         mMustShutdown = true;
         mEvent.notify();
       }
 
+      // producers blocked on a full queue must not outlive the thread draining it
+      if (queue) queue->setCapacity(MessageQueueCapacity());
+
       if (!thread)
         return;
 
@@ -162,6 +233,19 @@ namespace zsLib
       zsLib::setThreadPriority(*mThread, threadPriority);
     }
 
+    //-------------------------------------------------------------------------
+    void MessageQueueThreadBasic::setThreadAffinity(const ThreadAffinity &affinity) noexcept
+    {
+      AutoLock lock(mLock);
+      if (!mThread) return;
+
+      if (affinity == mThreadAffinity) return;
+
+      mThreadAffinity = affinity;
+
+      zsLib::setThreadAffinity(*mThread, affinity);
+    }
+
     //-------------------------------------------------------------------------
     void MessageQueueThreadBasic::processMessagesFromThread() noexcept
     {
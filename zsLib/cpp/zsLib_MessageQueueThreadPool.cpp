@@ -34,6 +34,9 @@
 
 #include <zsLib/Event.h>
 #include <zsLib/Log.h>
+#include <zsLib/helpers.h>
+
+#include <algorithm>
 
 //namespace zsLib { ZS_DECLARE_SUBSYSTEM(zslib) }
 
@@ -69,22 +72,27 @@ namespace zsLib
       static MessageQueueThreadPoolDispatcherThreadPtr create(
         MessageQueueThreadPoolPtr pool,
         const char *threadName = NULL,
-        ThreadPriorities threadPriority = ThreadPriority_Normal
+        ThreadPriorities threadPriority = ThreadPriority_Normal,
+        const ThreadAffinity &affinity = ThreadAffinity()
       )
       {
         MessageQueueThreadPoolDispatcherThreadPtr pThis(new MessageQueueThreadPoolDispatcherThread(make_private{}, threadName));
         pThis->mThisWeak = pThis;
         pThis->mPool = pool;
         pThis->mThreadPriority = threadPriority;
+        pThis->mThreadAffinity = affinity;
         pThis->mThread = ThreadPtr(new std::thread(std::ref(*pThis.get())));
 
         zsLib::setThreadPriority(*(pThis->mThread), threadPriority);
+        if (affinity.hasData()) zsLib::setThreadAffinity(*(pThis->mThread), affinity);
         return pThis;
       }
 
       //-----------------------------------------------------------------------
       void operator () ()
       {
+        MessageQueueThreadPoolDispatcherThreadPtr retiredSelf;    // a retired dispatcher stays alive until its thread exits
+
         debugSetCurrentThreadName(mThreadName);
 
         do
@@ -92,14 +100,35 @@ namespace zsLib
           if (mMustShutdown) goto done;
 
           {
-            auto pool = mPool.lock();
-            if (!pool) goto done;
-
-            pool->notifyIdle(mThisWeak.lock());
+            Time deadline;
+
+            {
+              auto pool = mPool.lock();
+              if (!pool) goto done;
+
+              deadline = pool->notifyIdle(mThisWeak.lock());
+            }
+
+            if (Time() == deadline) {
+              mEvent.wait();
+            } else if (!mEvent.waitUntil(deadline)) {
+              auto pool = mPool.lock();
+              if (!pool) goto done;
+
+              auto self = mThisWeak.lock();
+              auto result = pool->notifyDeadlineReached(self);
+              if (MessageQueueThreadPool::DeadlineResult_Rewait == result) continue;
+              if (MessageQueueThreadPool::DeadlineResult_Retire == result) {
+                retiredSelf = self;
+                retire();
+                goto done;
+              }
+
+              // this thread was handed work just as the deadline passed
+              mEvent.wait();
+            }
           }
 
-          mEvent.wait();
-
           {
             auto pool = mPool.lock();
             if (!pool) goto done;
@@ -139,6 +168,20 @@ namespace zsLib
         }
       }
 
+      //-----------------------------------------------------------------------
+      void retire()
+      {
+        AutoLock lock(mLock);
+        if (mMustShutdown) return;    // already being joined by waitForShutdown
+
+        mMustShutdown = true;
+        if (!mThread) return;
+
+        // the pool no longer tracks this dispatcher so nobody will join it
+        mThread->detach();
+        mThread.reset();
+      }
+
       //-------------------------------------------------------------------------
       void setThreadPriority(ThreadPriorities threadPriority)
       {
@@ -152,6 +195,19 @@ namespace zsLib
         zsLib::setThreadPriority(*mThread, threadPriority);
       }
 
+      //-------------------------------------------------------------------------
+      void setThreadAffinity(const ThreadAffinity &affinity)
+      {
+        AutoLock lock(mLock);
+        if (!mThread) return;
+
+        if (affinity == mThreadAffinity) return;
+
+        mThreadAffinity = affinity;
+
+        zsLib::setThreadAffinity(*mThread, affinity);
+      }
+
       //-----------------------------------------------------------------------
       void notify()
       {
@@ -178,6 +234,7 @@ namespace zsLib
       mutable Lock mLock;
       std::atomic_bool mMustShutdown{};
       ThreadPriorities mThreadPriority{ ThreadPriority_Normal };
+      ThreadAffinity mThreadAffinity;
 
       std::atomic_bool mIsShutdown{};
 
@@ -213,10 +270,13 @@ namespace zsLib
 
     public:
       //-----------------------------------------------------------------------
-      static MessageQueueThreadPoolQueueNotifierPtr create(MessageQueueThreadPoolPtr pool) noexcept  {
+      static MessageQueueThreadPoolQueueNotifierPtr create(
+                                                           MessageQueueThreadPoolPtr pool,
+                                                           const MessageQueueCapacity &capacity
+                                                           ) noexcept  {
         MessageQueueThreadPoolQueueNotifierPtr pThis(make_shared<MessageQueueThreadPoolQueueNotifier>(make_private{}, pool));
         pThis->mThisWeak = pThis;
-        pThis->init();
+        pThis->init(capacity);
         return pThis;
       }
 
@@ -239,6 +299,10 @@ namespace zsLib
         mPosted.exchange(false);
 
         if (!queue) return;
+
+        Time deadline = queue->getNextDeadline();
+        if (Time() != deadline) mPool->notifyDeadline(mThisWeak.lock(), deadline);
+
         if (queue->getTotalUnprocessedMessages() < 1) return;
 
         notifyMessagePosted();
@@ -246,9 +310,9 @@ namespace zsLib
 
     protected:
       //-----------------------------------------------------------------------
-      void init() noexcept
+      void init(const MessageQueueCapacity &capacity) noexcept
       {
-        mQueue = MessageQueue::create(mThisWeak.lock());
+        mQueue = MessageQueue::create(mThisWeak.lock(), capacity);
         mQueueWeak = mQueue;
       }
 
@@ -260,9 +324,13 @@ namespace zsLib
       //-----------------------------------------------------------------------
       void notifyMessagePosted() noexcept override;
 
+      bool notifyMessageScheduled(const Time &deadline) noexcept override;
+
       bool isCurrentThread() const noexcept override;
 
     protected:
+      friend class MessageQueueThreadPool;
+
       MessageQueueThreadPoolQueueNotifierWeakPtr mThisWeak;
 
       MessageQueuePtr mQueue;
@@ -271,6 +339,8 @@ namespace zsLib
       MessageQueueThreadPoolPtr mPool;
 
       std::atomic<bool> mPosted{ false };
+
+      Time mScheduledDeadline;    // protected by the pool's lock
     };
 
     //-------------------------------------------------------------------------
@@ -282,6 +352,13 @@ namespace zsLib
       mPool->notifyPosted(mThisWeak.lock());
     }
 
+    //-------------------------------------------------------------------------
+    bool MessageQueueThreadPoolQueueNotifier::notifyMessageScheduled(const Time &deadline) noexcept
+    {
+      mPool->notifyDeadline(mThisWeak.lock(), deadline);
+      return true;
+    }
+
     //-------------------------------------------------------------------------
     bool MessageQueueThreadPoolQueueNotifier::isCurrentThread() const noexcept
     {
@@ -320,13 +397,22 @@ namespace zsLib
         AutoLock lock(mLock);
         mPendingQueues.push(queue);
 
-        if (mIdleThreads.size() < 1) {
+        if (mIdleThreads.size() > 0) {
+          idle = mIdleThreads.back();
+          mIdleThreads.pop_back();
+        } else if (mTimekeeper) {
+          idle = mTimekeeper;
+          mTimekeeper.reset();
+        } else {
+          if ((0 == mMissingIdle) && (mScaling.hasData())) mBacklogSince = zsLib::now();
           ++mMissingIdle;
-          return;
+          if (!shouldGrow()) return;
         }
+      }
 
-        idle = mIdleThreads.front();
-        mIdleThreads.pop();
+      if (!idle) {
+        addElasticThread();
+        return;
       }
 
       idle->notify();
@@ -347,25 +433,117 @@ namespace zsLib
     }
 
     //-------------------------------------------------------------------------
-    void MessageQueueThreadPool::notifyIdle(MessageQueueThreadPoolDispatcherThreadPtr dispatcher) noexcept
+    Time MessageQueueThreadPool::notifyIdle(MessageQueueThreadPoolDispatcherThreadPtr dispatcher) noexcept
     {
       {
         AutoLock lock(mLock);
 
         if (mMissingIdle < 1) {
-          mIdleThreads.push(dispatcher);
-          return;
+          // one idle thread waits on the earliest deadline on behalf of the pool
+          if ((!mTimekeeper) && (mDeadlines.size() > 0)) {
+            mTimekeeper = dispatcher;
+            return mDeadlines.front().mDeadline;
+          }
+          mIdleThreads.push_back(dispatcher);
+
+          // surplus dispatchers wait for work only so long before retiring
+          if ((mScaling.hasData()) && (mThreads.size() > mScaling.mMinThreads)) return zsLib::now() + mScaling.mIdleTimeout;
+          return Time();
         }
         --mMissingIdle;
+        if ((mMissingIdle > 0) && (mScaling.hasData())) mBacklogSince = zsLib::now();
       }
 
       dispatcher->notify();
+      return Time();
+    }
+
+    //-------------------------------------------------------------------------
+    void MessageQueueThreadPool::notifyDeadline(
+                                                MessageQueueThreadPoolQueueNotifierPtr queue,
+                                                const Time &deadline
+                                                ) noexcept
+    {
+      MessageQueueThreadPoolDispatcherThreadPtr wake;
+
+      {
+        AutoLock lock(mLock);
+
+        if ((Time() != queue->mScheduledDeadline) && (queue->mScheduledDeadline <= deadline)) return;
+        queue->mScheduledDeadline = deadline;
+
+        mDeadlines.push_back(QueueDeadline {deadline, queue});
+        std::push_heap(mDeadlines.begin(), mDeadlines.end());
+
+        if (mDeadlines.front().mNotifier != queue) return;
+        if (mDeadlines.front().mDeadline != deadline) return;
+
+        // the earliest deadline changed so an idle thread must (re)start waiting on it
+        if (mTimekeeper) {
+          wake = mTimekeeper;
+          mTimekeeper.reset();
+        } else if (mIdleThreads.size() > 0) {
+          wake = mIdleThreads.back();
+          mIdleThreads.pop_back();
+        } else {
+          return;
+        }
+      }
+
+      wake->notify();
+    }
+
+    //-------------------------------------------------------------------------
+    MessageQueueThreadPool::DeadlineResults MessageQueueThreadPool::notifyDeadlineReached(MessageQueueThreadPoolDispatcherThreadPtr dispatcher) noexcept
+    {
+      std::list<MessageQueueThreadPoolQueueNotifierPtr> due;
+      DeadlineResults result = DeadlineResult_Rewait;
+
+      {
+        AutoLock lock(mLock);
+
+        if (mTimekeeper == dispatcher) {
+          mTimekeeper.reset();
+        } else {
+          auto found = std::find(mIdleThreads.begin(), mIdleThreads.end(), dispatcher);
+          if (found == mIdleThreads.end()) {
+            result = DeadlineResult_HandedWork;
+          } else {
+            // an idle dispatcher reached its idle timeout
+            mIdleThreads.erase(found);
+            if ((mScaling.hasData()) && (mThreads.size() > mScaling.mMinThreads)) {
+              mThreads.remove(dispatcher);
+              ++mScalingCounters.mRetired;
+              result = DeadlineResult_Retire;
+            }
+          }
+        }
+
+        Time now = zsLib::now();
+        while ((mDeadlines.size() > 0) && (mDeadlines.front().mDeadline <= now)) {
+          std::pop_heap(mDeadlines.begin(), mDeadlines.end());
+          QueueDeadline entry = mDeadlines.back();
+          mDeadlines.pop_back();
+
+          // a later deadline replaced by an earlier one is stale
+          if (entry.mNotifier->mScheduledDeadline != entry.mDeadline) continue;
+          entry.mNotifier->mScheduledDeadline = Time();
+          due.push_back(entry.mNotifier);
+        }
+      }
+
+      for (auto iter = due.begin(); iter != due.end(); ++iter) {
+        (*iter)->notifyMessagePosted();
+      }
+
+      return result;
     }
 
     //-------------------------------------------------------------------------
     void MessageQueueThreadPool::processOneQueue() noexcept
     {
       MessageQueueThreadPoolQueueNotifierPtr notifier;
+      bool grow = false;
 
       {
         AutoLock lock(mLock);
@@ -374,11 +552,75 @@ namespace zsLib
 
         notifier = mPendingQueues.front();
         mPendingQueues.pop();
+
+        // queues left waiting while every dispatcher stays busy
+        if (mMissingIdle > 0) grow = shouldGrow();
       }
 
+      if (grow) addElasticThread();
+
       notifier->processQueue();
     }
 
+    //-------------------------------------------------------------------------
+    ThreadAffinity MessageQueueThreadPool::nextThreadAffinity(const ThreadAffinity &affinity) noexcept
+    {
+      if (!affinity.mPinEachThread) return affinity;
+
+      ThreadAffinity::ProcessorSet processors = affinity.resolve();
+      if (processors.size() < 1) return affinity;
+
+      // one dispatcher per processor (wrapping around when there are more threads than processors)
+      auto iter = processors.begin();
+      std::advance(iter, (mNextProcessor % processors.size()));
+      ++mNextProcessor;
+
+      ThreadAffinity result = ThreadAffinity::forProcessor(*iter);
+      result.mNUMANode = affinity.mNUMANode;
+      return result;
+    }
+
+    //-------------------------------------------------------------------------
+    bool MessageQueueThreadPool::shouldGrow() noexcept
+    {
+      if (!mScaling.hasData()) return false;
+      if (mMissingIdle < 1) return false;
+
+      Time now = zsLib::now();
+      if ((mMissingIdle < mScaling.mGrowBacklog) &&
+          ((now - mBacklogSince) < mScaling.mGrowWaitTime)) return false;
+
+      // hysteresis: the new dispatcher gets a chance to drain the backlog first
+      if (((mThreads.size() + mThreadsStarting) >= mScaling.mMaxThreads) ||
+          ((now - mLastGrow) < mScaling.mGrowInterval)) {
+        ++mScalingCounters.mGrowDeferred;
+        return false;
+      }
+
+      mLastGrow = now;
+      ++mThreadsStarting;
+      ++mScalingCounters.mGrown;
+      return true;
+    }
+
+    //-------------------------------------------------------------------------
+    void MessageQueueThreadPool::addElasticThread() noexcept
+    {
+      String threadName;
+      ThreadPriorities threadPriority {ThreadPriority_Normal};
+
+      {
+        AutoLock lock(mLock);
+        threadName = mScaling.mThreadNamePrefix + ".elastic." + string(++mElasticThreadIndex);
+        threadPriority = mScaling.mThreadPriority;
+      }
+
+      createThread(threadName.c_str(), threadPriority);
+
+      AutoLock lock(mLock);
+      --mThreadsStarting;
+    }
+
     //-------------------------------------------------------------------------
     MessageQueueThreadPoolPtr MessageQueueThreadPool::create() noexcept
     {
@@ -391,18 +633,32 @@ namespace zsLib
     //-------------------------------------------------------------------------
     void MessageQueueThreadPool::createThread(
       const char *threadName,
-      ThreadPriorities threadPriority
+      ThreadPriorities threadPriority,
+      const ThreadAffinity &affinity
     ) noexcept
     {
-      MessageQueueThreadPoolDispatcherThreadPtr dispatcher = MessageQueueThreadPoolDispatcherThread::create(mThisWeak.lock(), threadName, threadPriority);
+      ThreadAffinity threadAffinity;
+
+      {
+        AutoLock lock(mLock);
+        threadAffinity = nextThreadAffinity(affinity.hasData() ? affinity : mThreadAffinity);
+      }
+
+      MessageQueueThreadPoolDispatcherThreadPtr dispatcher = MessageQueueThreadPoolDispatcherThread::create(mThisWeak.lock(), threadName, threadPriority, threadAffinity);
 
       AutoLock lock(mLock);
       mThreads.push_back(dispatcher);
+      if (mThreads.size() > mScalingCounters.mPeakThreads) mScalingCounters.mPeakThreads = mThreads.size();
     }
 
     //-------------------------------------------------------------------------
     void MessageQueueThreadPool::waitForShutdown() noexcept
     {
+      {
+        AutoLock lock(mLock);
+        mScaling = ThreadPoolScaling();   // no dispatchers are added while shutting down
+      }
+
       while (true)
       {
         DispatcherThreadList threads;
@@ -413,7 +669,7 @@ namespace zsLib
           mThreads.clear();
         }
 
-        if (threads.size() < 1) return;
+        if (threads.size() < 1) break;
 
         for (auto iter = threads.begin(); iter != threads.end(); ++iter) {
           auto thread = (*iter);
@@ -421,6 +677,11 @@ namespace zsLib
           thread->waitForShutdown();
         }
       }
+
+      // delayed messages still waiting are never processed once the threads are gone
+      AutoLock lock(mLock);
+      mDeadlines.clear();
+      mTimekeeper.reset();
     }
 
     //-------------------------------------------------------------------------
@@ -442,6 +703,79 @@ namespace zsLib
       }
     }
 
+    //-------------------------------------------------------------------------
+    void MessageQueueThreadPool::setThreadAffinity(const ThreadAffinity &affinity) noexcept
+    {
+      DispatcherThreadList threads;
+
+      {
+        AutoLock lock(mLock);
+        mThreadAffinity = affinity;
+        mNextProcessor = 0;
+        threads = mThreads;
+      }
+
+      for (auto iter = threads.begin(); iter != threads.end(); ++iter) {
+        auto thread = (*iter);
+
+        ThreadAffinity threadAffinity;
+        {
+          AutoLock lock(mLock);
+          threadAffinity = nextThreadAffinity(affinity);
+        }
+        thread->setThreadAffinity(threadAffinity);
+      }
+    }
+
+    //-------------------------------------------------------------------------
+    void MessageQueueThreadPool::setScaling(const ThreadPoolScaling &scaling) noexcept
+    {
+      DispatcherThreadList idleThreads;
+      size_t missing = 0;
+
+      {
+        AutoLock lock(mLock);
+        mScaling = scaling;
+        if (!mScaling.hasData()) return;
+
+        if (mScaling.mThreadNamePrefix.isEmpty()) mScaling.mThreadNamePrefix = "zsLib.threadPool";
+        if (mScaling.mMaxThreads < mScaling.mMinThreads) mScaling.mMaxThreads = mScaling.mMinThreads;
+
+        size_t current = mThreads.size() + mThreadsStarting;
+        if (current < mScaling.mMinThreads) {
+          missing = mScaling.mMinThreads - current;
+          mThreadsStarting += missing;
+        }
+
+        // idle dispatchers start waiting again with the new idle timeout
+        idleThreads.swap(mIdleThreads);
+      }
+
+      for (auto iter = idleThreads.begin(); iter != idleThreads.end(); ++iter) {
+        (*iter)->notify();
+      }
+
+      for (size_t index = 0; index < missing; ++index) {
+        addElasticThread();
+      }
+    }
+
+    //-------------------------------------------------------------------------
+    ThreadPoolScaling MessageQueueThreadPool::getScaling() const noexcept
+    {
+      AutoLock lock(mLock);
+      return mScaling;
+    }
+
+    //-------------------------------------------------------------------------
+    ThreadPoolScalingCounters MessageQueueThreadPool::getScalingCounters() const noexcept
+    {
+      AutoLock lock(mLock);
+      ThreadPoolScalingCounters result = mScalingCounters;
+      result.mThreads = mThreads.size();
+      return result;
+    }
+
     //-------------------------------------------------------------------------
     bool MessageQueueThreadPool::hasPendingMessages() noexcept
     {
@@ -450,14 +784,26 @@ namespace zsLib
     }
 
     //-------------------------------------------------------------------------
-    IMessageQueuePtr MessageQueueThreadPool::createQueue() noexcept
+    IMessageQueuePtr MessageQueueThreadPool::createQueue(const MessageQueueCapacity &capacity) noexcept
     {
-      MessageQueueThreadPoolQueueNotifierPtr notifier = MessageQueueThreadPoolQueueNotifier::create(mThisWeak.lock());
+      MessageQueueThreadPoolQueueNotifierPtr notifier = MessageQueueThreadPoolQueueNotifier::create(mThisWeak.lock(), capacity);
       return notifier->getMessageQueue();
     }
 
   } // namespace internal
 
+  //---------------------------------------------------------------------------
+  ThreadPoolScaling ThreadPoolScaling::elastic(
+                                               size_t minThreads,
+                                               size_t maxThreads
+                                               ) noexcept
+  {
+    ThreadPoolScaling result;
+    result.mMinThreads = minThreads;
+    result.mMaxThreads = maxThreads;
+    return result;
+  }
+
   //---------------------------------------------------------------------------
   IMessageQueueThreadPoolPtr IMessageQueueThreadPool::create() noexcept
   {
@@ -175,6 +175,37 @@ namespace zsLib
       queue->post(std::move(message));
     }
 
+    //-------------------------------------------------------------------------
+    void MessageQueueThreadUsingBlackberryChannels::postBatch(MessageList &messages) noexcept(false)
+    {
+      MessageQueuePtr queue;
+      {
+        AutoLock lock(mLock);
+        queue = mQueue;
+        if (!queue) {
+          ZS_THROW_CUSTOM(IMessageQueue::Exceptions::MessageQueueGone, "message posted to message queue after message queue was deleted.")
+        }
+      }
+      queue->postBatch(messages);
+    }
+
+    //-----------------------------------------------------------------------
+    void MessageQueueThreadUsingBlackberryChannels::postAt(
+                                                           IMessageQueueMessageUniPtr message,
+                                                           const Time &deadline
+                                                           ) noexcept(false)
+    {
+      MessageQueuePtr queue;
+      {
+        AutoLock lock(mLock);
+        queue = mQueue;
+        if (!queue) {
+          ZS_THROW_CUSTOM(IMessageQueue::Exceptions::MessageQueueGone, "message posted to message queue after message queue was deleted.")
+        }
+      }
+      queue->postAt(std::move(message), deadline);
+    }
+
     //-----------------------------------------------------------------------
     IMessageQueue::size_type MessageQueueThreadUsingBlackberryChannels::getTotalUnprocessedMessages() const noexcept
     {
@@ -185,6 +216,36 @@ namespace zsLib
       return mQueue->getTotalUnprocessedMessages();
     }
 
+    //-----------------------------------------------------------------------
+    void MessageQueueThreadUsingBlackberryChannels::setCapacity(const MessageQueueCapacity &capacity) noexcept
+    {
+      AutoLock lock(mLock);
+      if (!mQueue)
+        return;
+
+      mQueue->setCapacity(capacity);
+    }
+
+    //-----------------------------------------------------------------------
+    MessageQueueCapacity MessageQueueThreadUsingBlackberryChannels::getCapacity() const noexcept
+    {
+      AutoLock lock(mLock);
+      if (!mQueue)
+        return MessageQueueCapacity();
+
+      return mQueue->getCapacity();
+    }
+
+    //-----------------------------------------------------------------------
+    MessageQueueCounters MessageQueueThreadUsingBlackberryChannels::getCounters() const noexcept
+    {
+      AutoLock lock(mLock);
+      if (!mQueue)
+        return MessageQueueCounters();
+
+      return mQueue->getCounters();
+    }
+
     //-----------------------------------------------------------------------
     void MessageQueueThreadUsingBlackberryChannels::notifyMessagePosted() noexcept
     {
@@ -213,6 +274,12 @@ namespace zsLib
       // no-op
     }
 
+    //-------------------------------------------------------------------------
+    void MessageQueueThreadUsingBlackberryChannels::setThreadAffinity(const ThreadAffinity &affinity) noexcept
+    {
+      // no-op
+    }
+
     //-----------------------------------------------------------------------
     void MessageQueueThreadUsingBlackberryChannels::processMessageFromThread() noexcept
     {
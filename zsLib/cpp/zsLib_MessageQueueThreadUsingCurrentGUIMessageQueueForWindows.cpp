@@ -198,12 +198,51 @@ namespace zsLib
       mQueue->post(std::move(message));
     }
 
+    //-------------------------------------------------------------------------
+    void MessageQueueThreadUsingCurrentGUIMessageQueueForWindows::postBatch(MessageList &messages) noexcept(false)
+    {
+      if (mIsShutdown) {
+        ZS_ASSERT_FAIL("message posted to message queue after message queue was deleted.");
+      }
+      mQueue->postBatch(messages);
+    }
+
+    //-------------------------------------------------------------------------
+    void MessageQueueThreadUsingCurrentGUIMessageQueueForWindows::postAt(
+                                                                         IMessageQueueMessageUniPtr message,
+                                                                         const Time &deadline
+                                                                         ) noexcept(false)
+    {
+      if (mIsShutdown) {
+        ZS_ASSERT_FAIL("message posted to message queue after message queue was deleted.");
+      }
+      mQueue->postAt(std::move(message), deadline);
+    }
+
     //-------------------------------------------------------------------------
     IMessageQueue::size_type MessageQueueThreadUsingCurrentGUIMessageQueueForWindows::getTotalUnprocessedMessages() const noexcept
     {
       return mQueue->getTotalUnprocessedMessages();
     }
 
+    //-------------------------------------------------------------------------
+    void MessageQueueThreadUsingCurrentGUIMessageQueueForWindows::setCapacity(const MessageQueueCapacity &capacity) noexcept
+    {
+      mQueue->setCapacity(capacity);
+    }
+
+    //-------------------------------------------------------------------------
+    MessageQueueCapacity MessageQueueThreadUsingCurrentGUIMessageQueueForWindows::getCapacity() const noexcept
+    {
+      return mQueue->getCapacity();
+    }
+
+    //-------------------------------------------------------------------------
+    MessageQueueCounters MessageQueueThreadUsingCurrentGUIMessageQueueForWindows::getCounters() const noexcept
+    {
+      return mQueue->getCounters();
+    }
+
 
     //-------------------------------------------------------------------------
     bool MessageQueueThreadUsingCurrentGUIMessageQueueForWindows::isCurrentThread() const noexcept
@@ -247,6 +286,13 @@ namespace zsLib
       // no-op
     }
 
+    //-------------------------------------------------------------------------
+    void MessageQueueThreadUsingCurrentGUIMessageQueueForWindows::setThreadAffinity(ZS_MAYBE_USED() const ThreadAffinity &affinity) noexcept
+    {
+      ZS_MAYBE_USED(affinity);
+      // no-op
+    }
+
     //-------------------------------------------------------------------------
     static LRESULT CALLBACK windowProc(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam) noexcept
     {
@@ -154,6 +154,27 @@ namespace zsLib
       mQueue->post(std::move(message));
     }
 
+    //-------------------------------------------------------------------------
+    void MessageQueueThreadUsingMainThreadMessageQueueForApple::postBatch(MessageList &messages) noexcept(false)
+    {
+      if (mIsShutdown) {
+        ZS_THROW_CUSTOM(Exceptions::MessageQueueAlreadyDeleted, "message posted to message queue after message queue was deleted.");
+      }
+      mQueue->postBatch(messages);
+    }
+
+    //-------------------------------------------------------------------------
+    void MessageQueueThreadUsingMainThreadMessageQueueForApple::postAt(
+                                                                       IMessageQueueMessageUniPtr message,
+                                                                       const Time &deadline
+                                                                       ) noexcept(false)
+    {
+      if (mIsShutdown) {
+        ZS_THROW_CUSTOM(Exceptions::MessageQueueAlreadyDeleted, "message posted to message queue after message queue was deleted.");
+      }
+      mQueue->postAt(std::move(message), deadline);
+    }
+
     //-------------------------------------------------------------------------
     IMessageQueue::size_type MessageQueueThreadUsingMainThreadMessageQueueForApple::getTotalUnprocessedMessages() const noexcept
     {
@@ -161,6 +182,27 @@ namespace zsLib
       return mQueue->getTotalUnprocessedMessages();
     }
 
+    //-------------------------------------------------------------------------
+    void MessageQueueThreadUsingMainThreadMessageQueueForApple::setCapacity(const MessageQueueCapacity &capacity) noexcept
+    {
+      AutoLock lock(mLock);
+      mQueue->setCapacity(capacity);
+    }
+
+    //-------------------------------------------------------------------------
+    MessageQueueCapacity MessageQueueThreadUsingMainThreadMessageQueueForApple::getCapacity() const noexcept
+    {
+      AutoLock lock(mLock);
+      return mQueue->getCapacity();
+    }
+
+    //-------------------------------------------------------------------------
+    MessageQueueCounters MessageQueueThreadUsingMainThreadMessageQueueForApple::getCounters() const noexcept
+    {
+      AutoLock lock(mLock);
+      return mQueue->getCounters();
+    }
+
     //-------------------------------------------------------------------------
     void MessageQueueThreadUsingMainThreadMessageQueueForApple::notifyMessagePosted() noexcept
     {
@@ -199,6 +241,12 @@ namespace zsLib
       // no-op
     }
 
+    //-------------------------------------------------------------------------
+    void MessageQueueThreadUsingMainThreadMessageQueueForApple::setThreadAffinity(const ThreadAffinity &affinity) noexcept
+    {
+      // no-op
+    }
+
     //-------------------------------------------------------------------------
     void MessageQueueThreadUsingMainThreadMessageQueueForApple::processMessagesFromThread() noexcept
     {
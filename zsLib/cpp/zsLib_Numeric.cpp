@@ -34,6 +34,8 @@
 #include <zsLib/Exception.h>
 #include <zsLib/helpers.h>
 
+#include <zsLib/internal/platform.h>
+
 #include <math.h>
 #include <sstream>
 #include <iomanip>
@@ -56,6 +58,16 @@
 #include <objbase.h>
 #endif //_WIN32
 
+// the 8 digits at a time decimal parser assumes the first character in
+// memory is the lowest byte when loaded as a 64 bit value
+#define ZSLIB_INTERNAL_NUMERIC_USE_SWAR 1
+
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__)
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#undef ZSLIB_INTERNAL_NUMERIC_USE_SWAR
+#endif //__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#endif //defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__)
+
 #ifdef _WIN32
 #pragma warning(push)
 #pragma warning(disable:4290)
@@ -71,30 +83,6 @@ using namespace std;
 
 namespace zsLib
 {
-  namespace compatibility {
-#ifdef _WIN32
-    using zsLib::internal::uuid_wrapper;
-
-    int uuid_parse(const char *input, uuid_wrapper::raw_uuid_type &output) noexcept {
-
-      String str(input);
-      if (str.isEmpty()) return -1;
-      if ('{' != *(str.c_str())) str = "{" + str + "}";
-
-      std::wstring convertedStr = str.wstring();
-      CLSID clsID {};
-      auto result = CLSIDFromString(convertedStr.c_str(), &clsID);
-
-      memcpy(&output, &clsID, sizeof(output));
-
-      if (NOERROR == result) return 0;
-      return -1;
-    }
-#endif //_WIN32
-  }
-
-  using namespace compatibility;
-
   template<typename t_type>
   void Numeric<t_type>::get(t_type &outValue) const noexcept(false) // throws ValueOutOfRange
   {
@@ -381,6 +369,60 @@ namespace zsLib
       return base;
     }
 
+#ifdef ZSLIB_INTERNAL_NUMERIC_USE_SWAR
+    //-----------------------------------------------------------------------
+    inline bool isEightDigits(QWORD chunk) noexcept
+    {
+      // each byte must be within '0'..'9' (0x30..0x39)
+      return 0 == (((chunk & 0xF0F0F0F0F0F0F0F0ULL) | (((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) ^ 0x3333333333333333ULL);
+    }
+
+    //-----------------------------------------------------------------------
+    inline ULONGLONG parseEightDigits(QWORD chunk) noexcept
+    {
+      // combine adjacent digits into pairs, then pairs into quads, then the
+      // quads into the final eight digit value
+      chunk -= 0x3030303030303030ULL;
+      chunk = (chunk * 10) + (chunk >> 8);
+      return (((chunk & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) +
+              (((chunk >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >> 32;
+    }
+#endif //ZSLIB_INTERNAL_NUMERIC_USE_SWAR
+
+    //-----------------------------------------------------------------------
+    bool parseDecimal(CSTR &ioStr, CSTR end, ULONGLONG &outResult) noexcept
+    {
+      ULONGLONG result = 0;
+      size_t totalDigits = 0;
+
+#ifdef ZSLIB_INTERNAL_NUMERIC_USE_SWAR
+      // 19 decimal digits can never overflow 64 bits so consume blocks of
+      // eight digits at a time without any overflow checks until then
+      while ((end - ioStr >= 8) && (totalDigits <= 11)) {
+        QWORD chunk = 0;
+        memcpy(&chunk, ioStr, sizeof(chunk));
+        if (!isEightDigits(chunk)) break;
+        result = (result * 100000000ULL) + parseEightDigits(chunk);
+        ioStr += 8;
+        totalDigits += 8;
+      }
+#endif //ZSLIB_INTERNAL_NUMERIC_USE_SWAR
+
+      BYTE digit = 0;
+      while ((ioStr < end) && ((digit = static_cast<BYTE>(*ioStr - '0')) < 10)) {
+        if (totalDigits >= 19) {
+          if (result > ((0xFFFFFFFFFFFFFFFFULL - digit) / 10))
+            return false; // value had to flip
+        }
+        result = (result * 10) + digit;
+        ++ioStr;
+        ++totalDigits;
+      }
+
+      outResult = result;
+      return true;
+    }
+
     bool convert(const String &input, LONGLONG &outResult, size_t size, bool ignoreWhiteSpace, size_t base) noexcept(false)
     {
       ZS_THROW_INVALID_USAGE_IF((0 == size) || (size > sizeof(QWORD)))
@@ -399,7 +441,20 @@ namespace zsLib
       LONGLONG result = 0;
 
       BYTE digit = 0;
-      if (positive) {
+      if (10 == base) {
+        ULONGLONG magnitude = 0;
+        if (!parseDecimal(str, input.c_str() + input.length(), magnitude))
+          return false;
+        if (positive) {
+          if (magnitude > static_cast<ULONGLONG>(gMaxLongLongs[size-1]))
+            return false;
+          result = static_cast<LONGLONG>(magnitude);
+        } else {
+          if (magnitude > (static_cast<ULONGLONG>(0) - gMinLongLongs[size-1]))
+            return false;
+          result = static_cast<LONGLONG>(static_cast<ULONGLONG>(0) - magnitude);
+        }
+      } else if (positive) {
         while ((digit = gDigitToValue[static_cast<uint8_t>(*str)]) < base) {
           LONGLONG lastResult = result;
 
@@ -455,14 +510,19 @@ namespace zsLib
       ULONGLONG result = 0;
 
       BYTE digit = 0;
-      while ((digit = gDigitToValue[static_cast<uint8_t>(*str)]) < base) {
-        ULONGLONG lastResult = result;
-
-        result *= base;
-        result += static_cast<ULONGLONG>(digit);
-        if (result < lastResult)
-          return false; // value had to flip
-        ++str;
+      if (10 == base) {
+        if (!parseDecimal(str, input.c_str() + input.length(), result))
+          return false;
+      } else {
+        while ((digit = gDigitToValue[static_cast<uint8_t>(*str)]) < base) {
+          ULONGLONG lastResult = result;
+
+          result *= base;
+          result += static_cast<ULONGLONG>(digit);
+          if (result < lastResult)
+            return false; // value had to flip
+          ++str;
+        }
       }
       if (result > gMaxULongLongs[size-1])
         return false;
@@ -477,6 +537,43 @@ namespace zsLib
       return true;
     }
 
+    //-----------------------------------------------------------------------
+    template <typename float_type>
+    bool fastConvertFloat(
+                          ZS_MAYBE_USED() const String &input,
+                          ZS_MAYBE_USED() float_type &outResult,
+                          ZS_MAYBE_USED() bool ignoreWhiteSpace
+                          ) noexcept
+    {
+      ZS_MAYBE_USED(input);
+      ZS_MAYBE_USED(outResult);
+      ZS_MAYBE_USED(ignoreWhiteSpace);
+
+#ifdef HAVE_STD_CHARCONV_FLOAT
+      CSTR str = input.c_str();
+      CSTR end = str + input.length();
+
+      if (ignoreWhiteSpace) {
+        skipSpace(str);
+        while ((end > str) && (isspace(*(end - 1)))) {
+          --end;
+        }
+      }
+
+      // anything the strict parser rejects (e.g. a leading '+') falls back
+      // to the legacy conversion so the accepted syntax does not change
+      float_type result {};
+      auto converted = std::from_chars(str, end, result);
+      if ((std::errc() != converted.ec) || (end != converted.ptr))
+        return false;
+
+      outResult = result;
+      return true;
+#else
+      return false;
+#endif //HAVE_STD_CHARCONV_FLOAT
+    }
+
     bool convert(const String &input, bool &outResult, bool ignoreWhiteSpace) noexcept(false)
     {
       String temp = input;
@@ -505,6 +602,9 @@ namespace zsLib
 
     bool convert(const String &input, float &outResult, bool ignoreWhiteSpace) noexcept
     {
+      if (fastConvertFloat(input, outResult, ignoreWhiteSpace))
+        return true;
+
       String temp = input;
       if (ignoreWhiteSpace)
         temp.trim();
@@ -520,6 +620,9 @@ namespace zsLib
 
     bool convert(const String &input, double &outResult, bool ignoreWhiteSpace) noexcept
     {
+      if (fastConvertFloat(input, outResult, ignoreWhiteSpace))
+        return true;
+
       String temp = input;
       if (ignoreWhiteSpace)
         temp.trim();
@@ -539,13 +642,29 @@ namespace zsLib
       if (ignoreWhiteSpace)
         temp.trim();
 
-#ifndef _WIN32
       temp.trimLeft("{");
       temp.trimRight("}");
-#endif //ndef _WIN32
 
-      if (0 == uuid_parse(temp.c_str(), outResult.mUUID)) return true;
-      return false;
+      // xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx (either case)
+      if (36 != temp.length()) return false;
+
+      const BYTE *pos = reinterpret_cast<const BYTE *>(temp.c_str());
+
+      UCHAR bytes[16];
+      for (size_t index = 0; index < sizeof(bytes); ++index) {
+        if ((4 == index) || (6 == index) || (8 == index) || (10 == index)) {
+          if ('-' != *pos) return false;
+          ++pos;
+        }
+        BYTE high = gDigitToValue[pos[0]];
+        BYTE low = gDigitToValue[pos[1]];
+        if ((high > 15) || (low > 15)) return false;
+        bytes[index] = static_cast<UCHAR>((high << 4) | low);
+        pos += 2;
+      }
+
+      outResult.setBytes(bytes);
+      return true;
     }
 
     bool convert(const String &input, Time &outResult, bool ignoreWhiteSpace) noexcept
@@ -31,7 +31,9 @@
 
 #include <zsLib/Promise.h>
 
-#include <map>
+#include <algorithm>
+#include <atomic>
+#include <vector>
 
 namespace zsLib {ZS_DECLARE_SUBSYSTEM(zslib)}
 
@@ -96,121 +98,105 @@ namespace zsLib
         pThis->mIgnoredRejections = ignoreRejections;
         pThis->mThisWeak = pThis;
 
-        // capture all promise information
-        {
-          for (auto iter = promises.begin(); iter != promises.end(); ++iter)
-          {
-            auto promise = (*iter);
-            pThis->mPendingPromises[promise->getID()] = promise;
-          }
-        }
-
-        // link to this
-        {
-          for (auto iter = promises.begin(); iter != promises.end(); ++iter)
-          {
-            auto promise = (*iter);
-            promise->thenWeak(pThis);
-          }
+        // the same promise listed twice only counts once
+        typedef std::pair<zsLib::Promise *, bool> LinkedPair;
+        std::vector<LinkedPair> unique;
+        unique.reserve(promises.size());
+        for (auto iter = promises.begin(); iter != promises.end(); ++iter) {
+          unique.push_back(LinkedPair((*iter).get(), false));
         }
+        std::sort(unique.begin(), unique.end());
+        unique.erase(std::unique(unique.begin(), unique.end()), unique.end());
 
-        if (promises.size() < 1) {
+        if (unique.size() < 1) {
           pThis->resolve();
+          return pThis;
         }
 
-        return pThis;
-      }
+        pThis->mRemaining = unique.size();
 
-    protected:
-      //-----------------------------------------------------------------------
-      //
-      // PromiseMultiDelegate => IPromiseDelegate
-      //
+        // link to this in list order (already settled promises are counted immediately)
+        for (auto iter = promises.begin(); iter != promises.end(); ++iter) {
+          if (pThis->mCombinedFired) break;
 
-      void onPromiseSettled(PromisePtr) override;
+          zsLib::Promise *promise = (*iter).get();
+          auto found = std::lower_bound(unique.begin(), unique.end(), LinkedPair(promise, false));
+          if ((*found).second) continue;
+          (*found).second = true;
 
-      void onPromiseResolved(PromisePtr promise) override;
+          if (promise->isSettled()) {
+            pThis->notifySettled(*promise);
+            continue;
+          }
+          promise->thenMessage(IMessageQueueMessageUniPtr(new SettledMessage(pThis, promise)));
+        }
 
-      void onPromiseRejected(PromisePtr promise) override;
+        return pThis;
+      }
 
-    private:
+    protected:
       //-----------------------------------------------------------------------
       //
       // PromiseMultiDelegate => (internal)
       //
 
-      typedef PUID PromiseID;
-      typedef std::map<PromiseID, PromisePtr> PromiseMap;
-
-      bool mAllMode {false};
-      bool mIgnoredRejections {false};
-
-      PromiseMap mPendingPromises;
-    };
-
-    //-------------------------------------------------------------------------
-    void PromiseMultiDelegate::onPromiseSettled(PromisePtr)
-    {
-    }
-
-    //-------------------------------------------------------------------------
-    void PromiseMultiDelegate::onPromiseResolved(PromisePtr promise)
-    {
-      PromisePtr pThis;
-
+      //-----------------------------------------------------------------------
+      // one message per input promise; the inputs are kept alive by
+      // mPromises for as long as the combined promise exists
+      class SettledMessage : public IMessageQueueMessage
       {
-        AutoRecursiveLock lock(mLock);
-
-        pThis = mThisWeak.lock();
-        if (!pThis) return;
-
-        if (mFired) return;
-
-        if (mAllMode) {
-          auto found = mPendingPromises.find(promise->getID());
-          if (found == mPendingPromises.end()) return;
-
-          mPendingPromises.erase(found);
-          if (mPendingPromises.size() > 0) return;
-        } else {
-          mPendingPromises.clear();
+      public:
+        SettledMessage(
+                       const PromiseMultiDelegatePtr &multi,
+                       zsLib::Promise *promise
+                       ) noexcept :
+          mMulti(multi),
+          mPromise(promise)
+        {}
+
+        const char *getDelegateName() const noexcept override {return "zsLib::Promise";}
+        const char *getMethodName() const noexcept override {return "onPromiseSettled";}
+
+        void processMessage() noexcept override
+        {
+          auto multi = mMulti.lock();
+          if (!multi) return;
+          multi->notifySettled(*mPromise);
         }
 
-        mFired = true;
-      }
-
-      pThis->resolve();
-    }
-
-    //-------------------------------------------------------------------------
-    void PromiseMultiDelegate::onPromiseRejected(PromisePtr promise)
-    {
-      PromisePtr pThis;
+      protected:
+        PromiseMultiDelegateWeakPtr mMulti;
+        zsLib::Promise *mPromise;
+      };
 
+      //-----------------------------------------------------------------------
+      void notifySettled(zsLib::Promise &promise) noexcept
       {
-        AutoRecursiveLock lock(mLock);
+        if (mCombinedFired) return;
 
-        pThis = mThisWeak.lock();
-        if (!pThis) return;
+        bool rejected = promise.isRejected();
 
-        if (mFired) return;
+        // (allSettled settles the same way as its last input did)
+        if ((mAllMode) && ((!rejected) || (mIgnoredRejections))) {
+          if (1 != mRemaining.fetch_sub(1)) return;
+        }
 
-        if (mAllMode) {
-          if (mIgnoredRejections) {
-            auto found = mPendingPromises.find(promise->getID());
-            if (found == mPendingPromises.end()) return;
+        if (mCombinedFired.exchange(true)) return;
 
-            mPendingPromises.erase(found);
-            if (mPendingPromises.size() > 0) return;
-          }
+        if (rejected) {
+          reject(promise.reason<Any>());
+          return;
         }
-
-        mFired = true;
-        mPendingPromises.clear();
+        resolve();
       }
 
-      pThis->reject(promise->reason<Any>());
-    }
+    private:
+      bool mAllMode {false};
+      bool mIgnoredRejections {false};
+
+      std::atomic<size_t> mRemaining {};
+      std::atomic<bool> mCombinedFired {};
+    };
 
 
     //-------------------------------------------------------------------------
@@ -454,6 +440,7 @@ namespace zsLib
   void Promise::resolve(AnyPtr value) noexcept
   {
     IPromiseDelegatePtr delegate;
+    IMessageQueueMessageUniPtr message;
 
     {
       AutoRecursiveLock lock(mLock);
@@ -470,11 +457,18 @@ namespace zsLib
         }
       }
 
+      message = std::move(mThenMessage);
+
       mThisBackground.reset();
       mThen.reset();
       mThenWeak.reset();
     }
 
+    if (message) {
+      postThenMessage(std::move(message));
+      return;
+    }
+
     if (delegate) {
       auto pThis = mThisWeak.lock();
       try {
@@ -489,6 +483,7 @@ namespace zsLib
   void Promise::reject(AnyPtr reason) noexcept
   {
     IPromiseDelegatePtr delegate;
+    IMessageQueueMessageUniPtr message;
 
     {
       AutoRecursiveLock lock(mLock);
@@ -506,11 +501,18 @@ namespace zsLib
         }
       }
 
+      message = std::move(mThenMessage);
+
       mThisBackground.reset();
       mThen.reset();
       mThenWeak.reset();
     }
 
+    if (message) {
+      postThenMessage(std::move(message));
+      return;
+    }
+
     if (delegate) {
       auto pThis = mThisWeak.lock();
       try {
@@ -584,6 +586,7 @@ namespace zsLib
       if (!isSettled()) {
         mThen = inDelegate;
         mThenWeak.reset();
+        mThenMessage.reset();
         return;
       }
 
@@ -629,7 +632,24 @@ namespace zsLib
 
       mThen.reset();
       mThenWeak = inDelegate;
+      mThenMessage.reset();
+    }
+  }
+
+  //---------------------------------------------------------------------------
+  void Promise::thenMessage(IMessageQueueMessageUniPtr message) noexcept
+  {
+    {
+      AutoRecursiveLock lock(mLock);
+      if (!isSettled()) {
+        mThen.reset();
+        mThenWeak.reset();
+        mThenMessage = std::move(message);
+        return;
+      }
     }
+
+    postThenMessage(std::move(message));
   }
 
   //---------------------------------------------------------------------------
@@ -665,6 +685,19 @@ namespace zsLib
     mThisBackground = mThisWeak.lock();
   }
 
+  //---------------------------------------------------------------------------
+  void Promise::postThenMessage(IMessageQueueMessageUniPtr message) noexcept
+  {
+    if (!message) return;
+
+    IMessageQueuePtr queue = getAssociatedMessageQueue();
+    if (!queue) {
+      message->processMessage();
+      return;
+    }
+    queue->post(std::move(message));
+  }
+
   //---------------------------------------------------------------------------
   void Promise::onPromiseSettled(PromisePtr promise)
   {
@@ -36,14 +36,16 @@
 #include <zsLib/helpers.h>
 #include <zsLib/Stringize.h>
 #include <zsLib/Singleton.h>
+#include <zsLib/ISettings.h>
+
+#include <algorithm>
+#include <map>
 
 #ifdef _DEBUG
 #include <iostream>
 #endif //_DEBUG
 
-#ifdef _DEBUG
 namespace zsLib { ZS_DECLARE_SUBSYSTEM(zslib) }
-#endif //_DEBUG
 
 namespace zsLib
 {
@@ -147,30 +149,276 @@ namespace zsLib
 
 #endif //_DEBUG
 
+    //-------------------------------------------------------------------------
+    //-------------------------------------------------------------------------
+    //-------------------------------------------------------------------------
+    //-------------------------------------------------------------------------
+    //
+    // ProxyCensus
+    //
+
+    // one call site within a thread's census table
+    struct ProxyCensusCounter
+    {
+      std::atomic<const char *> mFileName {};
+      int mLine {};
+      std::atomic<ULONGLONG> mCreated {};       // written by the owning thread only
+      std::atomic<ULONGLONG> mDestroyed {};     // written by whichever thread destroys the proxy
+    };
+
+    // Release mode call-site census. Every thread counts creations into its
+    // own table (only the owning thread writes them, so counting needs no
+    // locked instruction) and the tables are summed up when queried. A
+    // proxy remembers the entry that counted it so its destruction is
+    // recorded against the same entry from any thread. Tables are never
+    // freed; a table is recycled when its thread exits so its counts keep
+    // contributing to the totals.
+    class ProxyCensus
+    {
+    public:
+      enum Sizes
+      {
+        Sizes_Entries = 256,
+        Sizes_Probes = 16,
+        Sizes_SettingsRecheck = 4096,   // proxies a thread creates before re-reading the setting
+      };
+
+      typedef ProxyCensusCounter Entry;
+
+      struct Shard
+      {
+        Entry mEntries[Sizes_Entries];
+        Entry mOverflow;
+
+        std::atomic<bool> mActive {};
+        Shard *mNext {};
+      };
+
+      //-----------------------------------------------------------------------
+      static bool enabled() noexcept;
+      static Entry *created(int line, const char *fileName) noexcept;
+      static void destroyed(Entry &entry) noexcept {entry.mDestroyed.fetch_add(1, std::memory_order_relaxed);}
+
+      static ProxyCensusList collect(
+                                     size_t maxEntries,
+                                     bool orderByCreated
+                                     ) noexcept;
+      static void output() noexcept;
+
+    protected:
+      static void refreshEnabled() noexcept;
+      static Shard *threadShard() noexcept;
+      static Entry &find(
+                         Shard &shard,
+                         int line,
+                         const char *fileName
+                         ) noexcept;
+
+      static void increment(std::atomic<ULONGLONG> &counter) noexcept {counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);}
+    };
+
+    static std::atomic<ProxyCensus::Shard *> gProxyCensusShards {};
+    static std::atomic<bool> gProxyCensusEnabled {};
+
+    static thread_local ProxyCensus::Shard *tProxyCensusShard {};
+    static thread_local bool tProxyCensusThreadExited {};
+    static thread_local bool tProxyCensusReadingSettings {};
+    static thread_local size_t tProxyCensusRecheck {};
+
+    //-------------------------------------------------------------------------
+    class ProxyCensusThreadShard
+    {
+    public:
+      ~ProxyCensusThreadShard() noexcept
+      {
+        tProxyCensusThreadExited = true;
+
+        ProxyCensus::Shard *shard = tProxyCensusShard;
+        tProxyCensusShard = NULL;
+        if (!shard) return;
+
+        shard->mActive.store(false, std::memory_order_release);
+      }
+
+      void touch() noexcept {}
+    };
+
+    static thread_local ProxyCensusThreadShard tProxyCensusThreadShard;
+
+    //-------------------------------------------------------------------------
+    bool ProxyCensus::enabled() noexcept
+    {
+      if (0 == tProxyCensusRecheck) {
+        tProxyCensusRecheck = Sizes_SettingsRecheck;
+        refreshEnabled();
+      }
+      --tProxyCensusRecheck;
+      return gProxyCensusEnabled.load(std::memory_order_relaxed);
+    }
+
+    //-------------------------------------------------------------------------
+    void ProxyCensus::refreshEnabled() noexcept
+    {
+      // settings may create proxies themselves (or log)
+      if (tProxyCensusReadingSettings) return;
+
+      tProxyCensusReadingSettings = true;
+      gProxyCensusEnabled.store(ISettings::getBool(ZSLIB_SETTING_PROXY_CENSUS), std::memory_order_relaxed);
+      tProxyCensusReadingSettings = false;
+    }
+
+    //-------------------------------------------------------------------------
+    ProxyCensus::Entry *ProxyCensus::created(int line, const char *fileName) noexcept
+    {
+      if (!enabled()) return NULL;
+
+      Shard *shard = threadShard();
+      if (!shard) return NULL;
+
+      Entry &entry = find(*shard, line, fileName);
+      increment(entry.mCreated);
+      return &entry;
+    }
+
+    //-------------------------------------------------------------------------
+    ProxyCensus::Shard *ProxyCensus::threadShard() noexcept
+    {
+      Shard *shard = tProxyCensusShard;
+      if (shard) return shard;
+      if (tProxyCensusThreadExited) return NULL;
+
+      for (shard = gProxyCensusShards.load(std::memory_order_acquire); NULL != shard; shard = shard->mNext) {
+        if (shard->mActive.load(std::memory_order_relaxed)) continue;
+        bool expected = false;
+        if (shard->mActive.compare_exchange_strong(expected, true, std::memory_order_acquire)) break;
+      }
+
+      if (!shard) {
+        shard = new Shard;
+        shard->mActive.store(true, std::memory_order_relaxed);
+        Shard *head = gProxyCensusShards.load(std::memory_order_relaxed);
+        do {
+          shard->mNext = head;
+        } while (!gProxyCensusShards.compare_exchange_weak(head, shard, std::memory_order_release, std::memory_order_relaxed));
+      }
+
+      tProxyCensusShard = shard;
+      tProxyCensusThreadShard.touch();  // ensures the shard is handed back on thread exit
+      return shard;
+    }
+
+    //-------------------------------------------------------------------------
+    ProxyCensus::Entry &ProxyCensus::find(
+                                          Shard &shard,
+                                          int line,
+                                          const char *fileName
+                                          ) noexcept
+    {
+      if (!fileName) return shard.mOverflow;
+
+      size_t hash = (reinterpret_cast<uintptr_t>(fileName) >> 3) ^ (static_cast<size_t>(line) * 0x9E3779B1);
+      for (size_t probe = 0; probe < Sizes_Probes; ++probe) {
+        Entry &entry = shard.mEntries[(hash + probe) % Sizes_Entries];
+
+        // only the owning thread ever fills in an entry
+        const char *existing = entry.mFileName.load(std::memory_order_relaxed);
+        if (!existing) {
+          entry.mLine = line;
+          entry.mFileName.store(fileName, std::memory_order_release);
+          return entry;
+        }
+        if ((existing == fileName) && (line == entry.mLine)) return entry;
+      }
+      return shard.mOverflow;
+    }
+
+    //-------------------------------------------------------------------------
+    ProxyCensusList ProxyCensus::collect(
+                                         size_t maxEntries,
+                                         bool orderByCreated
+                                         ) noexcept
+    {
+      refreshEnabled();
+
+      // the same file may be known by different pointers (one per translation unit)
+      typedef std::pair<String, int> Location;
+      typedef std::map<Location, ProxyCensusEntry> LocationMap;
+
+      LocationMap locations;
+      ProxyCensusEntry overflow;
+
+      auto add = [](ProxyCensusEntry &total, const Entry &entry) {
+        ULONGLONG created = entry.mCreated.load(std::memory_order_relaxed);
+        ULONGLONG destroyed = entry.mDestroyed.load(std::memory_order_relaxed);
+        total.mTotalCreated += created;
+        total.mTotalLive += static_cast<LONGLONG>(created) - static_cast<LONGLONG>(destroyed);
+      };
+
+      for (Shard *shard = gProxyCensusShards.load(std::memory_order_acquire); NULL != shard; shard = shard->mNext) {
+        for (size_t index = 0; index < Sizes_Entries; ++index) {
+          const Entry &entry = shard->mEntries[index];
+          const char *fileName = entry.mFileName.load(std::memory_order_acquire);
+          if (!fileName) continue;
+
+          ProxyCensusEntry &total = locations[Location(String(fileName), entry.mLine)];
+          total.mFileName = fileName;
+          total.mLine = entry.mLine;
+          add(total, entry);
+        }
+        add(overflow, shard->mOverflow);
+      }
+
+      ProxyCensusList result;
+      for (auto iter = locations.begin(); iter != locations.end(); ++iter) {
+        result.push_back((*iter).second);
+      }
+      if (0 != overflow.mTotalCreated) result.push_back(overflow);
+
+      std::sort(result.begin(), result.end(), [orderByCreated](const ProxyCensusEntry &op1, const ProxyCensusEntry &op2) -> bool {
+        if (orderByCreated) return op1.mTotalCreated > op2.mTotalCreated;
+        return op1.mTotalLive > op2.mTotalLive;
+      });
+      if (result.size() > maxEntries) result.resize(maxEntries);
+      return result;
+    }
+
+    //-------------------------------------------------------------------------
+    void ProxyCensus::output() noexcept
+    {
+      ProxyCensusList census = collect(20, false);
+      if (census.size() < 1) return;
+
+      for (auto iter = census.begin(); iter != census.end(); ++iter) {
+        const ProxyCensusEntry &entry = (*iter);
+        String output = String("FILE=") + (entry.mFileName ? entry.mFileName : "(other)") + " LINE=" + string(entry.mLine) + " CREATED=" + string(entry.mTotalCreated) + " LIVE=" + string(entry.mTotalLive);
+        ZS_LOG_WARNING(Basic, output)
+      }
+    }
+
+    //-------------------------------------------------------------------------
     static std::atomic_ulong &getProxyCountGlobal()
     {
       static std::atomic_ulong total {};
       return total;
     }
 
-    void proxyCountIncrement(ZS_MAYBE_USED() int line, ZS_MAYBE_USED() const char *fileName)
+    ProxyCensusCounter *proxyCountIncrement(int line, const char *fileName)
     {
-      ZS_MAYBE_USED(line);
-      ZS_MAYBE_USED(fileName);
       ++getProxyCountGlobal();
 #ifdef _DEBUG
       (ProxyTracking::singleton()).follow(line, fileName);
 #endif //_DEBUG
+      return ProxyCensus::created(line, fileName);
     }
 
-    void proxyCountDecrement(int line, const char *fileName)
+    void proxyCountDecrement(int line, const char *fileName, ProxyCensusCounter *census)
     {
-      ZS_MAYBE_USED(line);
-      ZS_MAYBE_USED(fileName);
       --getProxyCountGlobal();
 #ifdef _DEBUG
       (ProxyTracking::singleton()).unfollow(line, fileName);
 #endif //_DEBUG
+      // counted even when the census was disabled in between so live counts stay balanced
+      if (census) ProxyCensus::destroyed(*census);
     }
   }
 
@@ -184,5 +432,14 @@ namespace zsLib
 #ifdef _DEBUG
     (internal::ProxyTracking::singleton()).output();
 #endif //DEBUG
+    internal::ProxyCensus::output();
+  }
+
+  ProxyCensusList proxyCensus(
+                              size_t maxEntries,
+                              bool orderByCreated
+                              )
+  {
+    return internal::ProxyCensus::collect(maxEntries, orderByCreated);
   }
 }
@@ -135,9 +135,17 @@ namespace zsLib
     //-------------------------------------------------------------------------
     SettingsPtr Settings::singleton() noexcept
     {
-      AutoRecursiveLock lock(*IHelper::getGlobalLock());
-      static SingletonLazySharedPtr<Settings> singleton(Settings::create());
-      SettingsPtr result = singleton.singleton();
+      // the global lock is only needed while the singleton is constructed
+      static std::atomic<SingletonLazySharedPtr<Settings> *> created {};
+      SingletonLazySharedPtr<Settings> *holder = created.load(std::memory_order_acquire);
+      if (!holder) {
+        AutoRecursiveLock lock(*IHelper::getGlobalLock());
+        static SingletonLazySharedPtr<Settings> singleton(Settings::create());
+        holder = &singleton;
+        created.store(holder, std::memory_order_release);
+      }
+
+      SettingsPtr result = holder->singleton();
       if (!result) {
         ZS_LOG_WARNING(Detail, slog("singleton gone"))
       }
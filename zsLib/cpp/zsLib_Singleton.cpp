@@ -34,6 +34,8 @@
 #include <zsLib/String.h>
 #include <zsLib/Exception.h>
 
+#include <thread>
+
 namespace zsLib { ZS_DECLARE_SUBSYSTEM(zslib) }
 
 namespace zsLib
@@ -48,6 +50,120 @@ namespace zsLib
 
   namespace internal
   {
+    //-------------------------------------------------------------------------
+    //-------------------------------------------------------------------------
+    //-------------------------------------------------------------------------
+    //-------------------------------------------------------------------------
+    //
+    // (helpers)
+    //
+
+    // records are never freed (a record is recycled when its thread exits) so
+    // the list can be walked without a lock
+    static std::atomic<SingletonHazards::Record *> gHazardRecords {};
+
+    static thread_local SingletonHazards::Record *tHazardRecord {};
+    static thread_local bool tHazardThreadExited {};
+
+    //-------------------------------------------------------------------------
+    class SingletonHazardsThreadRecord
+    {
+    public:
+      ~SingletonHazardsThreadRecord() noexcept
+      {
+        tHazardThreadExited = true;
+
+        SingletonHazards::Record *record = tHazardRecord;
+        tHazardRecord = NULL;
+        if (!record) return;
+
+        for (size_t index = 0; index < SingletonHazards::Sizes_SlotsPerThread; ++index) {
+          record->mSlots[index].store(NULL);
+        }
+        record->mUsed = 0;
+        record->mActive.store(false, std::memory_order_release);
+      }
+
+      void touch() noexcept {}
+    };
+
+    static thread_local SingletonHazardsThreadRecord tHazardThreadRecord;
+
+    //-------------------------------------------------------------------------
+    static SingletonHazards::Record *hazardRecord() noexcept
+    {
+      SingletonHazards::Record *record = tHazardRecord;
+      if (record) return record;
+      if (tHazardThreadExited) return NULL;
+
+      for (record = gHazardRecords.load(std::memory_order_acquire); NULL != record; record = record->mNext) {
+        if (record->mActive.load(std::memory_order_relaxed)) continue;
+        bool expected = false;
+        if (record->mActive.compare_exchange_strong(expected, true, std::memory_order_acquire)) break;
+      }
+
+      if (!record) {
+        record = new SingletonHazards::Record;
+        record->mActive.store(true, std::memory_order_relaxed);
+        SingletonHazards::Record *head = gHazardRecords.load(std::memory_order_relaxed);
+        do {
+          record->mNext = head;
+        } while (!gHazardRecords.compare_exchange_weak(head, record, std::memory_order_release, std::memory_order_relaxed));
+      }
+
+      tHazardRecord = record;
+      tHazardThreadRecord.touch();  // ensures the record is handed back on thread exit
+      return record;
+    }
+
+    //-------------------------------------------------------------------------
+    //-------------------------------------------------------------------------
+    //-------------------------------------------------------------------------
+    //-------------------------------------------------------------------------
+    //
+    // SingletonHazards
+    //
+
+    //-------------------------------------------------------------------------
+    std::atomic<const void *> *SingletonHazards::acquireSlot() noexcept
+    {
+      Record *record = hazardRecord();
+      if (!record) return NULL;
+      if (record->mUsed >= Sizes_SlotsPerThread) return NULL;
+
+      return &(record->mSlots[(record->mUsed)++]);
+    }
+
+    //-------------------------------------------------------------------------
+    void SingletonHazards::releaseSlot(std::atomic<const void *> *slot) noexcept
+    {
+      slot->store(NULL, std::memory_order_release);
+
+      Record *record = tHazardRecord;
+      if (!record) return;
+
+      ZS_ASSERT(record->mUsed > 0);
+      ZS_ASSERT(slot == &(record->mSlots[record->mUsed - 1]));
+      --(record->mUsed);
+    }
+
+    //-------------------------------------------------------------------------
+    void SingletonHazards::waitUntilUnprotected(const void *object) noexcept
+    {
+      // the calling thread's own slots are skipped as waiting on them would
+      // never finish (they are released when the calling scope unwinds)
+      Record *self = tHazardRecord;
+
+      for (Record *record = gHazardRecords.load(std::memory_order_acquire); NULL != record; record = record->mNext) {
+        if (record == self) continue;
+        for (size_t index = 0; index < Sizes_SlotsPerThread; ++index) {
+          while (object == record->mSlots[index].load()) {
+            std::this_thread::yield();
+          }
+        }
+      }
+    }
+
     //-------------------------------------------------------------------------
     //-------------------------------------------------------------------------
     //-------------------------------------------------------------------------
@@ -36,12 +36,18 @@
 
 #include <zsLib/Socket.h>
 
+#include <zsLib/internal/platform.h>
+
 #include <cmath>
 
 #ifdef _WIN32
 #define snprintf sprintf_s
 #endif //_WIN32
 
+// large enough for the shortest round trip fixed notation of any double
+// (e.g. DBL_MAX is 309 digits, the smallest denormal is 326 characters)
+#define ZSLIB_INTERNAL_STRINGIZE_MAX_FIXED_DOUBLE_CHARS (512)
+
 namespace zsLib { ZS_DECLARE_SUBSYSTEM(zslib) }
 
 namespace zsLib
@@ -54,29 +60,124 @@ namespace zsLib
       'a','b','c','d','e','f','g','h','i','j','k','l','m','n','o','p','q','r','s','t','u','v','w','x','y','z'
     };
 
+    // two digits are emitted per division to halve the number of divides
+    static const char gDigitPairs[200+1] =
+      "00010203040506070809"
+      "10111213141516171819"
+      "20212223242526272829"
+      "30313233343536373839"
+      "40414243444546474849"
+      "50515253545556575859"
+      "60616263646566676869"
+      "70717273747576777879"
+      "80818283848586878889"
+      "90919293949596979899";
+
     //-----------------------------------------------------------------------
     String convert(ULONGLONG value, size_t base) noexcept
     {
       ZS_ASSERT((base > 1) && (base <= (10+26)));
 
-      char buffer[sizeof(ULONGLONG)*8+2];
-      char *startPos = &(buffer[0]);
+      if (10 == base) return convertDecimal(value);
 
-      memset(startPos, 0, sizeof(buffer));
+      char buffer[sizeof(ULONGLONG)*8];
 
-      STR end = (startPos + (sizeof(ULONGLONG)*8));
+      STR end = &(buffer[0]) + sizeof(buffer);
       STR dest = end;
-      *dest = 0;
-      while (value > 0)
+      do
       {
         --dest;
         *dest = gDigits[value % base];
         value /= base;
+      } while (value > 0);
+
+      return String(dest, static_cast<size_t>(end - dest));
+    }
+
+    //-----------------------------------------------------------------------
+    size_t toChars(ULONGLONG value, char *outBuffer) noexcept
+    {
+      char buffer[20];
+
+      STR end = &(buffer[0]) + sizeof(buffer);
+      STR dest = end;
+
+      while (value >= 100) {
+        size_t index = static_cast<size_t>(value % 100) * 2;
+        value /= 100;
+        dest -= 2;
+        dest[0] = gDigitPairs[index];
+        dest[1] = gDigitPairs[index + 1];
       }
 
-      if (dest == end)
-        *dest = '0';
-      return String(dest);
+      if (value >= 10) {
+        size_t index = static_cast<size_t>(value) * 2;
+        dest -= 2;
+        dest[0] = gDigitPairs[index];
+        dest[1] = gDigitPairs[index + 1];
+      } else {
+        --dest;
+        *dest = static_cast<char>('0' + value);
+      }
+
+      size_t length = static_cast<size_t>(end - dest);
+      memcpy(outBuffer, dest, length);
+      return length;
+    }
+
+    //-----------------------------------------------------------------------
+    size_t toChars(LONGLONG value, char *outBuffer) noexcept
+    {
+      if (value >= 0) return toChars(static_cast<ULONGLONG>(value), outBuffer);
+
+      // negate as unsigned so the minimum value does not overflow
+      *outBuffer = '-';
+      return toChars(static_cast<ULONGLONG>(0) - static_cast<ULONGLONG>(value), outBuffer + 1) + 1;
+    }
+
+    //-----------------------------------------------------------------------
+    String convertDecimal(ULONGLONG value) noexcept
+    {
+      char buffer[20];
+      return String(&(buffer[0]), toChars(value, &(buffer[0])));
+    }
+
+    //-----------------------------------------------------------------------
+    String convertDecimal(LONGLONG value) noexcept
+    {
+      char buffer[21];
+      return String(&(buffer[0]), toChars(value, &(buffer[0])));
+    }
+
+    //-----------------------------------------------------------------------
+    template <typename float_type>
+    String convertFloatFixed(float_type value) noexcept
+    {
+#ifdef HAVE_STD_CHARCONV_FLOAT
+      // fixed format without a precision produces the shortest digit
+      // sequence which parses back to the exact same value (no exponent
+      // is ever output so the result remains compatible with what older
+      // versions of this routine generated)
+      char buffer[ZSLIB_INTERNAL_STRINGIZE_MAX_FIXED_DOUBLE_CHARS];
+      auto converted = std::to_chars(&(buffer[0]), &(buffer[0]) + sizeof(buffer), value, std::chars_format::fixed);
+      if (std::errc() == converted.ec) return String(&(buffer[0]), static_cast<size_t>(converted.ptr - &(buffer[0])));
+#endif //HAVE_STD_CHARCONV_FLOAT
+
+      std::string result = std::to_string(value);
+      trimTrailingZeros(result);
+      return result;
+    }
+
+    //-----------------------------------------------------------------------
+    String convertFloat(float value) noexcept
+    {
+      return convertFloatFixed(value);
+    }
+
+    //-----------------------------------------------------------------------
+    String convertFloat(double value) noexcept
+    {
+      return convertFloatFixed(value);
     }
 
     //-----------------------------------------------------------------------
@@ -91,7 +192,7 @@ namespace zsLib
         return durationToString<Microseconds>(sinceEpoch);
       }
 
-      return std::to_string(asSeconds.count());
+      return convertDecimal(asSeconds.count());
     }
 
     //-----------------------------------------------------------------------
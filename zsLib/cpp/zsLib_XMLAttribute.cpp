@@ -248,7 +248,7 @@ namespace zsLib
         prefix[1] = 0;
         result += generator.copy(ioPos, &(prefix[0]));
 
-        result += generator.copy(ioPos, XML::Parser::convertToJSONEncoding(mThis.lock()->getName()));
+        result += Parser::writeJSONEncoded(ioPos, mName.c_str(), mName.length());
 
         if (hasQuotes) {
           result += generator.fill(ioPos, generator.jsonStrs().mAttributeNameCloseStr);
@@ -256,7 +256,8 @@ namespace zsLib
           result += generator.fill(ioPos, generator.jsonStrs().mAttributeNameCloseNumber);
         }
 
-        result += generator.copy(ioPos, XML::Parser::convertToJSONEncoding(mThis.lock()->getValueDecoded()));
+        String value = mThis.lock()->getValueDecoded();
+        result += Parser::writeJSONEncoded(ioPos, value.c_str(), value.length());
 
         if (hasQuotes) {
           result += generator.fill(ioPos, generator.jsonStrs().mAttributeValueCloseStr);
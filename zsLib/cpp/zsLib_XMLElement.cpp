@@ -270,7 +270,7 @@ namespace zsLib
                   mResult += mGenerator.fill(mPos, mStrs.mNextObjectInList);
                 }
                 mResult += mGenerator.fill(mPos, mStrs.mObjectNameOpen);
-                mResult += mGenerator.copy(mPos, XML::Parser::convertToJSONEncoding(el->getValue()));
+                mResult += writeJSONName(el);
                 mResult += mGenerator.fill(mPos, mStrs.mObjectNameClose);
                 break;
               }
@@ -287,7 +287,7 @@ namespace zsLib
                       mResult += mGenerator.fill(mPos, mStrs.mFirstArrayEmptyName);
                     } else {
                       mResult += mGenerator.fill(mPos, mStrs.mFirstArrayNameOpen);
-                      mResult += mGenerator.copy(mPos, XML::Parser::convertToJSONEncoding(el->getValue()));
+                      mResult += writeJSONName(el);
                       mResult += mGenerator.fill(mPos, mStrs.mFirstArrayNameClose);
                     }
                     break;
@@ -464,6 +464,13 @@ namespace zsLib
             return false;
           }
 
+        private:
+          size_t writeJSONName(const ElementPtr &el) noexcept
+          {
+            const String &name = el->mName;
+            return Parser::writeJSONEncoded(mPos, name.c_str(), name.length());
+          }
+
         private:
           const GeneratorPtr &mGeneratorPtr;
           const Generator &mGenerator;
@@ -32,12 +32,29 @@
 #include <zsLib/XML.h>
 #include <zsLib/Exception.h>
 #include <zsLib/Numeric.h>
+#include <zsLib/Event.h>
+#include <zsLib/IMessageQueue.h>
+#include <zsLib/IMessageQueueThreadPool.h>
+
+#include <thread>
 
 #pragma warning(push)
 #pragma warning(disable: 4996)
 
 #define ZS_INTERNAL_UTF8_MAX_CHARACTER_ENCODED_BYTE_SIZE (sizeof(BYTE)*6)
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define ZS_INTERNAL_XML_ESCAPE_USE_SSE2
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define ZS_INTERNAL_XML_ESCAPE_USE_NEON
+#endif //defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif //_MSC_VER
+
 namespace zsLib {ZS_DECLARE_SUBSYSTEM(zslib)}
 
 using namespace std;
@@ -357,6 +374,356 @@ namespace zsLib
       {
       }
       
+      //-----------------------------------------------------------------------
+      //-----------------------------------------------------------------------
+      //-----------------------------------------------------------------------
+      //-----------------------------------------------------------------------
+      //
+      // (helpers)
+      //
+
+      // Each escape kind scans for a handful of specific characters plus any
+      // control character (< 0x20). The scan only finds candidates, the
+      // writer decides what to do with them.
+      enum EscapeKinds
+      {
+        EscapeKind_Text,          // & < >
+        EscapeKind_Attribute,     // & < > " '
+        EscapeKind_JSON,          // " and backslash
+      };
+
+      struct EscapeTable
+      {
+        bool mCandidate[256];
+
+        EscapeTable(const char *inCandidates) noexcept
+        {
+          for (size_t index = 0; index < 256; ++index) {
+            mCandidate[index] = (index < 0x20);
+          }
+          for (; '\0' != *inCandidates; ++inCandidates) {
+            mCandidate[static_cast<BYTE>(*inCandidates)] = true;
+          }
+        }
+      };
+
+      static const char *escapeCandidates(EscapeKinds kind) noexcept
+      {
+        switch (kind)
+        {
+          case EscapeKind_Text:       return "&<>";
+          case EscapeKind_Attribute:  return "&<>\"\'";
+          case EscapeKind_JSON:       return "\"\\";
+        }
+        return "";
+      }
+
+      static const EscapeTable &escapeTable(EscapeKinds kind) noexcept
+      {
+        static const EscapeTable gText(escapeCandidates(EscapeKind_Text));
+        static const EscapeTable gAttribute(escapeCandidates(EscapeKind_Attribute));
+        static const EscapeTable gJSON(escapeCandidates(EscapeKind_JSON));
+
+        switch (kind)
+        {
+          case EscapeKind_Text:       return gText;
+          case EscapeKind_Attribute:  return gAttribute;
+          case EscapeKind_JSON:       break;
+        }
+        return gJSON;
+      }
+
+#ifdef ZS_INTERNAL_XML_ESCAPE_USE_SSE2
+
+      //-----------------------------------------------------------------------
+      static inline size_t firstBitSet(unsigned int mask) noexcept
+      {
+#ifdef _MSC_VER
+        unsigned long index = 0;
+        _BitScanForward(&index, mask);
+        return static_cast<size_t>(index);
+#else
+        return static_cast<size_t>(__builtin_ctz(mask));
+#endif //_MSC_VER
+      }
+
+      //-----------------------------------------------------------------------
+      template <EscapeKinds kind>
+      static inline __m128i escapeCandidateMask(__m128i chunk) noexcept
+      {
+        // unsigned "chunk <= 0x1F" test
+        const __m128i controlMax = _mm_set1_epi8(0x1F);
+        __m128i result = _mm_cmpeq_epi8(_mm_max_epu8(chunk, controlMax), controlMax);
+
+        switch (kind)
+        {
+          case EscapeKind_Attribute:
+          {
+            result = _mm_or_si128(result, _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\"')));
+            result = _mm_or_si128(result, _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\'')));
+          }
+          // fall through
+          case EscapeKind_Text:
+          {
+            result = _mm_or_si128(result, _mm_cmpeq_epi8(chunk, _mm_set1_epi8('&')));
+            result = _mm_or_si128(result, _mm_cmpeq_epi8(chunk, _mm_set1_epi8('<')));
+            result = _mm_or_si128(result, _mm_cmpeq_epi8(chunk, _mm_set1_epi8('>')));
+            break;
+          }
+          case EscapeKind_JSON:
+          {
+            result = _mm_or_si128(result, _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\"')));
+            result = _mm_or_si128(result, _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\\')));
+            break;
+          }
+        }
+        return result;
+      }
+
+#endif //ZS_INTERNAL_XML_ESCAPE_USE_SSE2
+
+#ifdef ZS_INTERNAL_XML_ESCAPE_USE_NEON
+
+      //-----------------------------------------------------------------------
+      template <EscapeKinds kind>
+      static inline uint8x16_t escapeCandidateMask(uint8x16_t chunk) noexcept
+      {
+        uint8x16_t result = vcleq_u8(chunk, vdupq_n_u8(0x1F));
+
+        switch (kind)
+        {
+          case EscapeKind_Attribute:
+          {
+            result = vorrq_u8(result, vceqq_u8(chunk, vdupq_n_u8('\"')));
+            result = vorrq_u8(result, vceqq_u8(chunk, vdupq_n_u8('\'')));
+          }
+          // fall through
+          case EscapeKind_Text:
+          {
+            result = vorrq_u8(result, vceqq_u8(chunk, vdupq_n_u8('&')));
+            result = vorrq_u8(result, vceqq_u8(chunk, vdupq_n_u8('<')));
+            result = vorrq_u8(result, vceqq_u8(chunk, vdupq_n_u8('>')));
+            break;
+          }
+          case EscapeKind_JSON:
+          {
+            result = vorrq_u8(result, vceqq_u8(chunk, vdupq_n_u8('\"')));
+            result = vorrq_u8(result, vceqq_u8(chunk, vdupq_n_u8('\\')));
+            break;
+          }
+        }
+        return result;
+      }
+
+#endif //ZS_INTERNAL_XML_ESCAPE_USE_NEON
+
+      //-----------------------------------------------------------------------
+      template <EscapeKinds kind>
+      static size_t skipUnescaped(CSTR inString, size_t inLength) noexcept
+      {
+        // returns the length of the leading run which can be copied as is
+        size_t pos = 0;
+
+#ifdef ZS_INTERNAL_XML_ESCAPE_USE_SSE2
+        for (; pos + sizeof(__m128i) <= inLength; pos += sizeof(__m128i))
+        {
+          __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(inString + pos));
+          unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(escapeCandidateMask<kind>(chunk)));
+          if (0 != mask)
+            return pos + firstBitSet(mask);
+        }
+#endif //ZS_INTERNAL_XML_ESCAPE_USE_SSE2
+
+#ifdef ZS_INTERNAL_XML_ESCAPE_USE_NEON
+        for (; pos + sizeof(uint8x16_t) <= inLength; pos += sizeof(uint8x16_t))
+        {
+          uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t *>(inString + pos));
+          if (0 != vmaxvq_u8(escapeCandidateMask<kind>(chunk)))
+            break;  // the scalar loop below locates the exact position
+        }
+#endif //ZS_INTERNAL_XML_ESCAPE_USE_NEON
+
+        const EscapeTable &table = escapeTable(kind);
+        for (; pos < inLength; ++pos)
+        {
+          if (table.mCandidate[static_cast<BYTE>(inString[pos])])
+            break;
+        }
+        return pos;
+      }
+
+      //-----------------------------------------------------------------------
+      static inline size_t writeEscapeRaw(char * &ioPos, CSTR inString, size_t inLength) noexcept
+      {
+        if ((NULL != ioPos) &&
+            (0 != inLength)) {
+          memcpy(ioPos, inString, inLength);
+          ioPos += inLength;
+        }
+        return inLength;
+      }
+
+      //-----------------------------------------------------------------------
+      template <size_t N>
+      static inline size_t writeEscapeSequence(char * &ioPos, const char (&inSequence)[N]) noexcept
+      {
+        return writeEscapeRaw(ioPos, inSequence, N - 1);
+      }
+
+      //-----------------------------------------------------------------------
+      static inline void writeEscapeTerminate(char *ioPos) noexcept
+      {
+        if (NULL != ioPos)
+          *ioPos = '\0';
+      }
+
+      //-----------------------------------------------------------------------
+      //-----------------------------------------------------------------------
+      //-----------------------------------------------------------------------
+      //-----------------------------------------------------------------------
+      //
+      // XML::internal::Parser
+      //
+
+      //-----------------------------------------------------------------------
+      size_t Parser::writeTextEntitySafe(
+                                         char * &ioPos,
+                                         CSTR inString,
+                                         size_t inLength,
+                                         bool entityEncode0xD
+                                         ) noexcept
+      {
+        size_t result = 0;
+        CSTR source = inString;
+        CSTR end = inString + inLength;
+
+        while (source < end)
+        {
+          size_t run = skipUnescaped<EscapeKind_Text>(source, static_cast<size_t>(end - source));
+          result += writeEscapeRaw(ioPos, source, run);
+          source += run;
+
+          if (source >= end)
+            break;
+
+          switch (*source)
+          {
+            case '&':   result += writeEscapeSequence(ioPos, "&amp;"); break;
+            case '<':   result += writeEscapeSequence(ioPos, "&lt;"); break;
+            case '>':   result += writeEscapeSequence(ioPos, "&gt;"); break;
+            case '\xD':
+            {
+              if (entityEncode0xD) {
+                result += writeEscapeSequence(ioPos, "&#xD;");
+                break;
+              }
+              result += writeEscapeRaw(ioPos, source, 1);
+              break;
+            }
+            default:    result += writeEscapeRaw(ioPos, source, 1); break;
+          }
+          ++source;
+        }
+
+        writeEscapeTerminate(ioPos);
+        return result;
+      }
+
+      //-----------------------------------------------------------------------
+      size_t Parser::writeAttributeEntitySafe(
+                                              char * &ioPos,
+                                              CSTR inString,
+                                              size_t inLength,
+                                              bool escapeDoubleQuote,
+                                              bool escapeSingleQuote
+                                              ) noexcept
+      {
+        size_t result = 0;
+        CSTR source = inString;
+        CSTR end = inString + inLength;
+
+        while (source < end)
+        {
+          size_t run = skipUnescaped<EscapeKind_Attribute>(source, static_cast<size_t>(end - source));
+          result += writeEscapeRaw(ioPos, source, run);
+          source += run;
+
+          if (source >= end)
+            break;
+
+          switch (*source)
+          {
+            case '&':   result += writeEscapeSequence(ioPos, "&amp;"); break;
+            case '<':   result += writeEscapeSequence(ioPos, "&lt;"); break;
+            case '>':   result += writeEscapeSequence(ioPos, "&gt;"); break;
+            case '\x9': result += writeEscapeSequence(ioPos, "&#x9;"); break;
+            case '\xA': result += writeEscapeSequence(ioPos, "&#xA;"); break;
+            case '\xD': result += writeEscapeSequence(ioPos, "&#xD;"); break;
+            case '\"':
+            {
+              if (escapeDoubleQuote) {
+                result += writeEscapeSequence(ioPos, "&quot;");
+                break;
+              }
+              result += writeEscapeRaw(ioPos, source, 1);
+              break;
+            }
+            case '\'':
+            {
+              if (escapeSingleQuote) {
+                result += writeEscapeSequence(ioPos, "&apos;");
+                break;
+              }
+              result += writeEscapeRaw(ioPos, source, 1);
+              break;
+            }
+            default:    result += writeEscapeRaw(ioPos, source, 1); break;
+          }
+          ++source;
+        }
+
+        writeEscapeTerminate(ioPos);
+        return result;
+      }
+
+      //-----------------------------------------------------------------------
+      size_t Parser::writeJSONEncoded(
+                                      char * &ioPos,
+                                      CSTR inString,
+                                      size_t inLength
+                                      ) noexcept
+      {
+        size_t result = 0;
+        CSTR source = inString;
+        CSTR end = inString + inLength;
+
+        while (source < end)
+        {
+          size_t run = skipUnescaped<EscapeKind_JSON>(source, static_cast<size_t>(end - source));
+          result += writeEscapeRaw(ioPos, source, run);
+          source += run;
+
+          if (source >= end)
+            break;
+
+          switch (*source)
+          {
+            case '\"':  result += writeEscapeSequence(ioPos, "\\\""); break;
+            case '\\':  result += writeEscapeSequence(ioPos, "\\\\"); break;
+            case '\b':  result += writeEscapeSequence(ioPos, "\\b"); break;
+            case '\f':  result += writeEscapeSequence(ioPos, "\\f"); break;
+            case '\n':  result += writeEscapeSequence(ioPos, "\\n"); break;
+            case '\r':  result += writeEscapeSequence(ioPos, "\\r"); break;
+            case '\t':  result += writeEscapeSequence(ioPos, "\\t"); break;
+            default:    result += writeEscapeRaw(ioPos, source, 1); break;
+          }
+          ++source;
+        }
+
+        writeEscapeTerminate(ioPos);
+        return result;
+      }
+
       //-----------------------------------------------------------------------
       void Parser::clearStack() noexcept
       {
@@ -1349,6 +1716,105 @@ namespace zsLib
       return outDocument;
     }
 
+    //-------------------------------------------------------------------------
+    Parser::BatchResultVector Parser::parseBatch(
+                                                 IMessageQueueThreadPoolPtr pool,
+                                                 const BatchInputVector &inDocuments,
+                                                 bool inElementNameIsCaseSensative,
+                                                 bool inAttributeNameIsCaseSensative,
+                                                 size_t maxThreads
+                                                 ) noexcept
+    {
+      struct BatchState
+      {
+        const BatchInputVector *mInputs {};     // only dereferenced after a document index is claimed
+        BatchResultVector mResults;
+
+        ParserModes mParserMode {ParserMode_XML};
+        ULONG mTabSize {};
+        bool mEnableWarnings {};
+        NoChildrenElementList mSingleElements;
+        String mJSONForcedText;
+        char mJSONAttributePrefix {};
+        bool mElementNameIsCaseSensative {};
+        bool mAttributeNameIsCaseSensative {};
+
+        std::atomic<size_t> mNext {};
+        std::atomic<size_t> mCompleted {};
+        Event mDone;
+      };
+
+      size_t total = inDocuments.size();
+      if (total < 1) return BatchResultVector();
+
+      auto state = make_shared<BatchState>();
+      state->mInputs = &inDocuments;
+      state->mResults.resize(total);
+      state->mParserMode = mParserMode;
+      state->mTabSize = mTabSize;
+      state->mEnableWarnings = mEnableWarnings;
+      state->mSingleElements = mSingleElements;
+      state->mJSONForcedText = mJSONForcedText;
+      state->mJSONAttributePrefix = mJSONAttributePrefix;
+      state->mElementNameIsCaseSensative = inElementNameIsCaseSensative;
+      state->mAttributeNameIsCaseSensative = inAttributeNameIsCaseSensative;
+
+      // each worker claims documents one at a time and reuses a single parser
+      // (and its stack) for every document it claims; workers that start after
+      // all documents are claimed exit without touching anything but the counter
+      auto worker = [state, total]() noexcept {
+        ParserPtr parser;
+
+        while (true) {
+          size_t index = state->mNext.fetch_add(1);
+          if (index >= total) break;
+
+          if (!parser) {
+            parser = make_shared<Parser>(make_private{});
+            parser->mThis = parser;
+            parser->mTabSize = state->mTabSize;
+            parser->mEnableWarnings = state->mEnableWarnings;
+            parser->mSingleElements = state->mSingleElements;
+            parser->mJSONForcedText = state->mJSONForcedText;
+            parser->mJSONAttributePrefix = state->mJSONAttributePrefix;
+          }
+
+          // auto detection resolves the mode per document
+          parser->mParserMode = state->mParserMode;
+
+          BatchResult &result = state->mResults[index];
+          result.mDocument = parser->parse((*(state->mInputs))[index], state->mElementNameIsCaseSensative, state->mAttributeNameIsCaseSensative);
+          result.mWarnings.swap(parser->mWarnings);
+
+          if (state->mCompleted.fetch_add(1) + 1 == total) {
+            state->mDone.notify();
+          }
+        }
+      };
+
+      if (0 == maxThreads) {
+        maxThreads = static_cast<size_t>(std::thread::hardware_concurrency());
+      }
+
+      size_t helpers = (maxThreads > 1 ? maxThreads - 1 : 0);
+      if (helpers > total - 1) helpers = total - 1;
+      if (!pool) helpers = 0;
+
+      for (size_t loop = 0; loop < helpers; ++loop) {
+        IMessageQueuePtr queue = pool->createQueue();
+        if (!queue) break;
+        queue->postClosure(worker);
+      }
+
+      // the calling thread drains the remaining work so the batch completes
+      // even when every pool thread is busy (or the caller is a pool thread)
+      worker();
+
+      state->mDone.wait();
+
+      return std::move(state->mResults);
+    }
+
     //-------------------------------------------------------------------------
     void Parser::clearWarnings() noexcept
     {
@@ -1382,6 +1848,9 @@ namespace zsLib
     //-------------------------------------------------------------------------
     String Parser::convertFromEntities(const String &inString) noexcept
     {
+      if (String::npos == inString.find('&'))
+        return inString;
+
       std::unique_ptr<char[]> result(new char[inString.getLength()*ZS_INTERNAL_UTF8_MAX_CHARACTER_ENCODED_BYTE_SIZE+1]);
       memset(result.get(), 0, sizeof(char)*(inString.getLength()*ZS_INTERNAL_UTF8_MAX_CHARACTER_ENCODED_BYTE_SIZE+1));
 
@@ -1491,60 +1960,19 @@ namespace zsLib
     // &quot;
     // &apos;
 
-#define ZS_INTERNAL_LONGEST_MANDITORY_ENTITY "&quot;"
-
     //-------------------------------------------------------------------------
     String Parser::makeTextEntitySafe(const String &inString, bool entityEncode0xD) noexcept
     {
-      std::unique_ptr<char[]>buffer(new char[(inString.getLength()*strlen(ZS_INTERNAL_LONGEST_MANDITORY_ENTITY))+1]);
-
-      const char *source = inString;
-      char *dest = buffer.get();
-      while (*source)
-      {
-        switch (*source)
-        {
-          case '&':
-          {
-            strcpy(dest, "&amp;");
-            dest += strlen("&amp;");
-            break;
-          }
-          case '<':
-          {
-            strcpy(dest, "&lt;");
-            dest += strlen("&lt;");
-            break;
-          }
-          case '>':
-          {
-            strcpy(dest, "&gt;");
-            dest += strlen("&gt;");
-            break;
-          }
-          case '\xD':
-          {
-            if (entityEncode0xD) {
-              strcpy(dest, "&#xD;");
-              dest += strlen("&#xD;");
-            } else {
-              *dest = *source;
-              ++dest;
-            }
-            break;
-          }
-          default:
-          {
-            *dest = *source;
-            ++dest;
-            break;
-          }
-        }
-        ++source;
-      }
-      *dest = 0;
-
-      return String((CSTR)buffer.get());
+      char *sizeOnly = NULL;
+      size_t length = writeTextEntitySafe(sizeOnly, inString.c_str(), inString.length(), entityEncode0xD);
+      if (length == inString.length())
+        return inString;
+
+      String result;
+      result.resize(length);
+      char *dest = &(result[0]);
+      writeTextEntitySafe(dest, inString.c_str(), inString.length(), entityEncode0xD);
+      return result;
     }
 
     //-------------------------------------------------------------------------
@@ -1577,89 +2005,16 @@ namespace zsLib
         }
       }
 
-      std::unique_ptr<char[]> buffer(new char[(inString.getLength()*strlen(ZS_INTERNAL_LONGEST_MANDITORY_ENTITY))+1]);
-
-      const char *source = inString;
-      char *dest = buffer.get();
-      while (*source)
-      {
-        bool doDefault = false;
-        switch (*source)
-        {
-          case '&':
-          {
-            strcpy(dest, "&amp;");
-            dest += strlen("&amp;");
-            break;
-          }
-          case '<':
-          {
-            strcpy(dest, "&lt;");
-            dest += strlen("&lt;");
-            break;
-          }
-          case '>':
-          {
-            strcpy(dest, "&gt;");
-            dest += strlen("&gt;");
-            break;
-          }
-          case '\"':
-          {
-            if (escapeDoubleQuote)
-            {
-              strcpy(dest, "&quot;");
-              dest += strlen("&quot;");
-            }
-            else
-              doDefault = true;
-            break;
-          }
-          case '\'':
-          {
-            if (escapeSingleQuote)
-            {
-              strcpy(dest, "&apos;");
-              dest += strlen("&apos;");
-            }
-            else
-              doDefault = true;
-            break;
-          }
-          case '\x9':
-          {
-            strcpy(dest, "&#x9;");
-            dest += strlen("&#x9;");
-            break;
-          }
-          case '\xA':
-          {
-            strcpy(dest, "&#xA;");
-            dest += strlen("&#xA;");
-            break;
-          }
-          case '\xD':
-          {
-            strcpy(dest, "&#xD;");
-            dest += strlen("&#xD;");
-            break;
-          }
-          default:
-          {
-            doDefault = true;
-            break;
-          }
-        }
-        if (doDefault)
-        {
-          *dest = *source;
-          ++dest;
-        }
-        ++source;
-      }
-      *dest = 0;
+      char *sizeOnly = NULL;
+      size_t length = writeAttributeEntitySafe(sizeOnly, inString.c_str(), inString.length(), escapeDoubleQuote, escapeSingleQuote);
+      if (length == inString.length())
+        return inString;
 
-      return String((CSTR)buffer.get());
+      String result;
+      result.resize(length);
+      char *dest = &(result[0]);
+      writeAttributeEntitySafe(dest, inString.c_str(), inString.length(), escapeDoubleQuote, escapeSingleQuote);
+      return result;
     }
 
     //-------------------------------------------------------------------------
@@ -1736,32 +2091,16 @@ namespace zsLib
     //-------------------------------------------------------------------------
     String Parser::convertToJSONEncoding(const String &inString) noexcept
     {
-      std::unique_ptr<char[]> temp(new char[(inString.getLength()*2)+1]);
-
-      const char *source = inString.c_str();
-      char *dest = temp.get();
-
-      while (*source)
-      {
-        switch (*source) {
-          case '\"': *dest = '\\'; ++dest; *dest = '\"'; ++dest; break;
-          case '\\': *dest = '\\'; ++dest; *dest = '\\'; ++dest; break;
-          case '\b': *dest = '\\'; ++dest; *dest = 'b'; ++dest; break;
-          case '\f': *dest = '\\'; ++dest; *dest = 'f'; ++dest; break;
-          case '\n': *dest = '\\'; ++dest; *dest = 'n'; ++dest; break;
-          case '\r': *dest = '\\'; ++dest; *dest = 'r'; ++dest; break;
-          case '\t': *dest = '\\'; ++dest; *dest = 't'; ++dest; break;
-          default: {
-            *dest = *source;
-            ++dest;
-          }
-        }
-        ++source;
-      }
-
-      *dest = 0;
-
-      return temp.get();
+      char *sizeOnly = NULL;
+      size_t length = writeJSONEncoded(sizeOnly, inString.c_str(), inString.length());
+      if (length == inString.length())
+        return inString;
+
+      String result;
+      result.resize(length);
+      char *dest = &(result[0]);
+      writeJSONEncoded(dest, inString.c_str(), inString.length());
+      return result;
     }
 
   } // namespace XML
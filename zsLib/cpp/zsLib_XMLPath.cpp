@@ -0,0 +1,470 @@
+/*
+
+ Copyright (c) 2014, Robin Raymond
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation
+ and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ The views and conclusions contained in the software and documentation are those
+ of the authors and should not be interpreted as representing official policies,
+ either expressed or implied, of the FreeBSD Project.
+ 
+ */
+
+
+#include <zsLib/XML.h>
+#include <zsLib/Exception.h>
+
+#include <cctype>
+
+namespace zsLib {ZS_DECLARE_SUBSYSTEM(zslib)}
+
+#pragma warning(push)
+#pragma warning(disable: 4290)
+
+namespace zsLib
+{
+
+  namespace XML
+  {
+
+    namespace internal
+    {
+      //-----------------------------------------------------------------------
+      //-----------------------------------------------------------------------
+      //-----------------------------------------------------------------------
+      //-----------------------------------------------------------------------
+      //
+      // XML::internal::Path
+      //
+
+      //-----------------------------------------------------------------------
+      Path::Path() noexcept
+      {
+      }
+
+      //-----------------------------------------------------------------------
+      Path::~Path() noexcept
+      {
+      }
+
+      //-----------------------------------------------------------------------
+      bool Path::parseIndex(CSTR inStart, CSTR inEnd, size_t &outIndex) noexcept
+      {
+        if (inStart == inEnd)
+          return false;
+
+        size_t result = 0;
+        for (CSTR pos = inStart; pos != inEnd; ++pos)
+        {
+          if (!isdigit(*pos))
+            return false;
+
+          size_t digit = static_cast<size_t>(*pos - '0');
+          if (result > ((SIZE_MAX - 1 - digit) / 10))
+            return false;
+
+          result = (result * 10) + digit;
+        }
+
+        outIndex = result;
+        return true;
+      }
+
+      //-----------------------------------------------------------------------
+      void Path::addStep(const String &inName, size_t inIndex) noexcept
+      {
+        Step step;
+        step.mIndex = inIndex;
+
+        if ("*" != inName) {
+          step.mName = inName;
+          step.mNameLowerCase = inName;
+          step.mNameLowerCase.toLower();
+        }
+
+        mSteps.push_back(step);
+      }
+
+      //-----------------------------------------------------------------------
+      bool Path::stepMatches(
+                             const Step &inStep,
+                             const String &inElementName,
+                             bool inCaseSensative
+                             ) noexcept
+      {
+        if (inStep.mName.isEmpty())
+          return true;
+
+        if (inCaseSensative)
+          return inStep.mName == inElementName;
+
+        // compare without creating temporary strings
+        const String &lower = inStep.mNameLowerCase;
+        if (lower.length() != inElementName.length())
+          return false;
+
+        for (size_t loop = 0; loop < lower.length(); ++loop)
+        {
+          if (lower[loop] != static_cast<char>(tolower(static_cast<unsigned char>(inElementName[loop]))))
+            return false;
+        }
+        return true;
+      }
+
+      //-----------------------------------------------------------------------
+      void Path::evaluate(
+                          const NodePtr &inContext,
+                          const RawPathVector &inPaths,
+                          bool inFirstOnly,
+                          RawNodeVector &outFirstResults,
+                          RawNodeVector *outAllResults
+                          ) noexcept
+      {
+        // walks the tree once in a non-recursive way; each depth keeps the
+        // paths whose steps matched every ancestor so far, along with how
+        // many siblings have matched the path's step at that depth (needed
+        // for indexed steps)
+        struct Frame
+        {
+          XML::Node *mNext {};
+          std::vector<size_t> mActive;
+          std::vector<size_t> mMatchedSiblings;
+        };
+
+        outFirstResults.assign(inPaths.size(), NULL);
+
+        if (!inContext)
+          return;
+
+        bool caseSensative = true;
+        {
+          DocumentPtr document = inContext->getDocument();
+          if (document)
+            caseSensative = document->isElementNameIsCaseSensative();
+        }
+
+        size_t maxSteps = 0;
+        size_t remaining = 0;
+
+        std::vector<Frame> frames(1);
+
+        for (size_t index = 0; index < inPaths.size(); ++index)
+        {
+          const Path *path = inPaths[index];
+          if (!path)
+            continue;
+
+          size_t totalSteps = path->mSteps.size();
+          if (0 == totalSteps) {
+            // an empty path refers to the context itself
+            if (inContext->isElement()) {
+              outFirstResults[index] = inContext.get();
+              if (outAllResults)
+                outAllResults->push_back(inContext.get());
+            }
+            continue;
+          }
+
+          maxSteps = (totalSteps > maxSteps ? totalSteps : maxSteps);
+          frames[0].mActive.push_back(index);
+          ++remaining;
+        }
+
+        if (0 == remaining)
+          return;
+
+        frames.resize(maxSteps);
+        frames[0].mMatchedSiblings.assign(frames[0].mActive.size(), 0);
+        frames[0].mNext = inContext->getFirstChild().get();
+
+        size_t depth = 0;
+
+        while (true)
+        {
+          Frame &frame = frames[depth];
+          XML::Node *node = frame.mNext;
+
+          if (!node) {
+            if (0 == depth)
+              break;
+            --depth;
+            continue;
+          }
+
+          frame.mNext = node->mNextSibling.get();
+
+          if (!node->isElement())
+            continue;
+
+          const String &name = static_cast<XML::Element *>(node)->mName;
+
+          Frame *child = NULL;
+          if (depth + 1 < maxSteps) {
+            child = &(frames[depth + 1]);
+            child->mActive.clear();
+          }
+
+          for (size_t loop = 0; loop < frame.mActive.size(); ++loop)
+          {
+            size_t index = frame.mActive[loop];
+            if ((inFirstOnly) &&
+                (outFirstResults[index]))
+              continue;
+
+            const StepVector &steps = inPaths[index]->mSteps;
+            const Step &step = steps[depth];
+
+            if (!stepMatches(step, name, caseSensative))
+              continue;
+
+            size_t position = frame.mMatchedSiblings[loop]++;
+            if ((SIZE_MAX != step.mIndex) &&
+                (position != step.mIndex))
+              continue;
+
+            if (depth + 1 == steps.size()) {
+              if (!outFirstResults[index]) {
+                outFirstResults[index] = node;
+                if (inFirstOnly)
+                  --remaining;
+              }
+              if (outAllResults)
+                outAllResults->push_back(node);
+              continue;
+            }
+
+            child->mActive.push_back(index);
+          }
+
+          if ((inFirstOnly) &&
+              (0 == remaining))
+            break;
+
+          if ((!child) ||
+              (child->mActive.empty()))
+            continue;
+
+          child->mMatchedSiblings.assign(child->mActive.size(), 0);
+          child->mNext = node->mFirstChild.get();
+          ++depth;
+        }
+      }
+
+    } // namespace internal
+
+    //-------------------------------------------------------------------------
+    //-------------------------------------------------------------------------
+    //-------------------------------------------------------------------------
+    //-------------------------------------------------------------------------
+    //
+    // XML::Path
+    //
+
+    //-------------------------------------------------------------------------
+    Path::Path(const make_private &) noexcept
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    PathPtr Path::create(const char *inPath) noexcept
+    {
+      PathPtr pThis(make_shared<Path>(make_private{}));
+      pThis->mPath = String(inPath);
+
+      CSTR pos = inPath ? inPath : "";
+      if ('/' == *pos)
+        ++pos;
+
+      while ('\0' != *pos)
+      {
+        CSTR start = pos;
+        while (('\0' != *pos) && ('/' != *pos) && ('[' != *pos))
+          ++pos;
+
+        String name(start, static_cast<size_t>(pos - start));
+        if (name.isEmpty())
+          return PathPtr();
+
+        size_t index = SIZE_MAX;
+        if ('[' == *pos) {
+          CSTR indexStart = ++pos;
+          while (('\0' != *pos) && (']' != *pos))
+            ++pos;
+
+          if (']' != *pos)
+            return PathPtr();
+
+          if (!parseIndex(indexStart, pos, index))
+            return PathPtr();
+
+          ++pos;
+        }
+
+        pThis->addStep(name, index);
+
+        if ('\0' == *pos)
+          break;
+
+        if ('/' != *pos)
+          return PathPtr();
+
+        ++pos;
+        if ('\0' == *pos)
+          return PathPtr();   // trailing slash
+      }
+
+      return pThis;
+    }
+
+    //-------------------------------------------------------------------------
+    PathPtr Path::createFromJSONPointer(const char *inPointer) noexcept
+    {
+      PathPtr pThis(make_shared<Path>(make_private{}));
+      pThis->mPath = String(inPointer);
+
+      CSTR pos = inPointer ? inPointer : "";
+      if ('\0' == *pos)
+        return pThis;     // the whole document
+
+      if ('/' != *pos)
+        return PathPtr();
+
+      while ('/' == *pos)
+      {
+        ++pos;
+
+        CSTR start = pos;
+        String token;
+        while (('\0' != *pos) && ('/' != *pos))
+        {
+          if ('~' == *pos) {
+            token.append(start, static_cast<size_t>(pos - start));
+            switch (pos[1])
+            {
+              case '0': token.append(1, '~'); break;
+              case '1': token.append(1, '/'); break;
+              default:  return PathPtr();
+            }
+            pos += 2;
+            start = pos;
+            continue;
+          }
+          ++pos;
+        }
+        token.append(start, static_cast<size_t>(pos - start));
+
+        // XML element names cannot start with a digit so a numeric token
+        // always refers to an entry in the array named by the previous token
+        size_t index = SIZE_MAX;
+        if ((pThis->mSteps.size() > 0) &&
+            (SIZE_MAX == pThis->mSteps.back().mIndex) &&
+            (parseIndex(token.c_str(), token.c_str() + token.length(), index))) {
+          pThis->mSteps.back().mIndex = index;
+          continue;
+        }
+
+        if (token.isEmpty())
+          return PathPtr();
+
+        pThis->addStep(token, SIZE_MAX);
+      }
+
+      return pThis;
+    }
+
+    //-------------------------------------------------------------------------
+    const String &Path::getPath() const noexcept
+    {
+      return mPath;
+    }
+
+    //-------------------------------------------------------------------------
+    size_t Path::getStepCount() const noexcept
+    {
+      return mSteps.size();
+    }
+
+    //-------------------------------------------------------------------------
+    ElementPtr Path::findFirst(const NodePtr &inContext) const noexcept
+    {
+      RawPathVector paths(1, this);
+      RawNodeVector results;
+      evaluate(inContext, paths, true, results, NULL);
+
+      if (!results[0])
+        return ElementPtr();
+      return results[0]->toElement();
+    }
+
+    //-------------------------------------------------------------------------
+    ElementPtr Path::findFirstChecked(const NodePtr &inContext) const noexcept(false)
+    {
+      ElementPtr result = findFirst(inContext);
+      ZS_THROW_CUSTOM_IF(Exceptions::CheckFailed, !result)
+      return result;
+    }
+
+    //-------------------------------------------------------------------------
+    size_t Path::findAll(const NodePtr &inContext, ElementList &outResults) const noexcept
+    {
+      RawPathVector paths(1, this);
+      RawNodeVector firstResults;
+      RawNodeVector allResults;
+      evaluate(inContext, paths, false, firstResults, &allResults);
+
+      for (auto iter = allResults.begin(); iter != allResults.end(); ++iter)
+      {
+        outResults.push_back((*iter)->toElement());
+      }
+      return allResults.size();
+    }
+
+    //-------------------------------------------------------------------------
+    void Path::findFirst(
+                         const NodePtr &inContext,
+                         const PathList &inPaths,
+                         ElementVector &outResults
+                         ) noexcept
+    {
+      RawPathVector paths;
+      paths.reserve(inPaths.size());
+      for (auto iter = inPaths.begin(); iter != inPaths.end(); ++iter)
+      {
+        paths.push_back((*iter).get());
+      }
+
+      RawNodeVector results;
+      evaluate(inContext, paths, true, results, NULL);
+
+      outResults.clear();
+      outResults.reserve(results.size());
+      for (auto iter = results.begin(); iter != results.end(); ++iter)
+      {
+        outResults.push_back(*iter ? (*iter)->toElement() : ElementPtr());
+      }
+    }
+
+  } // namespace XML
+
+} // namespace zsLib
+
+#pragma warning(pop)
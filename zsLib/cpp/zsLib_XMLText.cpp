@@ -42,6 +42,18 @@ namespace zsLib
 
     namespace internal
     {
+      //-----------------------------------------------------------------------
+      static size_t writeRaw(char * &ioPos, const String &inValue) noexcept
+      {
+        size_t length = inValue.length();
+        if (NULL == ioPos)
+          return length;
+
+        memcpy(ioPos, inValue.c_str(), length + 1);
+        ioPos += length;
+        return length;
+      }
+
       //-----------------------------------------------------------------------
       //-----------------------------------------------------------------------
       //-----------------------------------------------------------------------
@@ -128,14 +140,13 @@ namespace zsLib
           outputFormat = XML::Text::Format_EntityEncoded;
         }
 
-        String value = getValueInFormat(outputFormat, normalizeCDATA, encode0xDCharactersInText);
-
         size_t result = 0;
 
         if (XML::Text::Format_CDATA == outputFormat)
           result += strlen("<![CDATA[");
 
-        result += value.length();
+        char *sizeOnly = NULL;
+        result += writeValueInFormat(sizeOnly, outputFormat, normalizeCDATA, encode0xDCharactersInText);
 
         if (XML::Text::Format_CDATA == outputFormat)
           result += strlen("]]>");
@@ -163,12 +174,10 @@ namespace zsLib
           outputFormat = XML::Text::Format_EntityEncoded;
         }
 
-        String value = getValueInFormat(outputFormat, normalizeCDATA, encode0xDCharactersInText);
-
         if (XML::Text::Format_CDATA == outputFormat)
           Generator::writeBuffer(ioPos, "<![CDATA[");
 
-        Generator::writeBuffer(ioPos, value);
+        writeValueInFormat(ioPos, outputFormat, normalizeCDATA, encode0xDCharactersInText);
 
         if (XML::Text::Format_CDATA == outputFormat)
           Generator::writeBuffer(ioPos, "]]>");
@@ -178,20 +187,15 @@ namespace zsLib
       size_t Text::getOutputSizeJSON(const GeneratorPtr &inGenerator) const noexcept
       {
         bool normalizeCDATA = (0 != (XML::Generator::XMLWriteFlag_NormalizeCDATA & inGenerator->getXMLWriteFlags()));
-        String value = getValueInFormat(XML::Text::Format_JSONNumberEncoded == mFormat ? XML::Text::Format_JSONNumberEncoded : XML::Text::Format_JSONStringEncoded, normalizeCDATA);
-
-        size_t result = 0;
-        result += value.length();
-        return result;
+        char *sizeOnly = NULL;
+        return writeValueInFormat(sizeOnly, XML::Text::Format_JSONNumberEncoded == mFormat ? XML::Text::Format_JSONNumberEncoded : XML::Text::Format_JSONStringEncoded, normalizeCDATA);
       }
 
       //-----------------------------------------------------------------------
       void Text::writeBufferJSON(const GeneratorPtr &inGenerator, char * &ioPos) const noexcept
       {
         bool normalizeCDATA = (0 != (XML::Generator::XMLWriteFlag_NormalizeCDATA & inGenerator->getXMLWriteFlags()));
-
-        String value = getValueInFormat(XML::Text::Format_JSONNumberEncoded == mFormat ? XML::Text::Format_JSONNumberEncoded : XML::Text::Format_JSONStringEncoded, normalizeCDATA);
-        Generator::writeBuffer(ioPos, value);
+        writeValueInFormat(ioPos, XML::Text::Format_JSONNumberEncoded == mFormat ? XML::Text::Format_JSONNumberEncoded : XML::Text::Format_JSONStringEncoded, normalizeCDATA);
       }
 
       //-----------------------------------------------------------------------
@@ -262,6 +266,61 @@ namespace zsLib
         return value;
       }
 
+      //-----------------------------------------------------------------------
+      size_t Text::writeValueInFormat(
+                                      char * &ioPos,
+                                      UINT outputFormat,
+                                      bool normalize,
+                                      bool encode0xDCharactersInText
+                                      ) const noexcept
+      {
+        XML::Text::Formats inFormat = static_cast<XML::Text::Formats>(mFormat);
+
+        // normalizing CDATA leaves the value as is
+        if (XML::Text::Format_CDATA == inFormat)
+          normalize = false;
+
+        // escape straight from the stored value into the output when no
+        // intermediate conversion is needed
+        if (!normalize) {
+          switch (static_cast<XML::Text::Formats>(outputFormat))
+          {
+            case XML::Text::Format_EntityEncoded:
+            {
+              if (XML::Text::Format_EntityEncoded == inFormat) return writeRaw(ioPos, mValue);
+              if (XML::Text::Format_CDATA == inFormat) return Parser::writeTextEntitySafe(ioPos, mValue.c_str(), mValue.length(), encode0xDCharactersInText);
+              break;
+            }
+            case XML::Text::Format_CDATA:
+            {
+              if (XML::Text::Format_CDATA == inFormat) return writeRaw(ioPos, mValue);
+              break;
+            }
+            case XML::Text::Format_JSONStringEncoded:
+            case XML::Text::Format_JSONNumberEncoded:
+            {
+              switch (inFormat)
+              {
+                case XML::Text::Format_JSONStringEncoded:
+                case XML::Text::Format_JSONNumberEncoded: return writeRaw(ioPos, mValue);
+                case XML::Text::Format_CDATA:             return Parser::writeJSONEncoded(ioPos, mValue.c_str(), mValue.length());
+                case XML::Text::Format_EntityEncoded:
+                {
+                  // without entities the decoded value is the stored value
+                  if (String::npos == mValue.find('&'))
+                    return Parser::writeJSONEncoded(ioPos, mValue.c_str(), mValue.length());
+                  break;
+                }
+              }
+              break;
+            }
+          }
+        }
+
+        String value = getValueInFormat(outputFormat, normalize, encode0xDCharactersInText);
+        return writeRaw(ioPos, value);
+      }
+
     } // namespace internal
 
     //-------------------------------------------------------------------------
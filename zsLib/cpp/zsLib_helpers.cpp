@@ -51,6 +51,9 @@
 
 #include <zsLib/internal/zsLib_MessageQueueThreadUsingCurrentGUIMessageQueueForCppWinrt.h>
 
+#include <atomic>
+#include <random>
+
 #ifdef _WIN32
 namespace std {
   //---------------------------------------------------------------------------
@@ -94,13 +97,6 @@ namespace zsLib {
       }
     }
 #endif //HAVE_RAISEEXCEPTION
-
-    //-------------------------------------------------------------------------
-    void uuid_generate_random(zsLib::internal::uuid_wrapper::raw_uuid_type &uuid) {
-      ZS_MAYBE_USED() auto result = CoCreateGuid(&uuid);
-      ZS_MAYBE_USED(result);
-      ZS_ASSERT(S_OK == result);
-    }
   }
 
   using namespace zsLib::compatibility;
@@ -141,6 +137,190 @@ namespace zsLib
     void installSocketMonitorSettingsDefaults() noexcept;
     void installMessageQueueManagerSettingsDefaults() noexcept;
 
+    //-------------------------------------------------------------------------
+    //-------------------------------------------------------------------------
+    //-------------------------------------------------------------------------
+    //-------------------------------------------------------------------------
+    //
+    // UUIDGenerator
+    //
+
+    // bumped in a forked child so no thread continues the parent's keystream
+    static std::atomic<ULONG> gUUIDGeneratorGeneration {};
+
+#ifdef HAVE_PTHREAD_H
+    //-------------------------------------------------------------------------
+    static void uuidGeneratorForkChild() noexcept
+    {
+      ++gUUIDGeneratorGeneration;
+    }
+#endif //HAVE_PTHREAD_H
+
+    // Per thread ChaCha20 keystream seeded from the operating system's
+    // entropy source. Every refill re-keys the cipher from its own output
+    // (fast key erasure) so earlier UUIDs cannot be recovered from the
+    // state. Trivially destructible so it is usable during static cleanup.
+    class UUIDGenerator
+    {
+    public:
+      //-----------------------------------------------------------------------
+      static UUIDGenerator &singleton() noexcept
+      {
+        static thread_local UUIDGenerator generator;
+        return generator;
+      }
+
+      //-----------------------------------------------------------------------
+      // version 4, i.e. 122 random bits
+      void random(UCHAR (&outBytes)[16]) noexcept
+      {
+        fill(outBytes);
+        outBytes[6] = static_cast<UCHAR>(0x40 | (outBytes[6] & 0x0F));
+        outBytes[8] = static_cast<UCHAR>(0x80 | (outBytes[8] & 0x3F));
+      }
+
+      //-----------------------------------------------------------------------
+      // version 7, i.e. 48 bit unix milliseconds followed by a 12 bit
+      // sequence (so IDs minted by a thread keep increasing even within one
+      // millisecond) and 62 random bits
+      void timeOrdered(UCHAR (&outBytes)[16]) noexcept
+      {
+        fill(outBytes);
+
+        QWORD milliseconds = static_cast<QWORD>(std::chrono::duration_cast<Milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+        if (milliseconds <= mLastMilliseconds) {
+          milliseconds = mLastMilliseconds;
+          if (++mSequence > 0xFFF) {
+            ++milliseconds;   // borrow from the next millisecond
+            mSequence = 0;
+          }
+        } else {
+          mSequence = ((static_cast<WORD>(outBytes[6]) << 8) | outBytes[7]) & 0x7FF;  // leave room to count up
+        }
+        mLastMilliseconds = milliseconds;
+
+        for (size_t index = 0; index < 6; ++index) {
+          outBytes[index] = static_cast<UCHAR>(milliseconds >> (8 * (5 - index)));
+        }
+        outBytes[6] = static_cast<UCHAR>(0x70 | ((mSequence >> 8) & 0x0F));
+        outBytes[7] = static_cast<UCHAR>(mSequence & 0xFF);
+        outBytes[8] = static_cast<UCHAR>(0x80 | (outBytes[8] & 0x3F));
+      }
+
+    protected:
+      enum Sizes
+      {
+        Sizes_BlockWords = 16,
+        Sizes_Blocks = 8,
+        Sizes_KeyWords = 8,
+        Sizes_BufferBytes = Sizes_Blocks * Sizes_BlockWords * sizeof(DWORD),
+      };
+
+      //-----------------------------------------------------------------------
+      UUIDGenerator() noexcept
+      {
+#ifdef HAVE_PTHREAD_H
+        static bool registered = (0 == pthread_atfork(NULL, NULL, &uuidGeneratorForkChild));
+        ZS_MAYBE_USED(registered);
+#endif //HAVE_PTHREAD_H
+        seed();
+      }
+
+      //-----------------------------------------------------------------------
+      void seed() noexcept
+      {
+        std::random_device device;
+        for (size_t index = 0; index < Sizes_KeyWords; ++index) {
+          mKey[index] = static_cast<DWORD>(device());
+        }
+        mNonce[0] = static_cast<DWORD>(device());
+        mNonce[1] = static_cast<DWORD>(device());
+        mCounter = 0;
+        mPosition = Sizes_BufferBytes;
+        mGeneration = gUUIDGeneratorGeneration.load(std::memory_order_relaxed);
+      }
+
+      //-----------------------------------------------------------------------
+      void fill(UCHAR (&outBytes)[16]) noexcept
+      {
+        if (mGeneration != gUUIDGeneratorGeneration.load(std::memory_order_relaxed)) seed();
+        if (mPosition + sizeof(outBytes) > Sizes_BufferBytes) refill();
+
+        memcpy(&(outBytes[0]), &(mBuffer[mPosition]), sizeof(outBytes));
+        memset(&(mBuffer[mPosition]), 0, sizeof(outBytes));
+        mPosition += sizeof(outBytes);
+      }
+
+      //-----------------------------------------------------------------------
+      void refill() noexcept
+      {
+        for (size_t block = 0; block < Sizes_Blocks; ++block) {
+          DWORD state[Sizes_BlockWords] = {
+            0x61707865, 0x3320646e, 0x79622d32, 0x6b206574,   // "expand 32-byte k"
+            mKey[0], mKey[1], mKey[2], mKey[3], mKey[4], mKey[5], mKey[6], mKey[7],
+            static_cast<DWORD>(mCounter), static_cast<DWORD>(mCounter >> 32), mNonce[0], mNonce[1]
+          };
+          ++mCounter;
+
+          DWORD working[Sizes_BlockWords];
+          memcpy(&(working[0]), &(state[0]), sizeof(working));
+          for (int round = 0; round < 10; ++round) {
+            quarterRound(working, 0, 4, 8, 12);
+            quarterRound(working, 1, 5, 9, 13);
+            quarterRound(working, 2, 6, 10, 14);
+            quarterRound(working, 3, 7, 11, 15);
+            quarterRound(working, 0, 5, 10, 15);
+            quarterRound(working, 1, 6, 11, 12);
+            quarterRound(working, 2, 7, 8, 13);
+            quarterRound(working, 3, 4, 9, 14);
+          }
+
+          BYTE *output = &(mBuffer[block * Sizes_BlockWords * sizeof(DWORD)]);
+          for (size_t index = 0; index < Sizes_BlockWords; ++index) {
+            DWORD value = working[index] + state[index];
+            output[(index * 4)] = static_cast<BYTE>(value);
+            output[(index * 4) + 1] = static_cast<BYTE>(value >> 8);
+            output[(index * 4) + 2] = static_cast<BYTE>(value >> 16);
+            output[(index * 4) + 3] = static_cast<BYTE>(value >> 24);
+          }
+        }
+
+        // the start of the keystream becomes the next key and is never handed out
+        for (size_t index = 0; index < Sizes_KeyWords; ++index) {
+          mKey[index] = (static_cast<DWORD>(mBuffer[(index * 4)])) |
+                        (static_cast<DWORD>(mBuffer[(index * 4) + 1]) << 8) |
+                        (static_cast<DWORD>(mBuffer[(index * 4) + 2]) << 16) |
+                        (static_cast<DWORD>(mBuffer[(index * 4) + 3]) << 24);
+        }
+        memset(&(mBuffer[0]), 0, Sizes_KeyWords * sizeof(DWORD));
+        mPosition = Sizes_KeyWords * sizeof(DWORD);
+      }
+
+      //-----------------------------------------------------------------------
+      static DWORD rotate(DWORD value, int bits) noexcept {return (value << bits) | (value >> (32 - bits));}
+
+      //-----------------------------------------------------------------------
+      static void quarterRound(DWORD (&x)[Sizes_BlockWords], size_t a, size_t b, size_t c, size_t d) noexcept
+      {
+        x[a] += x[b]; x[d] = rotate(x[d] ^ x[a], 16);
+        x[c] += x[d]; x[b] = rotate(x[b] ^ x[c], 12);
+        x[a] += x[b]; x[d] = rotate(x[d] ^ x[a], 8);
+        x[c] += x[d]; x[b] = rotate(x[b] ^ x[c], 7);
+      }
+
+    protected:
+      DWORD mKey[Sizes_KeyWords] {};
+      DWORD mNonce[2] {};
+      QWORD mCounter {};
+
+      BYTE mBuffer[Sizes_BufferBytes] {};
+      size_t mPosition {Sizes_BufferBytes};
+      ULONG mGeneration {};
+
+      QWORD mLastMilliseconds {};
+      WORD mSequence {};
+    };
+
     //-------------------------------------------------------------------------
     //-------------------------------------------------------------------------
     //-------------------------------------------------------------------------
@@ -189,12 +369,27 @@ namespace zsLib
       }
 
       //-----------------------------------------------------------------------
+      // every thread reserves a block of IDs with a single atomic add and
+      // hands them out locally, i.e. IDs remain unique and increase per
+      // thread without all threads contending on the same cache line
       PUID createPUID() noexcept
       {
-        return ++mID;
+        static thread_local PUID tNext {};
+        static thread_local PUID tEnd {};
+
+        if (tNext == tEnd) {
+          tNext = static_cast<PUID>(mID.fetch_add(Sizes_PUIDBlock)) + 1;
+          tEnd = tNext + Sizes_PUIDBlock;
+        }
+        return tNext++;
       }
 
     protected:
+      enum Sizes
+      {
+        Sizes_PUIDBlock = (sizeof(PUID) >= sizeof(QWORD) ? 4096 : 256),   // smaller blocks when PUID is 32 bits
+      };
+
       std::atomic_ulong mID {};
     };
 
@@ -224,11 +419,47 @@ namespace zsLib
   //---------------------------------------------------------------------------
   UUID createUUID() noexcept
   {
+    UCHAR bytes[16];
+    internal::UUIDGenerator::singleton().random(bytes);
+
     UUID gen;
-    uuid_generate_random(gen.mUUID);
+    gen.setBytes(bytes);
     return gen;
   }
 
+  //---------------------------------------------------------------------------
+  UUID createTimeOrderedUUID() noexcept
+  {
+    UCHAR bytes[16];
+    internal::UUIDGenerator::singleton().timeOrdered(bytes);
+
+    UUID gen;
+    gen.setBytes(bytes);
+    return gen;
+  }
+
+  //---------------------------------------------------------------------------
+  void createUUIDs(
+                   UUID *outUUIDs,
+                   size_t count,
+                   bool timeOrdered
+                   ) noexcept
+  {
+    if (!outUUIDs) return;
+
+    internal::UUIDGenerator &generator = internal::UUIDGenerator::singleton();
+
+    UCHAR bytes[16];
+    for (size_t index = 0; index < count; ++index) {
+      if (timeOrdered) {
+        generator.timeOrdered(bytes);
+      } else {
+        generator.random(bytes);
+      }
+      outUUIDs[index].setBytes(bytes);
+    }
+  }
+
   //---------------------------------------------------------------------------
   void debugSetCurrentThreadName(const char *name) noexcept
   {
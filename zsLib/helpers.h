@@ -37,8 +37,14 @@
 namespace zsLib
 {
   //---------------------------------------------------------------------------
-  PUID createPUID() noexcept;
-  UUID createUUID() noexcept;
+  PUID createPUID() noexcept;     // unique, increasing per thread (not across threads)
+  UUID createUUID() noexcept;                 // random (version 4)
+  UUID createTimeOrderedUUID() noexcept;      // version 7, sorts by creation time (increasing per thread)
+  void createUUIDs(
+                   UUID *outUUIDs,
+                   size_t count,
+                   bool timeOrdered = false
+                   ) noexcept;
 
   //---------------------------------------------------------------------------
   void debugSetCurrentThreadName(const char *name) noexcept;
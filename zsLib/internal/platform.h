@@ -46,9 +46,13 @@
 #undef HAVE_SOCKADDR_IN_LEN
 #undef HAVE_PTHREAD_SETNAME_WITH_1
 #undef HAVE_PTHREAD_SETNAME_WITH_2
+#undef HAVE_PTHREAD_SETAFFINITY_NP
+#undef HAVE_SYSFS_NUMA_TOPOLOGY
+#undef HAVE_WIN32_THREAD_AFFINITY
 #undef HAVE_RAISEEXCEPTION
 #undef HAVE_SPRINTF_S
 #undef HAVE_STRCPY_S
+#undef HAVE_STD_CHARCONV_FLOAT
 
 #ifdef _WIN32
 
@@ -59,6 +63,7 @@
 #define HAVE_RAISEEXCEPTION 1
 #define HAVE_SPRINTF_S 1
 #define HAVE_STRCPY_S 1
+#define HAVE_WIN32_THREAD_AFFINITY 1
 
 #if defined(WINUWP) || defined(WIN32_RX64)
 
@@ -66,6 +71,7 @@
 
 // WINUWP does not support these features (but WIN32 does)
 #undef HAVE_IF_NAMETOINDEX
+#undef HAVE_WIN32_THREAD_AFFINITY
 
 #if defined(WINAPI_FAMILY) && (WINAPI_FAMILY == WINAPI_FAMILY_PHONE_APP || defined(WIN32_RX64))
 
@@ -108,14 +114,32 @@
 #define HAVE_PTHREAD_H 1
 #define HAVE_IF_NAMETOINDEX 1
 #define HAVE_PTHREAD_SETNAME_WITH_2 1
+#define HAVE_PTHREAD_SETAFFINITY_NP 1
+#define HAVE_SYSFS_NUMA_TOPOLOGY 1
 
 #ifdef ANDROID
 
 // Android supports these additional features
 
 // Android does not support these features
+#undef HAVE_PTHREAD_SETAFFINITY_NP
 
 #endif //ANDROID
 #endif //__linux__
 
+
+// std::to_chars / std::from_chars for floating point types is a C++17 library
+// feature which is not available on every supported standard library
+#if (__cplusplus >= 201703L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 201703L))
+#ifdef __has_include
+#if __has_include(<charconv>)
+#include <charconv>
+#endif //__has_include(<charconv>)
+#endif //__has_include
+#endif //(__cplusplus >= 201703L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 201703L))
+
+#if defined(__cpp_lib_to_chars) && (__cpp_lib_to_chars >= 201611L)
+#define HAVE_STD_CHARCONV_FLOAT 1
+#endif //defined(__cpp_lib_to_chars) && (__cpp_lib_to_chars >= 201611L)
+
 #endif //ZSLIB_INTERNAL_PLATFORM_H_ae1ca1614cb82fd6e3e9751af73f2658
@@ -531,6 +531,34 @@ namespace zsLib
       bool operator>=(const uuid_wrapper &op2) const {
         return uuid_compare(mUUID, op2.mUUID) >= 0;
       }
+
+      // bytes in RFC 4122 (string) order regardless of the platform layout
+      void getBytes(UCHAR (&outBytes)[16]) const {
+#ifndef _WIN32
+        memcpy(&(outBytes[0]), &(mUUID[0]), sizeof(outBytes));
+#else
+        outBytes[0] = static_cast<UCHAR>(mUUID.Data1 >> 24);
+        outBytes[1] = static_cast<UCHAR>(mUUID.Data1 >> 16);
+        outBytes[2] = static_cast<UCHAR>(mUUID.Data1 >> 8);
+        outBytes[3] = static_cast<UCHAR>(mUUID.Data1);
+        outBytes[4] = static_cast<UCHAR>(mUUID.Data2 >> 8);
+        outBytes[5] = static_cast<UCHAR>(mUUID.Data2);
+        outBytes[6] = static_cast<UCHAR>(mUUID.Data3 >> 8);
+        outBytes[7] = static_cast<UCHAR>(mUUID.Data3);
+        memcpy(&(outBytes[8]), &(mUUID.Data4[0]), 8);
+#endif //ndef _WIN32
+      }
+
+      void setBytes(const UCHAR (&bytes)[16]) {
+#ifndef _WIN32
+        memcpy(&(mUUID[0]), &(bytes[0]), sizeof(bytes));
+#else
+        mUUID.Data1 = (static_cast<unsigned long>(bytes[0]) << 24) | (static_cast<unsigned long>(bytes[1]) << 16) | (static_cast<unsigned long>(bytes[2]) << 8) | static_cast<unsigned long>(bytes[3]);
+        mUUID.Data2 = static_cast<unsigned short>((bytes[4] << 8) | bytes[5]);
+        mUUID.Data3 = static_cast<unsigned short>((bytes[6] << 8) | bytes[7]);
+        memcpy(&(mUUID.Data4[0]), &(bytes[8]), 8);
+#endif //ndef _WIN32
+      }
     };
   }
 
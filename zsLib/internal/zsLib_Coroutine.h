@@ -0,0 +1,243 @@
+/*
+
+ Copyright (c) 2016, Robin Raymond
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation
+ and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ The views and conclusions contained in the software and documentation are those
+ of the authors and should not be interpreted as representing official policies,
+ either expressed or implied, of the FreeBSD Project.
+ 
+ */
+
+#pragma once
+
+#ifndef ZSLIB_INTERNAL_COROUTINE_H_5b0d2f7c94e14a1d8c3e61f0a27b9d4e
+#define ZSLIB_INTERNAL_COROUTINE_H_5b0d2f7c94e14a1d8c3e61f0a27b9d4e
+
+#include <zsLib/types.h>
+#include <zsLib/IMessageQueue.h>
+
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#if __has_include(<coroutine>)
+#define ZSLIB_COROUTINES 1
+#endif //__has_include(<coroutine>)
+#endif //defined(__cpp_impl_coroutine) && defined(__has_include)
+
+#ifdef ZSLIB_COROUTINES
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace zsLib
+{
+  namespace internal
+  {
+    //-------------------------------------------------------------------------
+    // recycles coroutine frames per thread in 64 byte size classes; a frame
+    // freed on another thread simply joins that thread's cache
+    class CoroutineFrameAllocator
+    {
+    public:
+      enum Sizes
+      {
+        Granularity = 64,
+        TotalClasses = 16,                      // frames up to 1KB are cached
+        MaxCachedPerClass = 64,
+      };
+
+      static void *allocate(size_t size) noexcept(false)
+      {
+        size_t sizeClass = (size + sizeof(Header) + Granularity - 1) / Granularity;
+
+        if (sizeClass < TotalClasses) {
+          Cache &cache = threadCache();
+          FreeFrame *frame = cache.mFree[sizeClass];
+          if (frame) {
+            cache.mFree[sizeClass] = frame->mNext;
+            --cache.mTotal[sizeClass];
+            return prepare(frame, sizeClass);
+          }
+          return prepare(::operator new(sizeClass * Granularity), sizeClass);
+        }
+        return prepare(::operator new(size + sizeof(Header)), 0);
+      }
+
+      static void deallocate(void *memory) noexcept
+      {
+        if (!memory) return;
+
+        Header *header = static_cast<Header *>(memory) - 1;
+        size_t sizeClass = header->mSizeClass;
+
+        if (0 != sizeClass) {
+          Cache &cache = threadCache();
+          if (cache.mTotal[sizeClass] < MaxCachedPerClass) {
+            FreeFrame *frame = reinterpret_cast<FreeFrame *>(header);
+            frame->mNext = cache.mFree[sizeClass];
+            cache.mFree[sizeClass] = frame;
+            ++cache.mTotal[sizeClass];
+            return;
+          }
+        }
+        ::operator delete(header);
+      }
+
+    protected:
+      union Header
+      {
+        size_t mSizeClass;
+        std::max_align_t mAlign;
+      };
+
+      struct FreeFrame
+      {
+        FreeFrame *mNext;
+      };
+
+      struct Cache
+      {
+        FreeFrame *mFree[TotalClasses] {};
+        size_t mTotal[TotalClasses] {};
+
+        ~Cache() noexcept
+        {
+          for (size_t index = 0; index < TotalClasses; ++index) {
+            while (mFree[index]) {
+              FreeFrame *frame = mFree[index];
+              mFree[index] = frame->mNext;
+              ::operator delete(frame);
+            }
+          }
+        }
+      };
+
+      static Cache &threadCache() noexcept
+      {
+        thread_local Cache cache;
+        return cache;
+      }
+
+      static void *prepare(void *memory, size_t sizeClass) noexcept
+      {
+        Header *header = static_cast<Header *>(memory);
+        header->mSizeClass = sizeClass;
+        return header + 1;
+      }
+    };
+
+    //-------------------------------------------------------------------------
+    class CoroutineResumeMessage : public IMessageQueueMessage
+    {
+    public:
+      explicit CoroutineResumeMessage(std::coroutine_handle<> handle) noexcept : mHandle(handle) {}
+
+      const char *getDelegateName() const noexcept override {return "zsLib::coroutine";}
+      const char *getMethodName() const noexcept override {return "resume";}
+      void processMessage() noexcept override {mHandle.resume();}
+
+    protected:
+      std::coroutine_handle<> mHandle;
+    };
+
+    //-------------------------------------------------------------------------
+    class CoroutineQueueAwaiter
+    {
+    public:
+      explicit CoroutineQueueAwaiter(IMessageQueuePtr queue) noexcept : mQueue(queue) {}
+
+      bool await_ready() const noexcept {return (!mQueue) || (mQueue->isCurrentThread());}
+      void await_suspend(std::coroutine_handle<> handle) noexcept(false) {mQueue->post(IMessageQueueMessageUniPtr(new CoroutineResumeMessage(handle)));}
+      void await_resume() const noexcept {}
+
+    protected:
+      IMessageQueuePtr mQueue;
+    };
+
+    //-------------------------------------------------------------------------
+    template <typename PROMISE_TYPE>
+    class CoroutinePromiseAwaiter
+    {
+    public:
+      typedef std::shared_ptr<PROMISE_TYPE> PromiseTypePtr;
+
+      explicit CoroutinePromiseAwaiter(const PromiseTypePtr &promise) noexcept : mPromise(promise) {}
+
+      bool await_ready() const noexcept {return (!mPromise) || (mPromise->isSettled());}
+      void await_suspend(std::coroutine_handle<> handle) noexcept {mPromise->thenMessage(IMessageQueueMessageUniPtr(new CoroutineResumeMessage(handle)));}
+      PromiseTypePtr await_resume() const noexcept {return mPromise;}
+
+    protected:
+      PromiseTypePtr mPromise;
+    };
+
+    //-------------------------------------------------------------------------
+    // coroutine state for a coroutine returning a promise pointer
+    template <typename PROMISE_TYPE>
+    class CoroutinePromise
+    {
+    public:
+      typedef std::shared_ptr<PROMISE_TYPE> PromiseTypePtr;
+
+      CoroutinePromise() noexcept : mPromise(PROMISE_TYPE::create()) {}
+
+      static void *operator new(size_t size) noexcept(false) {return CoroutineFrameAllocator::allocate(size);}
+      static void operator delete(void *memory) noexcept {CoroutineFrameAllocator::deallocate(memory);}
+
+      PromiseTypePtr get_return_object() const noexcept {return mPromise;}
+
+      std::suspend_never initial_suspend() const noexcept {return {};}
+      std::suspend_never final_suspend() const noexcept {return {};}
+
+      template <typename VALUE>
+      void return_value(VALUE &&value) noexcept {mPromise->resolve(std::forward<VALUE>(value));}
+
+      void unhandled_exception() noexcept
+      {
+        auto reason = std::make_shared< AnyHolder<std::exception_ptr> >();
+        reason->value_ = std::current_exception();
+        static_cast<zsLib::Promise &>(*mPromise).reject(reason);
+      }
+
+    protected:
+      PromiseTypePtr mPromise;
+    };
+  }
+}
+
+namespace std
+{
+  template <typename PROMISE_TYPE, typename... ARGS>
+    requires std::is_base_of_v<zsLib::Promise, PROMISE_TYPE>
+  struct coroutine_traits<std::shared_ptr<PROMISE_TYPE>, ARGS...>
+  {
+    typedef zsLib::internal::CoroutinePromise<PROMISE_TYPE> promise_type;
+  };
+}
+
+#endif //ZSLIB_COROUTINES
+
+#endif //ZSLIB_INTERNAL_COROUTINE_H_5b0d2f7c94e14a1d8c3e61f0a27b9d4e
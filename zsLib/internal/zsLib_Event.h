@@ -39,6 +39,10 @@
 #define ZSLIB_INTERNAL_USE_WIN32_EVENT
 #endif //_WIN32
 
+#if (defined(__linux__) && !defined(ZSLIB_INTERNAL_USE_WIN32_EVENT))
+#define ZSLIB_INTERNAL_USE_FUTEX_EVENT
+#endif //(defined(__linux__) && !defined(ZSLIB_INTERNAL_USE_WIN32_EVENT))
+
 namespace zsLib
 {
   namespace internal
@@ -51,15 +55,27 @@ namespace zsLib
 
       Event(const Event &) = delete;
 
+    protected:
+#ifndef ZSLIB_INTERNAL_USE_WIN32_EVENT
+      bool trySpin() noexcept;
+      bool tryConsume() noexcept;
+      bool park(const Time *deadline = NULL) noexcept;
+      void wake() noexcept;
+#endif //ndef ZSLIB_INTERNAL_USE_WIN32_EVENT
+
     protected:
 #ifdef ZSLIB_INTERNAL_USE_WIN32_EVENT
       HANDLE mEvent {};
 #else
       bool mManualReset {};
-      std::atomic_bool mNotified {};
+      std::atomic<uint32_t> mState {};          // 1 when notified (the futex word on linux)
+      std::atomic<uint32_t> mWaiters {};        // threads parked (or about to park) in wait()
+      std::atomic<uint32_t> mSpinLimit {};      // adaptive spin budget before parking
+#ifndef ZSLIB_INTERNAL_USE_FUTEX_EVENT
       std::mutex mMutex;
       std::condition_variable mCondition;
-#endif
+#endif //ndef ZSLIB_INTERNAL_USE_FUTEX_EVENT
+#endif //ZSLIB_INTERNAL_USE_WIN32_EVENT
     };
   }
 }
@@ -36,13 +36,21 @@
 
 #include <zsLib/types.h>
 #include <zsLib/IMessageQueue.h>
+#include <zsLib/internal/zsLib_MessageQueueStatistics.h>
 
+#include <atomic>
+#include <condition_variable>
+#include <map>
 #include <queue>
+#include <thread>
+#include <vector>
 
 namespace zsLib
 {
   namespace internal
   {
+    ZS_DECLARE_CLASS_PTR(MessageQueueDeadlineTimer)
+
     //-------------------------------------------------------------------------
     //-------------------------------------------------------------------------
     //-------------------------------------------------------------------------
@@ -56,6 +64,7 @@ namespace zsLib
     protected:
       struct make_private {};
       friend interaction IMessageQueue;
+      friend class MessageQueueDeadlineTimer;
 
     public:
       MessageQueue(
@@ -70,13 +79,26 @@ namespace zsLib
       // MessageQueue => IMessageQueue
       // 
 
-      static MessageQueuePtr create(IMessageQueueNotifyPtr notify) noexcept;
+      static MessageQueuePtr create(
+                                    IMessageQueueNotifyPtr notify,
+                                    const MessageQueueCapacity &capacity = MessageQueueCapacity()
+                                    ) noexcept;
 
       void post(IMessageQueueMessageUniPtr message) noexcept(false) override;
+      void postBatch(MessageList &messages) noexcept(false) override;
+
+      void postAt(
+                  IMessageQueueMessageUniPtr message,
+                  const Time &deadline
+                  ) noexcept(false) override;
 
       size_type getTotalUnprocessedMessages() const noexcept override;
 
-      virtual bool isCurrentThread() const noexcept { return false; }
+      void setCapacity(const MessageQueueCapacity &capacity) noexcept override;
+      MessageQueueCapacity getCapacity() const noexcept override;
+      MessageQueueCounters getCounters() const noexcept override;
+
+      bool isCurrentThread() const noexcept override;
 
     public:
       //-----------------------------------------------------------------------
@@ -87,15 +109,102 @@ namespace zsLib
       void process() noexcept;
       void processOnlyOneMessage() noexcept;
 
+      void setName(const char *name) noexcept;
+
+      Time getNextDeadline() const noexcept;    // Time() when nothing is delayed
+
+    protected:
+      //-----------------------------------------------------------------------
+      //
+      // MessageQueue => (internal)
+      //
+
+      struct PendingMessage
+      {
+        IMessageQueueMessageUniPtr mMessage;
+        MessageQueueStatistics::TimePoint mPosted;    // only set while statistics are enabled
+        bool mCoalescable {};                         // registered in mCoalescing while waiting
+      };
+
+      ZS_DECLARE_TYPEDEF_PTR(std::queue<PendingMessage>, MessageLane);
+
+      typedef std::map<MessageCoalesceKey, PendingMessage *> CoalesceMap;   // lane elements keep their address until popped
+
+      struct DelayedMessage
+      {
+        Time mDeadline;
+        ULONGLONG mOrder {};                      // keeps equal deadlines in posting order
+        PendingMessage mPending;
+
+        bool operator<(const DelayedMessage &other) const noexcept {return (mDeadline == other.mDeadline ? mOrder > other.mOrder : mDeadline > other.mDeadline);}
+      };
+
+      typedef std::vector<DelayedMessage> DelayedMessageHeap;
+
+      enum Lanes
+      {
+        Lane_Low,
+        Lane_Normal,
+        Lane_High,
+
+        Lane_Total,
+      };
+
+      void processMessage(PendingMessage &pending) noexcept;
+
+      bool popNextMessage(PendingMessage &outPending) noexcept;   // requires mLock
+      PendingMessage &pushMessage(PendingMessage &pending) noexcept;   // requires mLock
+      void forgetCoalescable(PendingMessage &pending) noexcept;         // requires mLock
+      void promoteDueMessages() noexcept;                         // requires mLock
+
+      bool admitMessage(
+                        PendingMessage &pending,
+                        PendingMessage &outDiscarded,
+                        std::unique_lock<Lock> &lock,
+                        bool &ioUnnotified                   // messages queued by this post but not yet notified
+                        ) noexcept(false);                   // requires mLock, false when nothing new was queued
+
+      bool makeRoom(
+                    PendingMessage &pending,
+                    PendingMessage &outDiscarded,
+                    std::unique_lock<Lock> &lock,
+                    bool &ioUnnotified
+                    ) noexcept(false);
+
+      void armDeadlineTimer() noexcept;
+      void notifyDeadlineTimer(MessageQueueDeadlineTimer *timer) noexcept;
+
     protected:
       //-----------------------------------------------------------------------
       // 
       // MessageQueue => (data)
       // 
 
+      MessageQueueWeakPtr mThisWeak;
+
       mutable Lock mLock;
-      std::queue<IMessageQueueMessageUniPtr> mMessages;
+      MessageLane mMessages;                      // normal priority (the lane nearly every message uses)
+      MessageLaneUniPtr mHighMessages;            // created on first high priority post
+      MessageLaneUniPtr mLowMessages;             // created on first low priority post
+      size_t mTotalMessages {};
+      size_t mStarved[Lane_Total] {};             // times a waiting lane was passed over for a higher lane
+      CoalesceMap mCoalescing;                    // waiting messages that newer posts may replace
+
+      MessageQueueCapacity mCapacity;
+      MessageQueueCounters mCounters;
+      std::condition_variable mSpaceAvailable;    // signalled while posts are blocked on a full queue
+      size_t mBlockedPosts {};
+
+      DelayedMessageHeap mDelayed;                // earliest deadline at the front
+      ULONGLONG mDelayedOrder {};
+
+      MessageQueueDeadlineTimerPtr mDeadlineTimer;  // only for notifiers unable to wait on a deadline
+      Time mDeadlineTimerDeadline;
       IMessageQueueNotifyPtr mNotify;
+      std::atomic<std::thread::id> mDispatchingThread {};   // thread inside processMessage (if any)
+
+      String mName;
+      MessageQueueStatisticsPtr mStatistics;    // created on first use while statistics are enabled
     };
   }
 }
@@ -76,9 +76,19 @@ namespace zsLib
 
       // IMessageQueue
       void post(IMessageQueueMessageUniPtr message) noexcept(false) override;
+      void postBatch(MessageList &messages) noexcept(false) override;
+
+      void postAt(
+                  IMessageQueueMessageUniPtr message,
+                  const Time &deadline
+                  ) noexcept(false) override;
 
       size_type getTotalUnprocessedMessages() const noexcept override;
 
+      void setCapacity(const MessageQueueCapacity &capacity) noexcept override;
+      MessageQueueCapacity getCapacity() const noexcept override;
+      MessageQueueCounters getCounters() const noexcept override;
+
       bool isCurrentThread() const noexcept override;
 
       // IMessageQueueNotify
@@ -90,6 +100,7 @@ namespace zsLib
       void waitForShutdown() noexcept override;
 
       void setThreadPriority(ThreadPriorities threadPriority) noexcept override;
+      void setThreadAffinity(const ThreadAffinity &affinity) noexcept override;
 
     public:
       virtual void process() noexcept;
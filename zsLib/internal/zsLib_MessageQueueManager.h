@@ -66,6 +66,9 @@ namespace zsLib
       friend interaction IMessageQueueManagerForBackgrounding;
 
       typedef std::map<MessageQueueName, ThreadPriorities> ThreadPriorityMap;
+      typedef std::map<MessageQueueName, ThreadAffinity> ThreadAffinityMap;
+      typedef std::map<MessageQueueName, MessageQueueCapacity> MessageQueueCapacityMap;
+      typedef std::map<MessageQueueName, ThreadPoolScaling> ThreadPoolScalingMap;
       typedef std::pair<IMessageQueueThreadPoolPtr, size_t> MessageQueueThreadPoolPair;
       typedef std::map<MessageQueueName, MessageQueueThreadPoolPair> MessageQueuePoolMap;
 
@@ -102,6 +105,21 @@ namespace zsLib
                                               ThreadPriorities priority
                                               ) noexcept;
 
+      void registerMessageQueueThreadAffinity(
+                                              const char *assignedQueueName,
+                                              const ThreadAffinity &affinity
+                                              ) noexcept;
+
+      void registerMessageQueueCapacity(
+                                        const char *assignedQueueName,
+                                        const MessageQueueCapacity &capacity
+                                        ) noexcept;
+
+      void registerThreadPoolScaling(
+                                     const char *assignedThreadPoolQueueName,
+                                     const ThreadPoolScaling &scaling
+                                     ) noexcept;
+
       MessageQueueMapPtr getRegisteredQueues() noexcept;
 
       size_t getTotalUnprocessedMessages() const noexcept;
@@ -136,6 +154,8 @@ namespace zsLib
 
       virtual ElementPtr toDebug() const noexcept;
 
+      ThreadPoolScaling resolveScaling(const String &poolName) const noexcept;
+
       void cancel() noexcept;
 
     protected:
@@ -155,6 +175,9 @@ namespace zsLib
 
       MessageQueueMap mQueues;
       ThreadPriorityMap mThreadPriorities;
+      ThreadAffinityMap mThreadAffinities;
+      MessageQueueCapacityMap mCapacities;
+      ThreadPoolScalingMap mScalings;
 
       MessageQueuePoolMap mPools;
 
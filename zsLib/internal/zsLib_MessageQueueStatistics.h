@@ -0,0 +1,117 @@
+/*
+
+ Copyright (c) 2016, Robin Raymond
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation
+ and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ The views and conclusions contained in the software and documentation are those
+ of the authors and should not be interpreted as representing official policies,
+ either expressed or implied, of the FreeBSD Project.
+ 
+ */
+
+#pragma once
+
+#include <zsLib/IMessageQueueStatistics.h>
+#include <zsLib/IMessageQueue.h>
+#include <zsLib/internal/types.h>
+
+#include <atomic>
+#include <chrono>
+#include <map>
+
+namespace zsLib
+{
+  namespace internal
+  {
+    ZS_DECLARE_CLASS_PTR(MessageQueueStatistics);
+
+    // checked by every message queue before taking any timestamp
+    extern std::atomic<bool> gMessageQueueStatisticsEnabled;
+
+    //-------------------------------------------------------------------------
+    //-------------------------------------------------------------------------
+    //-------------------------------------------------------------------------
+    //-------------------------------------------------------------------------
+    //
+    // MessageQueueStatistics
+    //
+
+    class MessageQueueStatistics
+    {
+    protected:
+      struct make_private {};
+
+    public:
+      friend interaction zsLib::IMessageQueueStatistics;
+
+      typedef IMessageQueueStatistics::Histogram Histogram;
+      typedef std::chrono::steady_clock Clock;
+      typedef Clock::time_point TimePoint;
+
+    public:
+      MessageQueueStatistics(const make_private &) noexcept;
+      ~MessageQueueStatistics() noexcept;
+
+      static MessageQueueStatisticsPtr create() noexcept;
+
+      static bool isEnabled() noexcept { return gMessageQueueStatisticsEnabled.load(std::memory_order_relaxed); }
+
+      void setName(const char *name) noexcept;
+
+      void record(
+                  const IMessageQueueMessage &message,
+                  TimePoint posted,
+                  TimePoint started,
+                  TimePoint finished
+                  ) noexcept;
+
+    protected:
+      bool snapshot(
+                    IMessageQueueStatistics::QueueStatistics &outStatistics,
+                    bool reset
+                    ) noexcept;
+      void reset() noexcept;
+
+      static ULONGLONG toMicroseconds(TimePoint from, TimePoint to) noexcept;
+
+    protected:
+      struct MethodEntry
+      {
+        Histogram mWaitTime;
+        Histogram mProcessingTime;
+      };
+
+      // keyed by the names' content (the strings may not outlive the message)
+      typedef std::pair<String, String> MethodKey;
+      typedef std::map<MethodKey, MethodEntry> MethodMap;
+
+      AutoPUID mID;
+      mutable Lock mLock;
+      String mName;
+
+      Histogram mWaitTime;
+      Histogram mProcessingTime;
+      MethodMap mMethods;
+    };
+  }
+}
@@ -42,6 +42,11 @@ namespace zsLib
                            ThreadPriorities threadPriority
                            ) noexcept;
 
+    bool setThreadAffinity(
+                           Thread::native_handle_type handle,
+                           const ThreadAffinity &affinity
+                           ) noexcept;
+
     //-------------------------------------------------------------------------
     //-------------------------------------------------------------------------
     //-------------------------------------------------------------------------
@@ -59,7 +64,12 @@ namespace zsLib
       friend interaction IMessageQueueThread;
 
     protected:
-      static MessageQueueThreadPtr createBasic(const char *threadName = NULL, ThreadPriorities threadPriority = ThreadPriority_Normal) noexcept;
+      static MessageQueueThreadPtr createBasic(
+                                               const char *threadName = NULL,
+                                               ThreadPriorities threadPriority = ThreadPriority_Normal,
+                                               const ThreadAffinity &affinity = ThreadAffinity(),
+                                               const MessageQueueCapacity &capacity = MessageQueueCapacity()
+                                               ) noexcept;
       static IMessageQueueThreadPtr singletonUsingCurrentGUIThreadsMessageQueue() noexcept;
     };
   }
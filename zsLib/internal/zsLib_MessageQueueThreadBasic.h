@@ -54,25 +54,44 @@ namespace zsLib
     public:
       ~MessageQueueThreadBasic() noexcept;
 
-      static MessageQueueThreadBasicPtr create(const char *threadName = NULL, ThreadPriorities threadPriority = ThreadPriority_Normal) noexcept;
+      static MessageQueueThreadBasicPtr create(
+                                               const char *threadName = NULL,
+                                               ThreadPriorities threadPriority = ThreadPriority_Normal,
+                                               const ThreadAffinity &affinity = ThreadAffinity(),
+                                               const MessageQueueCapacity &capacity = MessageQueueCapacity()
+                                               ) noexcept;
 
       void operator ()() noexcept;
 
       // IMessageQueue
       void post(IMessageQueueMessageUniPtr message) noexcept(false) override;
+      void postBatch(MessageList &messages) noexcept(false) override;
+
+      void postAt(
+                  IMessageQueueMessageUniPtr message,
+                  const Time &deadline
+                  ) noexcept(false) override;
 
       size_type getTotalUnprocessedMessages() const noexcept override;
 
+      void setCapacity(const MessageQueueCapacity &capacity) noexcept override;
+      MessageQueueCapacity getCapacity() const noexcept override;
+      MessageQueueCounters getCounters() const noexcept override;
+
       bool isCurrentThread() const noexcept override;
 
       // IMessageQueueNotify
       void notifyMessagePosted() noexcept override;
 
+      bool notifyMessageScheduled(const Time &deadline) noexcept override;
+
       // IMessageQueueThread
       void waitForShutdown() noexcept override;
 
       void setThreadPriority(ThreadPriorities threadPriority) noexcept override;
 
+      void setThreadAffinity(const ThreadAffinity &affinity) noexcept override;
+
       void processMessagesFromThread() noexcept override;
 
     protected:
@@ -85,6 +104,7 @@ namespace zsLib
       mutable Lock mLock;
       std::atomic_bool mMustShutdown {};
       ThreadPriorities mThreadPriority {ThreadPriority_Normal};
+      ThreadAffinity mThreadAffinity;
 
       std::atomic_bool mIsShutdown {};
     };
@@ -37,6 +37,7 @@
 #include <zsLib/IMessageQueueThreadPool.h>
 
 #include <queue>
+#include <vector>
 
 namespace zsLib
 {
@@ -63,9 +64,25 @@ namespace zsLib
       struct make_private {};
 
       typedef std::list<MessageQueueThreadPoolDispatcherThreadPtr> DispatcherThreadList;
-      typedef std::queue<MessageQueueThreadPoolDispatcherThreadPtr> DispatcherThreadQueue;
       typedef std::queue<MessageQueueThreadPoolQueueNotifierPtr> MessageNotifierQueue;
 
+      enum DeadlineResults
+      {
+        DeadlineResult_Rewait,        // nothing to do, wait again
+        DeadlineResult_HandedWork,    // work was handed to the thread as the wait expired
+        DeadlineResult_Retire,        // the idle thread was retired by elastic scaling
+      };
+
+      struct QueueDeadline
+      {
+        Time mDeadline;
+        MessageQueueThreadPoolQueueNotifierPtr mNotifier;
+
+        bool operator<(const QueueDeadline &other) const noexcept {return mDeadline > other.mDeadline;}
+      };
+
+      typedef std::vector<QueueDeadline> QueueDeadlineHeap;
+
     protected:
 
     public:
@@ -77,34 +94,63 @@ namespace zsLib
 
       void createThread(
                         const char *threadName = NULL,
-                        ThreadPriorities threadPriority = ThreadPriority_Normal
+                        ThreadPriorities threadPriority = ThreadPriority_Normal,
+                        const ThreadAffinity &affinity = ThreadAffinity()
                         ) noexcept override;
 
       void waitForShutdown() noexcept override;
 
       bool hasPendingMessages() noexcept override;
 
-      IMessageQueuePtr createQueue() noexcept override;
+      IMessageQueuePtr createQueue(const MessageQueueCapacity &capacity = MessageQueueCapacity()) noexcept override;
 
       void setThreadPriority(ThreadPriorities threadPriority) noexcept override;
 
+      void setThreadAffinity(const ThreadAffinity &affinity) noexcept override;
+
+      void setScaling(const ThreadPoolScaling &scaling) noexcept override;
+      ThreadPoolScaling getScaling() const noexcept override;
+      ThreadPoolScalingCounters getScalingCounters() const noexcept override;
+
     protected:
       void init() noexcept;
 
       void notifyPosted(MessageQueueThreadPoolQueueNotifierPtr queue) noexcept;
       bool isCurrentThread() const noexcept;
-      void notifyIdle(MessageQueueThreadPoolDispatcherThreadPtr dispatcher) noexcept;
+      Time notifyIdle(MessageQueueThreadPoolDispatcherThreadPtr dispatcher) noexcept;
+      void notifyDeadline(
+                          MessageQueueThreadPoolQueueNotifierPtr queue,
+                          const Time &deadline
+                          ) noexcept;
+      DeadlineResults notifyDeadlineReached(MessageQueueThreadPoolDispatcherThreadPtr dispatcher) noexcept;
       void processOneQueue() noexcept;
+      ThreadAffinity nextThreadAffinity(const ThreadAffinity &affinity) noexcept;
+
+      bool shouldGrow() noexcept;                                   // requires mLock
+      void addElasticThread() noexcept;
 
     protected:
       MessageQueueThreadPoolWeakPtr mThisWeak;
       mutable Lock mLock;
 
       DispatcherThreadList mThreads;
-      DispatcherThreadQueue mIdleThreads;
+      DispatcherThreadList mIdleThreads;                            // most recently idle at the back
       MessageNotifierQueue mPendingQueues;
 
       size_t mMissingIdle {0};
+
+      QueueDeadlineHeap mDeadlines;                                 // earliest deadline at the front
+      MessageQueueThreadPoolDispatcherThreadPtr mTimekeeper;      // the idle thread waiting on the earliest deadline
+
+      ThreadAffinity mThreadAffinity;
+      size_t mNextProcessor {0};
+
+      ThreadPoolScaling mScaling;
+      ThreadPoolScalingCounters mScalingCounters;
+      size_t mThreadsStarting {};                                   // elastic threads being created outside of the lock
+      size_t mElasticThreadIndex {};
+      Time mBacklogSince;                                           // last time the backlog started or a dispatcher freed up
+      Time mLastGrow;
     };
     
   }
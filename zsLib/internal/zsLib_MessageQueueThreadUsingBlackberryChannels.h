@@ -66,9 +66,19 @@ namespace zsLib
 
       // IMessageQueue
       virtual void post(IMessageQueueMessageUniPtr message) noexcept(false);
+      virtual void postBatch(MessageList &messages) noexcept(false);
+
+      virtual void postAt(
+                          IMessageQueueMessageUniPtr message,
+                          const Time &deadline
+                          ) noexcept(false);
 
       virtual size_type getTotalUnprocessedMessages() const noexcept;
 
+      virtual void setCapacity(const MessageQueueCapacity &capacity) noexcept;
+      virtual MessageQueueCapacity getCapacity() const noexcept;
+      virtual MessageQueueCounters getCounters() const noexcept;
+
       // IMessageQueueNotify
       virtual void notifyMessagePosted() noexcept;
 
@@ -76,6 +86,7 @@ namespace zsLib
       virtual void waitForShutdown() noexcept;
 
       virtual void setThreadPriority(ThreadPriorities threadPriority) noexcept;
+      virtual void setThreadAffinity(const ThreadAffinity &affinity) noexcept;
 
       // IQtCrossThreadNotifierDelegate
       virtual void processMessageFromThread() noexcept;
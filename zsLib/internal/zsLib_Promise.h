@@ -38,10 +38,27 @@
 #include <zsLib/Proxy.h>
 #include <zsLib/MessageQueueAssociator.h>
 
+#include <type_traits>
+
 namespace zsLib
 {
   namespace internal
   {
+    //-------------------------------------------------------------------------
+    // passes a PromiseOf<> payload on to the generic value / reason when it
+    // already is an AnyPtr (or converts to one), otherwise nothing is boxed
+    template <typename TYPE, bool convertible = std::is_convertible<const TYPE &, AnyPtr>::value>
+    struct PromiseOfAny
+    {
+      static AnyPtr get(const TYPE &) noexcept {return AnyPtr();}
+    };
+
+    template <typename TYPE>
+    struct PromiseOfAny<TYPE, true>
+    {
+      static AnyPtr get(const TYPE &value) noexcept {return value;}
+    };
+
     class Promise : public zsLib::MessageQueueAssociator,
                     public zsLib::IPromiseDelegate
     {
@@ -80,6 +97,7 @@ namespace zsLib
 
       IPromiseDelegatePtr mThen;
       IPromiseDelegateWeakPtr mThenWeak;
+      IMessageQueueMessageUniPtr mThenMessage;
 
       AnyPtr mValue;
       AnyPtr mReason;
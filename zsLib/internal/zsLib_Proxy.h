@@ -56,6 +56,9 @@
 #define ZS_INTERNAL_PROXY_NO_THROW            noexcept
 #define ZS_INTERNAL_PROXY_NO_THROW_DECLARE    ZS_INTERNAL_PROXY_NO_DEFINITION
 
+#define ZS_INTERNAL_PROXY_NO_COALESCE(xStub)  ZS_INTERNAL_PROXY_NO_DEFINITION
+#define ZS_INTERNAL_PROXY_COALESCE(xStub)     zsLib::MessageCoalesceKey getCoalesceKey() const noexcept override {return zsLib::MessageCoalesceKey {mDelegate.get(), &typeid(xStub)};}
+
 namespace zsLib
 {
   template <typename XINTERFACE>
@@ -65,8 +68,10 @@ namespace zsLib
 
   namespace internal
   {
-    void proxyCountIncrement(int line, const char *fileName);
-    void proxyCountDecrement(int line, const char *fileName);
+    struct ProxyCensusCounter;
+
+    ProxyCensusCounter *proxyCountIncrement(int line, const char *fileName);    // the call-site census entry counting the proxy (if any)
+    void proxyCountDecrement(int line, const char *fileName, ProxyCensusCounter *census);
 
     constexpr static bool isTrue(bool value) { return value; }
 
@@ -77,10 +82,10 @@ namespace zsLib
       ZS_DECLARE_TYPEDEF_PTR(XINTERFACE, Delegate)
 
     public:
-      Proxy(IMessageQueuePtr queue, DelegatePtr delegate, int line, const char *fileName) : mQueue(queue), mDelegate(delegate), mLine(line), mFileName(fileName), mNoop(false), mIgnoreMethodCall(false) {proxyCountIncrement(mLine, mFileName);}
-      Proxy(IMessageQueuePtr queue, DelegateWeakPtr delegateWeakPtr, int line, const char *fileName) : mQueue(queue), mWeakDelegate(delegateWeakPtr), mLine(line), mFileName(fileName), mNoop(false), mIgnoreMethodCall(false) {proxyCountIncrement(mLine, mFileName);}
-      Proxy(IMessageQueuePtr queue, bool throwsDelegateGone, int line, const char *fileName) : mQueue(queue), mLine(line), mFileName(fileName), mNoop(true), mIgnoreMethodCall(!throwsDelegateGone) {proxyCountIncrement(mLine, mFileName);}
-      ~Proxy() noexcept {proxyCountDecrement(mLine, mFileName);}
+      Proxy(IMessageQueuePtr queue, DelegatePtr delegate, int line, const char *fileName) : mQueue(queue), mDelegate(delegate), mLine(line), mFileName(fileName), mNoop(false), mIgnoreMethodCall(false) {mCensus = proxyCountIncrement(mLine, mFileName);}
+      Proxy(IMessageQueuePtr queue, DelegateWeakPtr delegateWeakPtr, int line, const char *fileName) : mQueue(queue), mWeakDelegate(delegateWeakPtr), mLine(line), mFileName(fileName), mNoop(false), mIgnoreMethodCall(false) {mCensus = proxyCountIncrement(mLine, mFileName);}
+      Proxy(IMessageQueuePtr queue, bool throwsDelegateGone, int line, const char *fileName) : mQueue(queue), mLine(line), mFileName(fileName), mNoop(true), mIgnoreMethodCall(!throwsDelegateGone) {mCensus = proxyCountIncrement(mLine, mFileName);}
+      ~Proxy() noexcept {proxyCountDecrement(mLine, mFileName, mCensus);}
 
       DelegatePtr getDelegate() const noexcept(false)
       {
@@ -110,6 +115,17 @@ namespace zsLib
 
       bool ignoreMethodCall() const noexcept {return mIgnoreMethodCall;}
 
+      void setDirectWhenSameQueue() noexcept {mDirectWhenSameQueue = true;}
+
+      // an asynchronous call may run inline only when it cannot overtake a
+      // message already waiting on the delegate's queue
+      bool callDirect() const noexcept
+      {
+        if (!mDirectWhenSameQueue) return false;
+        if (!mQueue->isCurrentThread()) return false;
+        return 0 == mQueue->getTotalUnprocessedMessages();
+      }
+
     protected:
       static const char *getInterfaceName() noexcept {return typeid(XINTERFACE).name();}
 
@@ -123,6 +139,8 @@ namespace zsLib
       const char *mFileName;
       bool mNoop;
       bool mIgnoreMethodCall;
+      bool mDirectWhenSameQueue {};
+      ProxyCensusCounter *mCensus {};
     };
   }
 }
@@ -162,6 +180,7 @@ namespace zsLib
       zsLib::Proxy<xInterface>::createWeak(zsLib::IMessageQueuePtr(), DelegatePtr());                         \
       zsLib::Proxy<xInterface>::createWeakUsingQueue(zsLib::IMessageQueuePtr(), DelegatePtr());               \
       zsLib::Proxy<xInterface>::createNoop(zsLib::IMessageQueuePtr());                                        \
+      zsLib::Proxy<xInterface>::createDirectWhenSameQueue(DelegatePtr());                                     \
       zsLib::Proxy<xInterface>::isProxy(DelegatePtr());                                                       \
       zsLib::Proxy<xInterface>::original(DelegatePtr());                                                      \
       zsLib::Proxy<xInterface>::getAssociatedMessageQueue(DelegatePtr());                                     \
@@ -206,6 +225,8 @@ namespace zsLib
                                                                                                               \
     static DelegatePtr createNoop(IMessageQueuePtr queue, bool throwsDelegateGone = false, bool overrideDelegateMustHaveQueue = true, int line = __LINE__, const char *fileName = __FILE__); \
                                                                                                               \
+    static DelegatePtr createDirectWhenSameQueue(DelegatePtr delegate, bool throwDelegateGone = false, bool overrideDelegateMustHaveQueue = true, int line = __LINE__, const char *fileName = __FILE__); \
+                                                                                                              \
     static bool isProxy(DelegatePtr delegate) noexcept;                                                       \
                                                                                                               \
     static DelegatePtr original(DelegatePtr delegate, bool throwDelegateGone = false);                        \
@@ -299,7 +320,7 @@ namespace zsLib
     xReturnType xMethod(t1 v1,t2 v2,t3 v3,t4 v4,t5 v5,t6 v6,t7 v7,t8 v8,t9 v9,t10 v10,t11 v11,t12 v12,t13 v13,t14 v14,t15 v15,t16 v16,t17 v17,t18 v18,t19 v19,t20 v20,t21 v21,t22 v22,t23 v23,t24 v24,t25 v25) xConst xThrow override;        \
 
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_0(xMethod)                                                                                                 \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_0(xPriority,xCoalesce,xMethod)                                                                             \
     class Stub_0_##xMethod : public IMessageQueueMessage                                                                                            \
     {                                                                                                                                               \
     private:                                                                                                                                        \
@@ -310,13 +331,15 @@ namespace zsLib
                                                                                                                                                     \
       const char *getDelegateName() const noexcept override;                                                                                        \
       const char *getMethodName() const noexcept override;                                                                                          \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                            \
+      xCoalesce(Stub_0_##xMethod)                                                                                                                   \
       void processMessage() noexcept override;                                                                                                      \
     };                                                                                                                                              \
                                                                                                                                                     \
     void xMethod() override;                                                                                                                        \
 
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_1(xMethod,t1)                                                                                              \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_1(xPriority,xCoalesce,xMethod,t1)                                                                          \
     class Stub_1_##xMethod : public IMessageQueueMessage                                                                                            \
     {                                                                                                                                               \
     private:                                                                                                                                        \
@@ -328,12 +351,14 @@ namespace zsLib
                                                                                                                                                     \
       const char *getDelegateName() const noexcept override;                                                                                        \
       const char *getMethodName() const noexcept override;                                                                                          \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                            \
+      xCoalesce(Stub_1_##xMethod)                                                                                                                   \
       void processMessage() noexcept override;                                                                                                      \
     };                                                                                                                                              \
                                                                                                                                                     \
     void xMethod(t1 v1) override;                                                                                                                   \
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_2(xMethod,t1,t2)                                                                                           \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_2(xPriority,xCoalesce,xMethod,t1,t2)                                                                       \
     class Stub_2_##xMethod : public IMessageQueueMessage                                                                                            \
     {                                                                                                                                               \
     private:                                                                                                                                        \
@@ -345,12 +370,14 @@ namespace zsLib
                                                                                                                                                     \
       const char *getDelegateName() const noexcept override;                                                                                        \
       const char *getMethodName() const noexcept override;                                                                                          \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                            \
+      xCoalesce(Stub_2_##xMethod)                                                                                                                   \
       void processMessage() noexcept override;                                                                                                      \
     };                                                                                                                                              \
                                                                                                                                                     \
     void xMethod(t1 v1,t2 v2) override;                                                                                                             \
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_3(xMethod,t1,t2,t3)                                                                                        \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_3(xPriority,xCoalesce,xMethod,t1,t2,t3)                                                                    \
     class Stub_3_##xMethod : public IMessageQueueMessage                                                                                            \
     {                                                                                                                                               \
     private:                                                                                                                                        \
@@ -362,12 +389,14 @@ namespace zsLib
                                                                                                                                                     \
       const char *getDelegateName() const noexcept override;                                                                                        \
       const char *getMethodName() const noexcept override;                                                                                          \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                            \
+      xCoalesce(Stub_3_##xMethod)                                                                                                                   \
       void processMessage() noexcept override;                                                                                                      \
     };                                                                                                                                              \
                                                                                                                                                     \
     void xMethod(t1 v1,t2 v2,t3 v3) override;                                                                                                       \
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_4(xMethod,t1,t2,t3,t4)                                                                                     \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_4(xPriority,xCoalesce,xMethod,t1,t2,t3,t4)                                                                 \
     class Stub_4_##xMethod : public IMessageQueueMessage                                                                                            \
     {                                                                                                                                               \
     private:                                                                                                                                        \
@@ -379,12 +408,14 @@ namespace zsLib
                                                                                                                                                     \
       const char *getDelegateName() const noexcept override;                                                                                        \
       const char *getMethodName() const noexcept override;                                                                                          \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                            \
+      xCoalesce(Stub_4_##xMethod)                                                                                                                   \
       void processMessage() noexcept override;                                                                                                      \
     };                                                                                                                                              \
                                                                                                                                                     \
     void xMethod(t1 v1,t2 v2,t3 v3,t4 v4) override;                                                                                                 \
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_5(xMethod,t1,t2,t3,t4,t5)                                                                                  \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_5(xPriority,xCoalesce,xMethod,t1,t2,t3,t4,t5)                                                              \
     class Stub_5_##xMethod : public IMessageQueueMessage                                                                                            \
     {                                                                                                                                               \
     private:                                                                                                                                        \
@@ -396,12 +427,14 @@ namespace zsLib
                                                                                                                                                     \
       const char *getDelegateName() const noexcept override;                                                                                        \
       const char *getMethodName() const noexcept override;                                                                                          \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                            \
+      xCoalesce(Stub_5_##xMethod)                                                                                                                   \
       void processMessage() noexcept override;                                                                                                      \
     };                                                                                                                                              \
                                                                                                                                                     \
     void xMethod(t1 v1,t2 v2,t3 v3,t4 v4,t5 v5) override;                                                                                           \
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_6(xMethod,t1,t2,t3,t4,t5,t6)                                                                               \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_6(xPriority,xCoalesce,xMethod,t1,t2,t3,t4,t5,t6)                                                           \
     class Stub_6_##xMethod : public IMessageQueueMessage                                                                                            \
     {                                                                                                                                               \
     private:                                                                                                                                        \
@@ -413,12 +446,14 @@ namespace zsLib
                                                                                                                                                     \
       const char *getDelegateName() const noexcept override;                                                                                        \
       const char *getMethodName() const noexcept override;                                                                                          \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                            \
+      xCoalesce(Stub_6_##xMethod)                                                                                                                   \
       void processMessage() noexcept override;                                                                                                      \
     };                                                                                                                                              \
                                                                                                                                                     \
     void xMethod(t1 v1,t2 v2,t3 v3,t4 v4,t5 v5,t6 v6) override;                                                                                     \
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_7(xMethod,t1,t2,t3,t4,t5,t6,t7)                                                                            \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_7(xPriority,xCoalesce,xMethod,t1,t2,t3,t4,t5,t6,t7)                                                        \
     class Stub_7_##xMethod : public IMessageQueueMessage                                                                                            \
     {                                                                                                                                               \
     private:                                                                                                                                        \
@@ -430,12 +465,14 @@ namespace zsLib
                                                                                                                                                     \
       const char *getDelegateName() const noexcept override;                                                                                        \
       const char *getMethodName() const noexcept override;                                                                                          \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                            \
+      xCoalesce(Stub_7_##xMethod)                                                                                                                   \
       void processMessage() noexcept override;                                                                                                      \
     };                                                                                                                                              \
                                                                                                                                                     \
     void xMethod(t1 v1,t2 v2,t3 v3,t4 v4,t5 v5,t6 v6,t7 v7) override;                                                                               \
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_8(xMethod,t1,t2,t3,t4,t5,t6,t7,t8)                                                                         \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_8(xPriority,xCoalesce,xMethod,t1,t2,t3,t4,t5,t6,t7,t8)                                                     \
     class Stub_8_##xMethod : public IMessageQueueMessage                                                                                            \
     {                                                                                                                                               \
     private:                                                                                                                                        \
@@ -447,12 +484,14 @@ namespace zsLib
                                                                                                                                                     \
       const char *getDelegateName() const noexcept override;                                                                                        \
       const char *getMethodName() const noexcept override;                                                                                          \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                            \
+      xCoalesce(Stub_8_##xMethod)                                                                                                                   \
       void processMessage() noexcept override;                                                                                                      \
     };                                                                                                                                              \
                                                                                                                                                     \
     void xMethod(t1 v1,t2 v2,t3 v3,t4 v4,t5 v5,t6 v6,t7 v7,t8 v8) override;                                                                         \
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_9(xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9)                                                                      \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_9(xPriority,xCoalesce,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9)                                                  \
     class Stub_9_##xMethod : public IMessageQueueMessage                                                                                            \
     {                                                                                                                                               \
     private:                                                                                                                                        \
@@ -464,12 +503,14 @@ namespace zsLib
                                                                                                                                                     \
       const char *getDelegateName() const noexcept override;                                                                                        \
       const char *getMethodName() const noexcept override;                                                                                          \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                            \
+      xCoalesce(Stub_9_##xMethod)                                                                                                                   \
       void processMessage() noexcept override;                                                                                                      \
     };                                                                                                                                              \
                                                                                                                                                     \
     void xMethod(t1 v1,t2 v2,t3 v3,t4 v4,t5 v5,t6 v6,t7 v7,t8 v8,t9 v9) override;                                                                   \
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_10(xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10)                                                                 \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_10(xPriority,xCoalesce,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10)                                             \
     class Stub_10_##xMethod : public IMessageQueueMessage                                                                                           \
     {                                                                                                                                               \
     private:                                                                                                                                        \
@@ -481,12 +522,14 @@ namespace zsLib
                                                                                                                                                     \
       const char *getDelegateName() const noexcept override;                                                                                        \
       const char *getMethodName() const noexcept override;                                                                                          \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                            \
+      xCoalesce(Stub_10_##xMethod)                                                                                                                  \
       void processMessage() noexcept override;                                                                                                      \
     };                                                                                                                                              \
                                                                                                                                                     \
     void xMethod(t1 v1,t2 v2,t3 v3,t4 v4,t5 v5,t6 v6,t7 v7,t8 v8,t9 v9,t10 v10) override;                                                           \
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_11(xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11)                                                             \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_11(xPriority,xCoalesce,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11)                                         \
     class Stub_11_##xMethod : public IMessageQueueMessage                                                                                           \
     {                                                                                                                                               \
     private:                                                                                                                                        \
@@ -498,12 +541,14 @@ namespace zsLib
                                                                                                                                                     \
       const char *getDelegateName() const noexcept override;                                                                                        \
       const char *getMethodName() const noexcept override;                                                                                          \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                            \
+      xCoalesce(Stub_11_##xMethod)                                                                                                                  \
       void processMessage() noexcept override;                                                                                                      \
     };                                                                                                                                              \
                                                                                                                                                     \
     void xMethod(t1 v1,t2 v2,t3 v3,t4 v4,t5 v5,t6 v6,t7 v7,t8 v8,t9 v9,t10 v10,t11 v11) override;                                                   \
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_12(xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12)                                                         \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_12(xPriority,xCoalesce,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12)                                     \
     class Stub_12_##xMethod : public IMessageQueueMessage                                                                                           \
     {                                                                                                                                               \
     private:                                                                                                                                        \
@@ -515,12 +560,14 @@ namespace zsLib
                                                                                                                                                     \
       const char *getDelegateName() const noexcept override;                                                                                        \
       const char *getMethodName() const noexcept override;                                                                                          \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                            \
+      xCoalesce(Stub_12_##xMethod)                                                                                                                  \
       void processMessage() noexcept override;                                                                                                      \
     };                                                                                                                                              \
                                                                                                                                                     \
     void xMethod(t1 v1,t2 v2,t3 v3,t4 v4,t5 v5,t6 v6,t7 v7,t8 v8,t9 v9,t10 v10,t11 v11,t12 v12) override;                                           \
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_13(xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13)                                                                                                                 \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_13(xPriority,xCoalesce,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13)                                                                                             \
     class Stub_13_##xMethod : public IMessageQueueMessage                                                                                                                                                       \
     {                                                                                                                                                                                                           \
     private:                                                                                                                                                                                                    \
@@ -532,12 +579,14 @@ namespace zsLib
                                                                                                                                                                                                                 \
       const char *getDelegateName() const noexcept override;                                                                                                                                                    \
       const char *getMethodName() const noexcept override;                                                                                                                                                      \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                                                                                        \
+      xCoalesce(Stub_13_##xMethod)                                                                                                                                                                              \
       void processMessage() noexcept override;                                                                                                                                                                  \
     };                                                                                                                                                                                                          \
                                                                                                                                                                                                                 \
     void xMethod(t1 v1,t2 v2,t3 v3,t4 v4,t5 v5,t6 v6,t7 v7,t8 v8,t9 v9,t10 v10,t11 v11,t12 v12,t13 v13) override;                                                                                               \
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_14(xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14)                                                                                                             \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_14(xPriority,xCoalesce,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14)                                                                                         \
     class Stub_14_##xMethod : public IMessageQueueMessage                                                                                                                                                       \
     {                                                                                                                                                                                                           \
     private:                                                                                                                                                                                                    \
@@ -549,12 +598,14 @@ namespace zsLib
                                                                                                                                                                                                                 \
       const char *getDelegateName() const noexcept override;                                                                                                                                                    \
       const char *getMethodName() const noexcept override;                                                                                                                                                      \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                                                                                        \
+      xCoalesce(Stub_14_##xMethod)                                                                                                                                                                              \
       void processMessage() noexcept override;                                                                                                                                                                  \
     };                                                                                                                                                                                                          \
                                                                                                                                                                                                                 \
     void xMethod(t1 v1,t2 v2,t3 v3,t4 v4,t5 v5,t6 v6,t7 v7,t8 v8,t9 v9,t10 v10,t11 v11,t12 v12,t13 v13,t14 v14) override;                                                                                       \
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_15(xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15)                                                                                                         \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_15(xPriority,xCoalesce,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15)                                                                                     \
     class Stub_15_##xMethod : public IMessageQueueMessage                                                                                                                                                       \
     {                                                                                                                                                                                                           \
     private:                                                                                                                                                                                                    \
@@ -566,12 +617,14 @@ namespace zsLib
                                                                                                                                                                                                                 \
       const char *getDelegateName() const noexcept override;                                                                                                                                                    \
       const char *getMethodName() const noexcept override;                                                                                                                                                      \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                                                                                        \
+      xCoalesce(Stub_15_##xMethod)                                                                                                                                                                              \
       void processMessage() noexcept override;                                                                                                                                                                  \
     };                                                                                                                                                                                                          \
                                                                                                                                                                                                                 \
     void xMethod(t1 v1,t2 v2,t3 v3,t4 v4,t5 v5,t6 v6,t7 v7,t8 v8,t9 v9,t10 v10,t11 v11,t12 v12,t13 v13,t14 v14,t15 v15) override;                                                                               \
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_16(xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16)                                                                                                     \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_16(xPriority,xCoalesce,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16)                                                                                 \
     class Stub_16_##xMethod : public IMessageQueueMessage                                                                                                                                                       \
     {                                                                                                                                                                                                           \
     private:                                                                                                                                                                                                    \
@@ -583,12 +636,14 @@ namespace zsLib
                                                                                                                                                                                                                 \
       const char *getDelegateName() const noexcept override;                                                                                                                                                    \
       const char *getMethodName() const noexcept override;                                                                                                                                                      \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                                                                                        \
+      xCoalesce(Stub_16_##xMethod)                                                                                                                                                                              \
       void processMessage() noexcept override;                                                                                                                                                                  \
     };                                                                                                                                                                                                          \
                                                                                                                                                                                                                 \
     void xMethod(t1 v1,t2 v2,t3 v3,t4 v4,t5 v5,t6 v6,t7 v7,t8 v8,t9 v9,t10 v10,t11 v11,t12 v12,t13 v13,t14 v14,t15 v15,t16 v16) override;                                                                       \
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_17(xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17)                                                                                                 \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_17(xPriority,xCoalesce,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17)                                                                             \
     class Stub_17_##xMethod : public IMessageQueueMessage                                                                                                                                                       \
     {                                                                                                                                                                                                           \
     private:                                                                                                                                                                                                    \
@@ -600,12 +655,14 @@ namespace zsLib
                                                                                                                                                                                                                 \
       const char *getDelegateName() const noexcept override;                                                                                                                                                    \
       const char *getMethodName() const noexcept override;                                                                                                                                                      \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                                                                                        \
+      xCoalesce(Stub_17_##xMethod)                                                                                                                                                                              \
       void processMessage() noexcept override;                                                                                                                                                                  \
     };                                                                                                                                                                                                          \
                                                                                                                                                                                                                 \
     void xMethod(t1 v1,t2 v2,t3 v3,t4 v4,t5 v5,t6 v6,t7 v7,t8 v8,t9 v9,t10 v10,t11 v11,t12 v12,t13 v13,t14 v14,t15 v15,t16 v16,t17 v17) override;                                                               \
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_18(xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18)                                                                                             \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_18(xPriority,xCoalesce,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18)                                                                         \
     class Stub_18_##xMethod : public IMessageQueueMessage                                                                                                                                                       \
     {                                                                                                                                                                                                           \
     private:                                                                                                                                                                                                    \
@@ -617,12 +674,14 @@ namespace zsLib
                                                                                                                                                                                                                 \
       const char *getDelegateName() const noexcept override;                                                                                                                                                    \
       const char *getMethodName() const noexcept override;                                                                                                                                                      \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                                                                                        \
+      xCoalesce(Stub_18_##xMethod)                                                                                                                                                                              \
       void processMessage() noexcept override;                                                                                                                                                                  \
     };                                                                                                                                                                                                          \
                                                                                                                                                                                                                 \
     void xMethod(t1 v1,t2 v2,t3 v3,t4 v4,t5 v5,t6 v6,t7 v7,t8 v8,t9 v9,t10 v10,t11 v11,t12 v12,t13 v13,t14 v14,t15 v15,t16 v16,t17 v17,t18 v18) override;                                                       \
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_19(xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19)                                                                                         \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_19(xPriority,xCoalesce,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19)                                                                     \
     class Stub_19_##xMethod : public IMessageQueueMessage                                                                                                                                                       \
     {                                                                                                                                                                                                           \
     private:                                                                                                                                                                                                    \
@@ -634,12 +693,14 @@ namespace zsLib
                                                                                                                                                                                                                 \
       const char *getDelegateName() const noexcept override;                                                                                                                                                    \
       const char *getMethodName() const noexcept override;                                                                                                                                                      \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                                                                                        \
+      xCoalesce(Stub_19_##xMethod)                                                                                                                                                                              \
       void processMessage() noexcept override;                                                                                                                                                                  \
     };                                                                                                                                                                                                          \
                                                                                                                                                                                                                 \
     void xMethod(t1 v1,t2 v2,t3 v3,t4 v4,t5 v5,t6 v6,t7 v7,t8 v8,t9 v9,t10 v10,t11 v11,t12 v12,t13 v13,t14 v14,t15 v15,t16 v16,t17 v17,t18 v18,t19 v19) override;                                               \
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_20(xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20)                                                                                     \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_20(xPriority,xCoalesce,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20)                                                                 \
     class Stub_20_##xMethod : public IMessageQueueMessage                                                                                                                                                       \
     {                                                                                                                                                                                                           \
     private:                                                                                                                                                                                                    \
@@ -651,12 +712,14 @@ namespace zsLib
                                                                                                                                                                                                                 \
       const char *getDelegateName() const noexcept override;                                                                                                                                                    \
       const char *getMethodName() const noexcept override;                                                                                                                                                      \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                                                                                        \
+      xCoalesce(Stub_20_##xMethod)                                                                                                                                                                              \
       void processMessage() noexcept override;                                                                                                                                                                  \
     };                                                                                                                                                                                                          \
                                                                                                                                                                                                                 \
     void xMethod(t1 v1,t2 v2,t3 v3,t4 v4,t5 v5,t6 v6,t7 v7,t8 v8,t9 v9,t10 v10,t11 v11,t12 v12,t13 v13,t14 v14,t15 v15,t16 v16,t17 v17,t18 v18,t19 v19,t20 v20) override;                                       \
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_21(xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21)                                                                                 \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_21(xPriority,xCoalesce,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21)                                                             \
     class Stub_21_##xMethod : public IMessageQueueMessage                                                                                                                                                       \
     {                                                                                                                                                                                                           \
     private:                                                                                                                                                                                                    \
@@ -668,12 +731,14 @@ namespace zsLib
                                                                                                                                                                                                                 \
       const char *getDelegateName() const noexcept override;                                                                                                                                                    \
       const char *getMethodName() const noexcept override;                                                                                                                                                      \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                                                                                        \
+      xCoalesce(Stub_21_##xMethod)                                                                                                                                                                              \
       void processMessage() noexcept override;                                                                                                                                                                  \
     };                                                                                                                                                                                                          \
                                                                                                                                                                                                                 \
     void xMethod(t1 v1,t2 v2,t3 v3,t4 v4,t5 v5,t6 v6,t7 v7,t8 v8,t9 v9,t10 v10,t11 v11,t12 v12,t13 v13,t14 v14,t15 v15,t16 v16,t17 v17,t18 v18,t19 v19,t20 v20,t21 v21) override;                               \
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_22(xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21,t22)                                                                             \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_22(xPriority,xCoalesce,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21,t22)                                                         \
     class Stub_22_##xMethod : public IMessageQueueMessage                                                                                                                                                       \
     {                                                                                                                                                                                                           \
     private:                                                                                                                                                                                                    \
@@ -685,12 +750,14 @@ namespace zsLib
                                                                                                                                                                                                                 \
       const char *getDelegateName() const noexcept override;                                                                                                                                                    \
       const char *getMethodName() const noexcept override;                                                                                                                                                      \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                                                                                        \
+      xCoalesce(Stub_22_##xMethod)                                                                                                                                                                              \
       void processMessage() noexcept override;                                                                                                                                                                  \
     };                                                                                                                                                                                                          \
                                                                                                                                                                                                                 \
     void xMethod(t1 v1,t2 v2,t3 v3,t4 v4,t5 v5,t6 v6,t7 v7,t8 v8,t9 v9,t10 v10,t11 v11,t12 v12,t13 v13,t14 v14,t15 v15,t16 v16,t17 v17,t18 v18,t19 v19,t20 v20,t21 v21,t22 v22) override;                       \
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_23(xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21,t22,t23)                                                                         \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_23(xPriority,xCoalesce,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21,t22,t23)                                                     \
     class Stub_23_##xMethod : public IMessageQueueMessage                                                                                                                                                       \
     {                                                                                                                                                                                                           \
     private:                                                                                                                                                                                                    \
@@ -702,12 +769,14 @@ namespace zsLib
                                                                                                                                                                                                                 \
       const char *getDelegateName() const noexcept override;                                                                                                                                                    \
       const char *getMethodName() const noexcept override;                                                                                                                                                      \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                                                                                        \
+      xCoalesce(Stub_23_##xMethod)                                                                                                                                                                              \
       void processMessage() noexcept override;                                                                                                                                                                  \
     };                                                                                                                                                                                                          \
                                                                                                                                                                                                                 \
     void xMethod(t1 v1,t2 v2,t3 v3,t4 v4,t5 v5,t6 v6,t7 v7,t8 v8,t9 v9,t10 v10,t11 v11,t12 v12,t13 v13,t14 v14,t15 v15,t16 v16,t17 v17,t18 v18,t19 v19,t20 v20,t21 v21,t22 v22,t23 v23) override;               \
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_24(xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21,t22,t23,t24)                                                                     \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_24(xPriority,xCoalesce,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21,t22,t23,t24)                                                 \
     class Stub_24_##xMethod : public IMessageQueueMessage                                                                                                                                                       \
     {                                                                                                                                                                                                           \
     private:                                                                                                                                                                                                    \
@@ -719,12 +788,14 @@ namespace zsLib
                                                                                                                                                                                                                     \
       const char *getDelegateName() const noexcept override;                                                                                                                                                        \
       const char *getMethodName() const noexcept override;                                                                                                                                                          \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                                                                                            \
+      xCoalesce(Stub_24_##xMethod)                                                                                                                                                                                  \
       void processMessage() noexcept override;                                                                                                                                                                      \
     };                                                                                                                                                                                                              \
                                                                                                                                                                                                                     \
     void xMethod(t1 v1,t2 v2,t3 v3,t4 v4,t5 v5,t6 v6,t7 v7,t8 v8,t9 v9,t10 v10,t11 v11,t12 v12,t13 v13,t14 v14,t15 v15,t16 v16,t17 v17,t18 v18,t19 v19,t20 v20,t21 v21,t22 v22,t23 v23,t24 v24) override;           \
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_25(xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21,t22,t23,t24,t25)                                                                             \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_25(xPriority,xCoalesce,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21,t22,t23,t24,t25)                                                         \
     class Stub_25_##xMethod : public IMessageQueueMessage                                                                                                                                                                   \
     {                                                                                                                                                                                                                       \
     private:                                                                                                                                                                                                                \
@@ -736,6 +807,8 @@ namespace zsLib
                                                                                                                                                                                                                             \
       const char *getDelegateName() const noexcept override;                                                                                                                                                                \
       const char *getMethodName() const noexcept override;                                                                                                                                                                  \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                                                                                                    \
+      xCoalesce(Stub_25_##xMethod)                                                                                                                                                                                          \
       void processMessage() noexcept override;                                                                                                                                                                              \
     };                                                                                                                                                                                                                      \
                                                                                                                                                                                                                             \
@@ -952,6 +1025,18 @@ namespace zsLib
       return make_shared<ProxyType>(queue, throwsDelegateGone, line, fileName);                               \
     }                                                                                                         \
                                                                                                               \
+    static DelegatePtr createDirectWhenSameQueue(DelegatePtr delegate, bool throwDelegateGone = false, bool overrideDelegateMustHaveQueue = true, int line = __LINE__, const char *fileName = __FILE__) \
+    {                                                                                                         \
+      DelegatePtr result = create(delegate, throwDelegateGone, overrideDelegateMustHaveQueue, line, fileName); \
+      if (result == delegate)                                                                                 \
+        return result;                                                                                        \
+                                                                                                              \
+      ProxyType *proxy = dynamic_cast<ProxyType *>(result.get());                                             \
+      if (proxy)                                                                                              \
+        proxy->setDirectWhenSameQueue();                                                                      \
+      return result;                                                                                          \
+    }                                                                                                         \
+                                                                                                              \
     static bool isProxy(DelegatePtr delegate) noexcept                                                        \
     {                                                                                                         \
       if (!delegate)                                                                                          \
@@ -1162,7 +1247,7 @@ namespace zsLib
       xReturnKeyword getDelegate()->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17,v18,v19,v20,v21,v22,v23,v24,v25);                                                                                                  \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_0(xMethod)                                                                                                 \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_0(xPriority,xCoalesce,xMethod)                                                                             \
     class Stub_0_##xMethod : public IMessageQueueMessage                                                                                            \
     {                                                                                                                                               \
     private:                                                                                                                                        \
@@ -1173,6 +1258,8 @@ namespace zsLib
                                                                                                                                                     \
       const char *getDelegateName() const noexcept override {return typeid(Delegate).name();}                                                       \
       const char *getMethodName() const noexcept override {return #xMethod;}                                                                        \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                            \
+      xCoalesce(Stub_0_##xMethod)                                                                                                                   \
       void processMessage() noexcept override {                                                                                                     \
         mDelegate->xMethod();                                                                                                                       \
       }                                                                                                                                             \
@@ -1180,12 +1267,13 @@ namespace zsLib
                                                                                                                                                     \
     void xMethod() override {                                                                                                                       \
       if (ignoreMethodCall()) return;                                                                                                               \
+      if (callDirect()) {getDelegate()->xMethod(); return;}                                                                                         \
       ZS_INTERNAL_DECLARE_STUB_PTR(Stub_0_##xMethod)                                                                                                \
       Stub_0_##xMethod##UniPtr stub(new Stub_0_##xMethod(getDelegate()));                                                                           \
       mQueue->post(std::move(stub));                                                                                                                \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_1(xMethod,t1)                                                                                              \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_1(xPriority,xCoalesce,xMethod,t1)                                                                          \
     class Stub_1_##xMethod : public IMessageQueueMessage                                                                                            \
     {                                                                                                                                               \
     private:                                                                                                                                        \
@@ -1201,6 +1289,8 @@ namespace zsLib
                                                                                                                                                     \
       const char *getDelegateName() const noexcept override {return typeid(Delegate).name();}                                                       \
       const char *getMethodName() const noexcept override {return #xMethod;}                                                                        \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                            \
+      xCoalesce(Stub_1_##xMethod)                                                                                                                   \
       void processMessage() noexcept override {                                                                                                     \
         mDelegate->xMethod(m1);                                                                                                                     \
       }                                                                                                                                             \
@@ -1208,12 +1298,13 @@ namespace zsLib
                                                                                                                                                     \
     void xMethod(t1 v1) override {                                                                                                                  \
       if (ignoreMethodCall()) return;                                                                                                               \
+      if (callDirect()) {getDelegate()->xMethod(v1); return;}                                                                                       \
       ZS_INTERNAL_DECLARE_STUB_PTR(Stub_1_##xMethod)                                                                                                \
       Stub_1_##xMethod##UniPtr stub(new Stub_1_##xMethod(getDelegate(),v1));                                                                        \
       mQueue->post(std::move(stub));                                                                                                                \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_2(xMethod,t1,t2)                                                                                           \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_2(xPriority,xCoalesce,xMethod,t1,t2)                                                                       \
     class Stub_2_##xMethod : public IMessageQueueMessage                                                                                            \
     {                                                                                                                                               \
     private:                                                                                                                                        \
@@ -1231,6 +1322,8 @@ namespace zsLib
                                                                                                                                                     \
       const char *getDelegateName() const noexcept override {return typeid(Delegate).name();}                                                       \
       const char *getMethodName() const noexcept override {return #xMethod;}                                                                        \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                            \
+      xCoalesce(Stub_2_##xMethod)                                                                                                                   \
       void processMessage() noexcept override {                                                                                                     \
         mDelegate->xMethod(m1,m2);                                                                                                                  \
       }                                                                                                                                             \
@@ -1238,12 +1331,13 @@ namespace zsLib
                                                                                                                                                     \
     void xMethod(t1 v1,t2 v2) override {                                                                                                            \
       if (ignoreMethodCall()) return;                                                                                                               \
+      if (callDirect()) {getDelegate()->xMethod(v1,v2); return;}                                                                                    \
       ZS_INTERNAL_DECLARE_STUB_PTR(Stub_2_##xMethod)                                                                                                \
       Stub_2_##xMethod##UniPtr stub(new Stub_2_##xMethod(getDelegate(),v1,v2));                                                                     \
       mQueue->post(std::move(stub));                                                                                                                \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_3(xMethod,t1,t2,t3)                                                                                        \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_3(xPriority,xCoalesce,xMethod,t1,t2,t3)                                                                    \
     class Stub_3_##xMethod : public IMessageQueueMessage                                                                                            \
     {                                                                                                                                               \
     private:                                                                                                                                        \
@@ -1263,6 +1357,8 @@ namespace zsLib
                                                                                                                                                     \
       const char *getDelegateName() const noexcept override {return typeid(Delegate).name();}                                                       \
       const char *getMethodName() const noexcept override {return #xMethod;}                                                                        \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                            \
+      xCoalesce(Stub_3_##xMethod)                                                                                                                   \
       void processMessage() noexcept override {                                                                                                     \
         mDelegate->xMethod(m1,m2,m3);                                                                                                               \
       }                                                                                                                                             \
@@ -1270,12 +1366,13 @@ namespace zsLib
                                                                                                                                                     \
     void xMethod(t1 v1,t2 v2,t3 v3) override {                                                                                                      \
       if (ignoreMethodCall()) return;                                                                                                               \
+      if (callDirect()) {getDelegate()->xMethod(v1,v2,v3); return;}                                                                                 \
       ZS_INTERNAL_DECLARE_STUB_PTR(Stub_3_##xMethod)                                                                                                \
       Stub_3_##xMethod##UniPtr stub(new Stub_3_##xMethod(getDelegate(),v1,v2,v3));                                                                  \
       mQueue->post(std::move(stub));                                                                                                                \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_4(xMethod,t1,t2,t3,t4)                                                                                     \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_4(xPriority,xCoalesce,xMethod,t1,t2,t3,t4)                                                                 \
     class Stub_4_##xMethod : public IMessageQueueMessage                                                                                            \
     {                                                                                                                                               \
     private:                                                                                                                                        \
@@ -1297,6 +1394,8 @@ namespace zsLib
                                                                                                                                                     \
       const char *getDelegateName() const noexcept override {return typeid(Delegate).name();}                                                       \
       const char *getMethodName() const noexcept override {return #xMethod;}                                                                        \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                            \
+      xCoalesce(Stub_4_##xMethod)                                                                                                                   \
       void processMessage() noexcept override {                                                                                                     \
         mDelegate->xMethod(m1,m2,m3,m4);                                                                                                            \
       }                                                                                                                                             \
@@ -1304,12 +1403,13 @@ namespace zsLib
                                                                                                                                                     \
     void xMethod(t1 v1,t2 v2,t3 v3,t4 v4) override {                                                                                                \
       if (ignoreMethodCall()) return;                                                                                                               \
+      if (callDirect()) {getDelegate()->xMethod(v1,v2,v3,v4); return;}                                                                              \
       ZS_INTERNAL_DECLARE_STUB_PTR(Stub_4_##xMethod)                                                                                                \
       Stub_4_##xMethod##UniPtr stub(new Stub_4_##xMethod(getDelegate(),v1,v2,v3,v4));                                                               \
       mQueue->post(std::move(stub));                                                                                                                \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_5(xMethod,t1,t2,t3,t4,t5)                                                                                  \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_5(xPriority,xCoalesce,xMethod,t1,t2,t3,t4,t5)                                                              \
     class Stub_5_##xMethod : public IMessageQueueMessage                                                                                            \
     {                                                                                                                                               \
     private:                                                                                                                                        \
@@ -1333,6 +1433,8 @@ namespace zsLib
                                                                                                                                                     \
       const char *getDelegateName() const noexcept override {return typeid(Delegate).name();}                                                       \
       const char *getMethodName() const noexcept override {return #xMethod;}                                                                        \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                            \
+      xCoalesce(Stub_5_##xMethod)                                                                                                                   \
       void processMessage() noexcept override {                                                                                                     \
         mDelegate->xMethod(m1,m2,m3,m4,m5);                                                                                                         \
       }                                                                                                                                             \
@@ -1340,12 +1442,13 @@ namespace zsLib
                                                                                                                                                     \
     void xMethod(t1 v1,t2 v2,t3 v3,t4 v4,t5 v5) override {                                                                                          \
       if (ignoreMethodCall()) return;                                                                                                               \
+      if (callDirect()) {getDelegate()->xMethod(v1,v2,v3,v4,v5); return;}                                                                           \
       ZS_INTERNAL_DECLARE_STUB_PTR(Stub_5_##xMethod)                                                                                                \
       Stub_5_##xMethod##UniPtr stub(new Stub_5_##xMethod(getDelegate(),v1,v2,v3,v4,v5));                                                            \
       mQueue->post(std::move(stub));                                                                                                                \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_6(xMethod,t1,t2,t3,t4,t5,t6)                                                                               \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_6(xPriority,xCoalesce,xMethod,t1,t2,t3,t4,t5,t6)                                                           \
     class Stub_6_##xMethod : public IMessageQueueMessage                                                                                            \
     {                                                                                                                                               \
     private:                                                                                                                                        \
@@ -1371,6 +1474,8 @@ namespace zsLib
                                                                                                                                                     \
       const char *getDelegateName() const noexcept override {return typeid(Delegate).name();}                                                       \
       const char *getMethodName() const noexcept override {return #xMethod;}                                                                        \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                            \
+      xCoalesce(Stub_6_##xMethod)                                                                                                                   \
       void processMessage() noexcept override {                                                                                                     \
         mDelegate->xMethod(m1,m2,m3,m4,m5,m6);                                                                                                      \
       }                                                                                                                                             \
@@ -1378,12 +1483,13 @@ namespace zsLib
                                                                                                                                                     \
     void xMethod(t1 v1,t2 v2,t3 v3,t4 v4,t5 v5,t6 v6) override {                                                                                    \
       if (ignoreMethodCall()) return;                                                                                                               \
+      if (callDirect()) {getDelegate()->xMethod(v1,v2,v3,v4,v5,v6); return;}                                                                        \
       ZS_INTERNAL_DECLARE_STUB_PTR(Stub_6_##xMethod)                                                                                                \
       Stub_6_##xMethod##UniPtr stub(new Stub_6_##xMethod(getDelegate(),v1,v2,v3,v4,v5,v6));                                                         \
       mQueue->post(std::move(stub));                                                                                                                \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_7(xMethod,t1,t2,t3,t4,t5,t6,t7)                                                                            \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_7(xPriority,xCoalesce,xMethod,t1,t2,t3,t4,t5,t6,t7)                                                        \
     class Stub_7_##xMethod : public IMessageQueueMessage                                                                                            \
     {                                                                                                                                               \
     private:                                                                                                                                        \
@@ -1411,6 +1517,8 @@ namespace zsLib
                                                                                                                                                     \
       const char *getDelegateName() const noexcept override {return typeid(Delegate).name();}                                                       \
       const char *getMethodName() const noexcept override {return #xMethod;}                                                                        \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                            \
+      xCoalesce(Stub_7_##xMethod)                                                                                                                   \
       void processMessage() noexcept override {                                                                                                     \
         mDelegate->xMethod(m1,m2,m3,m4,m5,m6,m7);                                                                                                   \
       }                                                                                                                                             \
@@ -1418,12 +1526,13 @@ namespace zsLib
                                                                                                                                                     \
     void xMethod(t1 v1,t2 v2,t3 v3,t4 v4,t5 v5,t6 v6,t7 v7) override {                                                                              \
       if (ignoreMethodCall()) return;                                                                                                               \
+      if (callDirect()) {getDelegate()->xMethod(v1,v2,v3,v4,v5,v6,v7); return;}                                                                     \
       ZS_INTERNAL_DECLARE_STUB_PTR(Stub_7_##xMethod)                                                                                                \
       Stub_7_##xMethod##UniPtr stub(new Stub_7_##xMethod(getDelegate(),v1,v2,v3,v4,v5,v6,v7));                                                      \
       mQueue->post(std::move(stub));                                                                                                                \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_8(xMethod,t1,t2,t3,t4,t5,t6,t7,t8)                                                                         \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_8(xPriority,xCoalesce,xMethod,t1,t2,t3,t4,t5,t6,t7,t8)                                                     \
     class Stub_8_##xMethod : public IMessageQueueMessage                                                                                            \
     {                                                                                                                                               \
     private:                                                                                                                                        \
@@ -1453,6 +1562,8 @@ namespace zsLib
                                                                                                                                                     \
       const char *getDelegateName() const noexcept override {return typeid(Delegate).name();}                                                       \
       const char *getMethodName() const noexcept override {return #xMethod;}                                                                        \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                            \
+      xCoalesce(Stub_8_##xMethod)                                                                                                                   \
       void processMessage() noexcept override {                                                                                                     \
         mDelegate->xMethod(m1,m2,m3,m4,m5,m6,m7,m8);                                                                                                \
       }                                                                                                                                             \
@@ -1460,12 +1571,13 @@ namespace zsLib
                                                                                                                                                     \
     void xMethod(t1 v1,t2 v2,t3 v3,t4 v4,t5 v5,t6 v6,t7 v7,t8 v8) override {                                                                        \
       if (ignoreMethodCall()) return;                                                                                                               \
+      if (callDirect()) {getDelegate()->xMethod(v1,v2,v3,v4,v5,v6,v7,v8); return;}                                                                  \
       ZS_INTERNAL_DECLARE_STUB_PTR(Stub_8_##xMethod)                                                                                                \
       Stub_8_##xMethod##UniPtr stub(new Stub_8_##xMethod(getDelegate(),v1,v2,v3,v4,v5,v6,v7,v8));                                                   \
       mQueue->post(std::move(stub));                                                                                                                \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_9(xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9)                                                                      \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_9(xPriority,xCoalesce,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9)                                                  \
     class Stub_9_##xMethod : public IMessageQueueMessage                                                                                            \
     {                                                                                                                                               \
     private:                                                                                                                                        \
@@ -1497,6 +1609,8 @@ namespace zsLib
                                                                                                                                                     \
       const char *getDelegateName() const noexcept override {return typeid(Delegate).name();}                                                       \
       const char *getMethodName() const noexcept override {return #xMethod;}                                                                        \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                            \
+      xCoalesce(Stub_9_##xMethod)                                                                                                                   \
       void processMessage() noexcept override {                                                                                                     \
         mDelegate->xMethod(m1,m2,m3,m4,m5,m6,m7,m8,m9);                                                                                             \
       }                                                                                                                                             \
@@ -1504,12 +1618,13 @@ namespace zsLib
                                                                                                                                                     \
     void xMethod(t1 v1,t2 v2,t3 v3,t4 v4,t5 v5,t6 v6,t7 v7,t8 v8,t9 v9) override {                                                                  \
       if (ignoreMethodCall()) return;                                                                                                               \
+      if (callDirect()) {getDelegate()->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9); return;}                                                               \
       ZS_INTERNAL_DECLARE_STUB_PTR(Stub_9_##xMethod)                                                                                                \
       Stub_9_##xMethod##UniPtr stub(new Stub_9_##xMethod(getDelegate(),v1,v2,v3,v4,v5,v6,v7,v8,v9));                                                \
       mQueue->post(std::move(stub));                                                                                                                \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_10(xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10)                                                                 \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_10(xPriority,xCoalesce,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10)                                             \
     class Stub_10_##xMethod : public IMessageQueueMessage                                                                                           \
     {                                                                                                                                               \
     private:                                                                                                                                        \
@@ -1543,6 +1658,8 @@ namespace zsLib
                                                                                                                                                     \
       const char *getDelegateName() const noexcept override {return typeid(Delegate).name();}                                                       \
       const char *getMethodName() const noexcept override {return #xMethod;}                                                                        \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                            \
+      xCoalesce(Stub_10_##xMethod)                                                                                                                  \
       void processMessage() noexcept override {                                                                                                     \
         mDelegate->xMethod(m1,m2,m3,m4,m5,m6,m7,m8,m9,m10);                                                                                         \
       }                                                                                                                                             \
@@ -1550,12 +1667,13 @@ namespace zsLib
                                                                                                                                                     \
     void xMethod(t1 v1,t2 v2,t3 v3,t4 v4,t5 v5,t6 v6,t7 v7,t8 v8,t9 v9,t10 v10) override {                                                          \
       if (ignoreMethodCall()) return;                                                                                                               \
+      if (callDirect()) {getDelegate()->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10); return;}                                                           \
       ZS_INTERNAL_DECLARE_STUB_PTR(Stub_10_##xMethod)                                                                                               \
       Stub_10_##xMethod##UniPtr stub(new Stub_10_##xMethod(getDelegate(),v1,v2,v3,v4,v5,v6,v7,v8,v9,v10));                                          \
       mQueue->post(std::move(stub));                                                                                                                \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_11(xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11)                                                             \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_11(xPriority,xCoalesce,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11)                                         \
     class Stub_11_##xMethod : public IMessageQueueMessage                                                                                           \
     {                                                                                                                                               \
     private:                                                                                                                                        \
@@ -1591,6 +1709,8 @@ namespace zsLib
                                                                                                                                                     \
       const char *getDelegateName() const noexcept override {return typeid(Delegate).name();}                                                       \
       const char *getMethodName() const noexcept override {return #xMethod;}                                                                        \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                            \
+      xCoalesce(Stub_11_##xMethod)                                                                                                                  \
       void processMessage() noexcept override {                                                                                                     \
         mDelegate->xMethod(m1,m2,m3,m4,m5,m6,m7,m8,m9,m10,m11);                                                                                     \
       }                                                                                                                                             \
@@ -1598,12 +1718,13 @@ namespace zsLib
                                                                                                                                                     \
     void xMethod(t1 v1,t2 v2,t3 v3,t4 v4,t5 v5,t6 v6,t7 v7,t8 v8,t9 v9,t10 v10,t11 v11) override {                                                  \
       if (ignoreMethodCall()) return;                                                                                                               \
+      if (callDirect()) {getDelegate()->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11); return;}                                                       \
       ZS_INTERNAL_DECLARE_STUB_PTR(Stub_11_##xMethod)                                                                                               \
       Stub_11_##xMethod##UniPtr stub(new Stub_11_##xMethod(getDelegate(),v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11));                                      \
       mQueue->post(std::move(stub));                                                                                                                \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_12(xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12)                                                         \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_12(xPriority,xCoalesce,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12)                                     \
     class Stub_12_##xMethod : public IMessageQueueMessage                                                                                           \
     {                                                                                                                                               \
     private:                                                                                                                                        \
@@ -1641,6 +1762,8 @@ namespace zsLib
                                                                                                                                                     \
       const char *getDelegateName() const noexcept override {return typeid(Delegate).name();}                                                       \
       const char *getMethodName() const noexcept override {return #xMethod;}                                                                        \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                            \
+      xCoalesce(Stub_12_##xMethod)                                                                                                                  \
       void processMessage() noexcept override {                                                                                                     \
         mDelegate->xMethod(m1,m2,m3,m4,m5,m6,m7,m8,m9,m10,m11,m12);                                                                                 \
       }                                                                                                                                             \
@@ -1648,12 +1771,13 @@ namespace zsLib
                                                                                                                                                     \
     void xMethod(t1 v1,t2 v2,t3 v3,t4 v4,t5 v5,t6 v6,t7 v7,t8 v8,t9 v9,t10 v10,t11 v11,t12 v12) override {                                          \
       if (ignoreMethodCall()) return;                                                                                                               \
+      if (callDirect()) {getDelegate()->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12); return;}                                                   \
       ZS_INTERNAL_DECLARE_STUB_PTR(Stub_12_##xMethod)                                                                                               \
       Stub_12_##xMethod##UniPtr stub(new Stub_12_##xMethod(getDelegate(),v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12));                                  \
       mQueue->post(std::move(stub));                                                                                                                \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_13(xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13)                                                                                                                 \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_13(xPriority,xCoalesce,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13)                                                                                             \
     class Stub_13_##xMethod : public IMessageQueueMessage                                                                                                                                                       \
     {                                                                                                                                                                                                           \
     private:                                                                                                                                                                                                    \
@@ -1693,6 +1817,8 @@ namespace zsLib
                                                                                                                                                                                                                 \
       const char *getDelegateName() const noexcept override {return typeid(Delegate).name();}                                                                                                                   \
       const char *getMethodName() const noexcept override {return #xMethod;}                                                                                                                                    \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                                                                                        \
+      xCoalesce(Stub_13_##xMethod)                                                                                                                                                                              \
       void processMessage() noexcept override {                                                                                                                                                                 \
         mDelegate->xMethod(m1,m2,m3,m4,m5,m6,m7,m8,m9,m10,m11,m12,m13);                                                                                                                                         \
       }                                                                                                                                                                                                         \
@@ -1700,12 +1826,13 @@ namespace zsLib
                                                                                                                                                                                                                 \
     void xMethod(t1 v1,t2 v2,t3 v3,t4 v4,t5 v5,t6 v6,t7 v7,t8 v8,t9 v9,t10 v10,t11 v11,t12 v12,t13 v13) override {                                                                                              \
       if (ignoreMethodCall()) return;                                                                                                                                                                           \
+      if (callDirect()) {getDelegate()->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13); return;}                                                                                                           \
       ZS_INTERNAL_DECLARE_STUB_PTR(Stub_13_##xMethod)                                                                                                                                                           \
       Stub_13_##xMethod##UniPtr stub(new Stub_13_##xMethod(getDelegate(),v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13));                                                                                          \
       mQueue->post(std::move(stub));                                                                                                                                                                            \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_14(xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14)                                                                                                             \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_14(xPriority,xCoalesce,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14)                                                                                         \
     class Stub_14_##xMethod : public IMessageQueueMessage                                                                                                                                                       \
     {                                                                                                                                                                                                           \
     private:                                                                                                                                                                                                    \
@@ -1747,6 +1874,8 @@ namespace zsLib
                                                                                                                                                                                                                 \
       const char *getDelegateName() const noexcept override {return typeid(Delegate).name();}                                                                                                                   \
       const char *getMethodName() const noexcept override {return #xMethod;}                                                                                                                                    \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                                                                                        \
+      xCoalesce(Stub_14_##xMethod)                                                                                                                                                                              \
       void processMessage() noexcept override {                                                                                                                                                                 \
         mDelegate->xMethod(m1,m2,m3,m4,m5,m6,m7,m8,m9,m10,m11,m12,m13,m14);                                                                                                                                     \
       }                                                                                                                                                                                                         \
@@ -1754,12 +1883,13 @@ namespace zsLib
                                                                                                                                                                                                                 \
     void xMethod(t1 v1,t2 v2,t3 v3,t4 v4,t5 v5,t6 v6,t7 v7,t8 v8,t9 v9,t10 v10,t11 v11,t12 v12,t13 v13,t14 v14) override {                                                                                      \
       if (ignoreMethodCall()) return;                                                                                                                                                                           \
+      if (callDirect()) {getDelegate()->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14); return;}                                                                                                       \
       ZS_INTERNAL_DECLARE_STUB_PTR(Stub_14_##xMethod)                                                                                                                                                           \
       Stub_14_##xMethod##UniPtr stub(new Stub_14_##xMethod(getDelegate(),v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14));                                                                                      \
       mQueue->post(std::move(stub));                                                                                                                                                                            \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_15(xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15)                                                                                                         \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_15(xPriority,xCoalesce,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15)                                                                                     \
     class Stub_15_##xMethod : public IMessageQueueMessage                                                                                                                                                       \
     {                                                                                                                                                                                                           \
     private:                                                                                                                                                                                                    \
@@ -1803,6 +1933,8 @@ namespace zsLib
                                                                                                                                                                                                                 \
       const char *getDelegateName() const noexcept override {return typeid(Delegate).name();}                                                                                                                   \
       const char *getMethodName() const noexcept override {return #xMethod;}                                                                                                                                    \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                                                                                        \
+      xCoalesce(Stub_15_##xMethod)                                                                                                                                                                              \
       void processMessage() noexcept override {                                                                                                                                                                 \
         mDelegate->xMethod(m1,m2,m3,m4,m5,m6,m7,m8,m9,m10,m11,m12,m13,m14,m15);                                                                                                                                 \
       }                                                                                                                                                                                                         \
@@ -1810,12 +1942,13 @@ namespace zsLib
                                                                                                                                                                                                                 \
     void xMethod(t1 v1,t2 v2,t3 v3,t4 v4,t5 v5,t6 v6,t7 v7,t8 v8,t9 v9,t10 v10,t11 v11,t12 v12,t13 v13,t14 v14,t15 v15) override {                                                                              \
       if (ignoreMethodCall()) return;                                                                                                                                                                           \
+      if (callDirect()) {getDelegate()->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15); return;}                                                                                                   \
       ZS_INTERNAL_DECLARE_STUB_PTR(Stub_15_##xMethod)                                                                                                                                                           \
       Stub_15_##xMethod##UniPtr stub(new Stub_15_##xMethod(getDelegate(),v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15));                                                                                  \
       mQueue->post(std::move(stub));                                                                                                                                                                            \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_16(xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16)                                                                                                     \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_16(xPriority,xCoalesce,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16)                                                                                 \
     class Stub_16_##xMethod : public IMessageQueueMessage                                                                                                                                                       \
     {                                                                                                                                                                                                           \
     private:                                                                                                                                                                                                    \
@@ -1861,6 +1994,8 @@ namespace zsLib
                                                                                                                                                                                                                 \
       const char *getDelegateName() const noexcept override {return typeid(Delegate).name();}                                                                                                                   \
       const char *getMethodName() const noexcept override {return #xMethod;}                                                                                                                                    \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                                                                                        \
+      xCoalesce(Stub_16_##xMethod)                                                                                                                                                                              \
       void processMessage() noexcept override {                                                                                                                                                                 \
         mDelegate->xMethod(m1,m2,m3,m4,m5,m6,m7,m8,m9,m10,m11,m12,m13,m14,m15,m16);                                                                                                                             \
       }                                                                                                                                                                                                         \
@@ -1868,12 +2003,13 @@ namespace zsLib
                                                                                                                                                                                                                 \
     void xMethod(t1 v1,t2 v2,t3 v3,t4 v4,t5 v5,t6 v6,t7 v7,t8 v8,t9 v9,t10 v10,t11 v11,t12 v12,t13 v13,t14 v14,t15 v15,t16 v16) override {                                                                      \
       if (ignoreMethodCall()) return;                                                                                                                                                                           \
+      if (callDirect()) {getDelegate()->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16); return;}                                                                                               \
       ZS_INTERNAL_DECLARE_STUB_PTR(Stub_16_##xMethod)                                                                                                                                                           \
       Stub_16_##xMethod##UniPtr stub(new Stub_16_##xMethod(getDelegate(),v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16));                                                                              \
       mQueue->post(std::move(stub));                                                                                                                                                                            \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_17(xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17)                                                                                                 \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_17(xPriority,xCoalesce,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17)                                                                             \
     class Stub_17_##xMethod : public IMessageQueueMessage                                                                                                                                                       \
     {                                                                                                                                                                                                           \
     private:                                                                                                                                                                                                    \
@@ -1921,6 +2057,8 @@ namespace zsLib
                                                                                                                                                                                                                 \
       const char *getDelegateName() const override noexcept {return typeid(Delegate).name();}                                                                                                                   \
       const char *getMethodName() const override noexcept {return #xMethod;}                                                                                                                                    \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                                                                                        \
+      xCoalesce(Stub_17_##xMethod)                                                                                                                                                                              \
       void processMessage() noexcept override {                                                                                                                                                                 \
         mDelegate->xMethod(m1,m2,m3,m4,m5,m6,m7,m8,m9,m10,m11,m12,m13,m14,m15,m16,m17);                                                                                                                         \
       }                                                                                                                                                                                                         \
@@ -1928,12 +2066,13 @@ namespace zsLib
                                                                                                                                                                                                                 \
     void xMethod(t1 v1,t2 v2,t3 v3,t4 v4,t5 v5,t6 v6,t7 v7,t8 v8,t9 v9,t10 v10,t11 v11,t12 v12,t13 v13,t14 v14,t15 v15,t16 v16,t17 v17) override {                                                              \
       if (ignoreMethodCall()) return;                                                                                                                                                                           \
+      if (callDirect()) {getDelegate()->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17); return;}                                                                                           \
       ZS_INTERNAL_DECLARE_STUB_PTR(Stub_17_##xMethod)                                                                                                                                                           \
       Stub_17_##xMethod##UniPtr stub(new Stub_17_##xMethod(getDelegate(),v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17));                                                                          \
       mQueue->post(std::move(stub));                                                                                                                                                                            \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_18(xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18)                                                                                             \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_18(xPriority,xCoalesce,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18)                                                                         \
     class Stub_18_##xMethod : public IMessageQueueMessage                                                                                                                                                       \
     {                                                                                                                                                                                                           \
     private:                                                                                                                                                                                                    \
@@ -1983,6 +2122,8 @@ namespace zsLib
                                                                                                                                                                                                                 \
       const char *getDelegateName() const noexcept override {return typeid(Delegate).name();}                                                                                                                   \
       const char *getMethodName() const noexcept override {return #xMethod;}                                                                                                                                    \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                                                                                        \
+      xCoalesce(Stub_18_##xMethod)                                                                                                                                                                              \
       void processMessage() noexcept override {                                                                                                                                                                 \
         mDelegate->xMethod(m1,m2,m3,m4,m5,m6,m7,m8,m9,m10,m11,m12,m13,m14,m15,m16,m17,m18);                                                                                                                     \
       }                                                                                                                                                                                                         \
@@ -1990,12 +2131,13 @@ namespace zsLib
                                                                                                                                                                                                                 \
     void xMethod(t1 v1,t2 v2,t3 v3,t4 v4,t5 v5,t6 v6,t7 v7,t8 v8,t9 v9,t10 v10,t11 v11,t12 v12,t13 v13,t14 v14,t15 v15,t16 v16,t17 v17,t18 v18) override {                                                      \
       if (ignoreMethodCall()) return;                                                                                                                                                                           \
+      if (callDirect()) {getDelegate()->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17,v18); return;}                                                                                       \
       ZS_INTERNAL_DECLARE_STUB_PTR(Stub_18_##xMethod)                                                                                                                                                           \
       Stub_18_##xMethod##UniPtr stub(new Stub_18_##xMethod(getDelegate(),v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17,v18));                                                                      \
       mQueue->post(std::move(stub));                                                                                                                                                                            \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_19(xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19)                                                                                         \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_19(xPriority,xCoalesce,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19)                                                                     \
     class Stub_19_##xMethod : public IMessageQueueMessage                                                                                                                                                       \
     {                                                                                                                                                                                                           \
     private:                                                                                                                                                                                                    \
@@ -2047,6 +2189,8 @@ namespace zsLib
                                                                                                                                                                                                                 \
       const char *getDelegateName() const noexcept override {return typeid(Delegate).name();}                                                                                                                   \
       const char *getMethodName() const noexcept override {return #xMethod;}                                                                                                                                    \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                                                                                        \
+      xCoalesce(Stub_19_##xMethod)                                                                                                                                                                              \
       void processMessage() noexcept override {                                                                                                                                                                 \
         mDelegate->xMethod(m1,m2,m3,m4,m5,m6,m7,m8,m9,m10,m11,m12,m13,m14,m15,m16,m17,m18,m19);                                                                                                                 \
       }                                                                                                                                                                                                         \
@@ -2054,12 +2198,13 @@ namespace zsLib
                                                                                                                                                                                                                 \
     void xMethod(t1 v1,t2 v2,t3 v3,t4 v4,t5 v5,t6 v6,t7 v7,t8 v8,t9 v9,t10 v10,t11 v11,t12 v12,t13 v13,t14 v14,t15 v15,t16 v16,t17 v17,t18 v18,t19 v19) override {                                              \
       if (ignoreMethodCall()) return;                                                                                                                                                                           \
+      if (callDirect()) {getDelegate()->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17,v18,v19); return;}                                                                                   \
       ZS_INTERNAL_DECLARE_STUB_PTR(Stub_19_##xMethod)                                                                                                                                                           \
       Stub_19_##xMethod##UniPtr stub(new Stub_19_##xMethod(getDelegate(),v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17,v18,v19));                                                                  \
       mQueue->post(std::move(stub));                                                                                                                                                                            \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_20(xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20)                                                                                     \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_20(xPriority,xCoalesce,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20)                                                                 \
     class Stub_20_##xMethod : public IMessageQueueMessage                                                                                                                                                       \
     {                                                                                                                                                                                                           \
     private:                                                                                                                                                                                                    \
@@ -2113,6 +2258,8 @@ namespace zsLib
                                                                                                                                                                                                                 \
       const char *getDelegateName() const noexcept override {return typeid(Delegate).name();}                                                                                                                   \
       const char *getMethodName() const noexcept override {return #xMethod;}                                                                                                                                    \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                                                                                        \
+      xCoalesce(Stub_20_##xMethod)                                                                                                                                                                              \
       void processMessage() noexcept override {                                                                                                                                                                 \
         mDelegate->xMethod(m1,m2,m3,m4,m5,m6,m7,m8,m9,m10,m11,m12,m13,m14,m15,m16,m17,m18,m19,m20);                                                                                                             \
       }                                                                                                                                                                                                         \
@@ -2120,12 +2267,13 @@ namespace zsLib
                                                                                                                                                                                                                 \
     void xMethod(t1 v1,t2 v2,t3 v3,t4 v4,t5 v5,t6 v6,t7 v7,t8 v8,t9 v9,t10 v10,t11 v11,t12 v12,t13 v13,t14 v14,t15 v15,t16 v16,t17 v17,t18 v18,t19 v19,t20 v20) override {                                      \
       if (ignoreMethodCall()) return;                                                                                                                                                                           \
+      if (callDirect()) {getDelegate()->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17,v18,v19,v20); return;}                                                                               \
       ZS_INTERNAL_DECLARE_STUB_PTR(Stub_20_##xMethod)                                                                                                                                                           \
       Stub_20_##xMethod##UniPtr stub(new Stub_20_##xMethod(getDelegate(),v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17,v18,v19,v20));                                                              \
       mQueue->post(std::move(stub));                                                                                                                                                                            \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_21(xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21)                                                                                 \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_21(xPriority,xCoalesce,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21)                                                             \
     class Stub_21_##xMethod : public IMessageQueueMessage                                                                                                                                                       \
     {                                                                                                                                                                                                           \
     private:                                                                                                                                                                                                    \
@@ -2181,6 +2329,8 @@ namespace zsLib
                                                                                                                                                                                                                 \
       const char *getDelegateName() const noexcept override {return typeid(Delegate).name();}                                                                                                                   \
       const char *getMethodName() const noexcept override {return #xMethod;}                                                                                                                                    \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                                                                                        \
+      xCoalesce(Stub_21_##xMethod)                                                                                                                                                                              \
       void processMessage() noexcept override {                                                                                                                                                                 \
         mDelegate->xMethod(m1,m2,m3,m4,m5,m6,m7,m8,m9,m10,m11,m12,m13,m14,m15,m16,m17,m18,m19,m20,m21);                                                                                                         \
       }                                                                                                                                                                                                         \
@@ -2188,12 +2338,13 @@ namespace zsLib
                                                                                                                                                                                                                 \
     void xMethod(t1 v1,t2 v2,t3 v3,t4 v4,t5 v5,t6 v6,t7 v7,t8 v8,t9 v9,t10 v10,t11 v11,t12 v12,t13 v13,t14 v14,t15 v15,t16 v16,t17 v17,t18 v18,t19 v19,t20 v20,t21 v21) override {                              \
       if (ignoreMethodCall()) return;                                                                                                                                                                           \
+      if (callDirect()) {getDelegate()->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17,v18,v19,v20,v21); return;}                                                                           \
       ZS_INTERNAL_DECLARE_STUB_PTR(Stub_21_##xMethod)                                                                                                                                                           \
       Stub_21_##xMethod##UniPtr stub(new Stub_21_##xMethod(getDelegate(),v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17,v18,v19,v20,v21));                                                          \
       mQueue->post(std::move(stub));                                                                                                                                                                            \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_22(xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21,t22)                                                                             \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_22(xPriority,xCoalesce,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21,t22)                                                         \
     class Stub_22_##xMethod : public IMessageQueueMessage                                                                                                                                                       \
     {                                                                                                                                                                                                           \
     private:                                                                                                                                                                                                    \
@@ -2251,6 +2402,8 @@ namespace zsLib
                                                                                                                                                                                                                 \
       const char *getDelegateName() const noexcept override {return typeid(Delegate).name();}                                                                                                                   \
       const char *getMethodName() const noexcept override {return #xMethod;}                                                                                                                                    \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                                                                                        \
+      xCoalesce(Stub_22_##xMethod)                                                                                                                                                                              \
       void processMessage() noexcept override {                                                                                                                                                                 \
         mDelegate->xMethod(m1,m2,m3,m4,m5,m6,m7,m8,m9,m10,m11,m12,m13,m14,m15,m16,m17,m18,m19,m20,m21,m22);                                                                                                     \
       }                                                                                                                                                                                                         \
@@ -2258,12 +2411,13 @@ namespace zsLib
                                                                                                                                                                                                                 \
     void xMethod(t1 v1,t2 v2,t3 v3,t4 v4,t5 v5,t6 v6,t7 v7,t8 v8,t9 v9,t10 v10,t11 v11,t12 v12,t13 v13,t14 v14,t15 v15,t16 v16,t17 v17,t18 v18,t19 v19,t20 v20,t21 v21,t22 v22) override {                      \
       if (ignoreMethodCall()) return;                                                                                                                                                                           \
+      if (callDirect()) {getDelegate()->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17,v18,v19,v20,v21,v22); return;}                                                                       \
       ZS_INTERNAL_DECLARE_STUB_PTR(Stub_22_##xMethod)                                                                                                                                                           \
       Stub_22_##xMethod##UniPtr stub(new Stub_22_##xMethod(getDelegate(),v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17,v18,v19,v20,v21,v22));                                                      \
       mQueue->post(std::move(stub));                                                                                                                                                                            \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_23(xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21,t22,t23)                                                                         \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_23(xPriority,xCoalesce,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21,t22,t23)                                                     \
     class Stub_23_##xMethod : public IMessageQueueMessage                                                                                                                                                       \
     {                                                                                                                                                                                                           \
     private:                                                                                                                                                                                                    \
@@ -2323,6 +2477,8 @@ namespace zsLib
                                                                                                                                                                                                                 \
       const char *getDelegateName() const noexcept override {return typeid(Delegate).name();}                                                                                                                   \
       const char *getMethodName() const noexcept override {return #xMethod;}                                                                                                                                    \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                                                                                        \
+      xCoalesce(Stub_23_##xMethod)                                                                                                                                                                              \
       void processMessage() noexcept override {                                                                                                                                                                 \
         mDelegate->xMethod(m1,m2,m3,m4,m5,m6,m7,m8,m9,m10,m11,m12,m13,m14,m15,m16,m17,m18,m19,m20,m21,m22,m23);                                                                                                 \
       }                                                                                                                                                                                                         \
@@ -2330,12 +2486,13 @@ namespace zsLib
                                                                                                                                                                                                                 \
     void xMethod(t1 v1,t2 v2,t3 v3,t4 v4,t5 v5,t6 v6,t7 v7,t8 v8,t9 v9,t10 v10,t11 v11,t12 v12,t13 v13,t14 v14,t15 v15,t16 v16,t17 v17,t18 v18,t19 v19,t20 v20,t21 v21,t22 v22,t23 v23) override {              \
       if (ignoreMethodCall()) return;                                                                                                                                                                           \
+      if (callDirect()) {getDelegate()->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17,v18,v19,v20,v21,v22,v23); return;}                                                                   \
       ZS_INTERNAL_DECLARE_STUB_PTR(Stub_23_##xMethod)                                                                                                                                                           \
       Stub_23_##xMethod##UniPtr stub(new Stub_23_##xMethod(getDelegate(),v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17,v18,v19,v20,v21,v22,v23));                                                  \
       mQueue->post(std::move(stub));                                                                                                                                                                            \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_24(xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21,t22,t23,t24)                                                                     \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_24(xPriority,xCoalesce,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21,t22,t23,t24)                                                 \
     class Stub_24_##xMethod : public IMessageQueueMessage                                                                                                                                                       \
     {                                                                                                                                                                                                           \
     private:                                                                                                                                                                                                    \
@@ -2397,6 +2554,8 @@ namespace zsLib
                                                                                                                                                                                                                     \
       const char *getDelegateName() const noexcept override {return typeid(Delegate).name();}                                                                                                                       \
       const char *getMethodName() const noexcept override {return #xMethod;}                                                                                                                                        \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                                                                                            \
+      xCoalesce(Stub_24_##xMethod)                                                                                                                                                                                  \
       void processMessage() noexcept override {                                                                                                                                                                     \
         mDelegate->xMethod(m1,m2,m3,m4,m5,m6,m7,m8,m9,m10,m11,m12,m13,m14,m15,m16,m17,m18,m19,m20,m21,m22,m23,m24);                                                                                                 \
       }                                                                                                                                                                                                             \
@@ -2404,12 +2563,13 @@ namespace zsLib
                                                                                                                                                                                                                     \
     void xMethod(t1 v1,t2 v2,t3 v3,t4 v4,t5 v5,t6 v6,t7 v7,t8 v8,t9 v9,t10 v10,t11 v11,t12 v12,t13 v13,t14 v14,t15 v15,t16 v16,t17 v17,t18 v18,t19 v19,t20 v20,t21 v21,t22 v22,t23 v23,t24 v24) override {          \
       if (ignoreMethodCall()) return;                                                                                                                                                                               \
+      if (callDirect()) {getDelegate()->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17,v18,v19,v20,v21,v22,v23,v24); return;}                                                                   \
       ZS_INTERNAL_DECLARE_STUB_PTR(Stub_24_##xMethod)                                                                                                                                                               \
       Stub_24_##xMethod##UniPtr stub(new Stub_24_##xMethod(getDelegate(),v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17,v18,v19,v20,v21,v22,v23,v24));                                                  \
       mQueue->post(std::move(stub));                                                                                                                                                                                \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_METHOD_25(xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21,t22,t23,t24,t25)                                                                             \
+#define ZS_INTERNAL_DECLARE_PROXY_METHOD_25(xPriority,xCoalesce,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21,t22,t23,t24,t25)                                                         \
     class Stub_25_##xMethod : public IMessageQueueMessage                                                                                                                                                                   \
     {                                                                                                                                                                                                                       \
     private:                                                                                                                                                                                                                \
@@ -2473,6 +2633,8 @@ namespace zsLib
                                                                                                                                                                                                                             \
       const char *getDelegateName() const noexcept override {return typeid(Delegate).name();}                                                                                                                               \
       const char *getMethodName() const noexcept override {return #xMethod;}                                                                                                                                                \
+      zsLib::MessagePriorities getPriority() const noexcept override {return xPriority;}                                                                                                                                    \
+      xCoalesce(Stub_25_##xMethod)                                                                                                                                                                                          \
       void processMessage() noexcept override {                                                                                                                                                                             \
         mDelegate->xMethod(m1,m2,m3,m4,m5,m6,m7,m8,m9,m10,m11,m12,m13,m14,m15,m16,m17,m18,m19,m20,m21,m22,m23,m24,m25);                                                                                                     \
       }                                                                                                                                                                                                                     \
@@ -2480,6 +2642,7 @@ namespace zsLib
                                                                                                                                                                                                                             \
     void xMethod(t1 v1,t2 v2,t3 v3,t4 v4,t5 v5,t6 v6,t7 v7,t8 v8,t9 v9,t10 v10,t11 v11,t12 v12,t13 v13,t14 v14,t15 v15,t16 v16,t17 v17,t18 v18,t19 v19,t20 v20,t21 v21,t22 v22,t23 v23,t24 v24,t25 v25) override {          \
       if (ignoreMethodCall()) return;                                                                                                                                                                                       \
+      if (callDirect()) {getDelegate()->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17,v18,v19,v20,v21,v22,v23,v24,v25); return;}                                                                       \
       ZS_INTERNAL_DECLARE_STUB_PTR(Stub_25_##xMethod)                                                                                                                                                                       \
       Stub_25_##xMethod##UniPtr stub(new Stub_25_##xMethod(getDelegate(),v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17,v18,v19,v20,v21,v22,v23,v24,v25));                                                      \
       mQueue->post(std::move(stub));                                                                                                                                                                                        \
@@ -36,8 +36,17 @@
 
 #include <zsLib/types.h>
 #include <zsLib/helpers.h>
+#include <zsLib/internal/zsLib_ProxyPack.h>
 
+#include <atomic>
 #include <map>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#define ZS_INTERNAL_PROXY_SUBSCRIPTIONS_QUEUED    true      // grouped into one message per subscriber queue
+#define ZS_INTERNAL_PROXY_SUBSCRIPTIONS_DIRECT    false     // each subscriber's proxy is called in turn (e.g. synchronous methods)
 
 namespace zsLib
 {
@@ -45,6 +54,45 @@ namespace zsLib
 
   namespace internal
   {
+    //-------------------------------------------------------------------------
+    //-------------------------------------------------------------------------
+    //-------------------------------------------------------------------------
+    //-------------------------------------------------------------------------
+    //
+    // ProxySubscriptionsArguments
+    //
+
+    // the arguments of one event packed once and shared (read only) by every
+    // queue the event is delivered to
+    template <typename... TYPES>
+    class ProxySubscriptionsArguments
+    {
+    public:
+      ProxySubscriptionsArguments(TYPES... values) noexcept {pack(std::index_sequence_for<TYPES...>(), values...);}
+      ~ProxySubscriptionsArguments() noexcept {clean(std::index_sequence_for<TYPES...>());}
+
+      ProxySubscriptionsArguments(const ProxySubscriptionsArguments &) = delete;
+      ProxySubscriptionsArguments &operator=(const ProxySubscriptionsArguments &) = delete;
+
+    private:
+      template <size_t... INDEXES>
+      void pack(std::index_sequence<INDEXES...>, TYPES &...values) noexcept
+      {
+        int expand[] = {0, (ProxyPack<TYPES>(std::get<INDEXES>(mValues), values), 0)...};
+        (void)expand;
+      }
+
+      template <size_t... INDEXES>
+      void clean(std::index_sequence<INDEXES...>) noexcept
+      {
+        int expand[] = {0, (ProxyClean<TYPES>(std::get<INDEXES>(mValues)), 0)...};
+        (void)expand;
+      }
+
+    public:
+      std::tuple<TYPES...> mValues;
+    };
+
     //-------------------------------------------------------------------------
     //-------------------------------------------------------------------------
     //-------------------------------------------------------------------------
@@ -198,39 +246,196 @@ namespace zsLib
       public:
         typedef typename ProxySubscriptions::SubscriptionDelegateMap SubscriptionDelegateMap;
 
-        DelegateImpl() noexcept : mSubscriptions(make_shared<SubscriptionDelegateMap>()) {}
+        typedef std::vector<size_t> IndexList;
+
+        struct Subscriber
+        {
+          Subscription *mKey {};
+          SubscriptionWeakPtr mSubscription;
+          DelegatePtr mDelegate;
+          IMessageQueuePtr mQueue;                // empty when the delegate is called directly
+        };
+
+        typedef std::vector<Subscriber> SubscriberList;
+
+        struct SubscriberQueue
+        {
+          IMessageQueuePtr mQueue;
+          IndexList mSubscribers;                 // into Subscribers::mSubscribers, in subscription order
+        };
+
+        typedef std::vector<SubscriberQueue> SubscriberQueueList;
+
+        // rebuilt whenever a subscription is added or removed and never
+        // modified once published (events read it without taking mLock)
+        struct Subscribers
+        {
+          SubscriptionDelegateMap mMap;
+          SubscriberList mSubscribers;            // in subscription order
+          SubscriberQueueList mQueues;            // asynchronous events are posted once per queue
+        };
+
+        ZS_DECLARE_PTR(Subscribers)
+
+        //---------------------------------------------------------------------
+        // delivers one asynchronous event to every subscriber sharing a queue
+        template <typename INVOKE>
+        class QueuedEvent : public IMessageQueueMessage
+        {
+        public:
+          QueuedEvent(
+                      const SubscribersPtr &subscribers,
+                      size_t queueIndex,
+                      const char *methodName,
+                      bool passesSubscription,
+                      const INVOKE &invoke
+                      ) noexcept :
+            mSubscribers(subscribers),
+            mQueueIndex(queueIndex),
+            mMethodName(methodName),
+            mPassesSubscription(passesSubscription),
+            mInvoke(invoke)
+          {
+          }
+
+          const char *getDelegateName() const noexcept override {return typeid(XINTERFACE).name();}
+          const char *getMethodName() const noexcept override {return mMethodName;}
+
+          void processMessage() noexcept override
+          {
+            const SubscriberQueue &queue = mSubscribers->mQueues[mQueueIndex];
+            for (auto iter = queue.mSubscribers.begin(); iter != queue.mSubscribers.end(); ++iter) {
+              const Subscriber &subscriber = mSubscribers->mSubscribers[*iter];
+
+              SubscriptionPtr subscription = subscriber.mSubscription.lock();
+              if ((mPassesSubscription) && (!subscription)) continue;
+
+              try {
+                DelegatePtr delegate = DelegateProxy::original(subscriber.mDelegate, true);
+                if (!delegate) continue;
+                mInvoke(*delegate, subscription);
+              } catch (typename DelegateProxy::Exceptions::DelegateGone &) {
+                if (subscription) subscription->cancel();
+              }
+            }
+          }
+
+        private:
+          SubscribersPtr mSubscribers;
+          size_t mQueueIndex;
+          const char *mMethodName;
+          bool mPassesSubscription;
+          INVOKE mInvoke;
+        };
+
+        DelegateImpl() noexcept :
+          mSubscribers(make_shared<Subscribers>())
+        {
+        }
         ~DelegateImpl() noexcept {}
 
         template<typename PARAM>
-        static void fillWithSubscription(PARAM &, SubscriptionWeakPtr &, SubscriptionPtr &, ZS_MAYBE_USED() bool &filled) noexcept
+        static void fillWithSubscription(PARAM &, const SubscriptionWeakPtr &, SubscriptionPtr &, ZS_MAYBE_USED() bool &filled) noexcept
         {
           ZS_MAYBE_USED(filled);
         }
 
         template<typename PARAM>
-        static void fillWithSubscription(SubscriptionBaseClassPtr &result, SubscriptionWeakPtr &source, SubscriptionPtr &output, bool &filled) noexcept
+        static void fillWithSubscription(SubscriptionBaseClassPtr &result, const SubscriptionWeakPtr &source, SubscriptionPtr &output, bool &filled) noexcept
         {
           output = source.lock();
           result = output;
           filled = true;
         }
 
+        // the shared argument, unless it is the subscription (which differs per subscriber)
+        template<typename PARAM>
+        static PARAM subscriberArgument(const PARAM &value, const SubscriptionPtr &subscription) noexcept
+        {
+          return subscriberArgument(value, subscription, std::is_same<PARAM, SubscriptionBaseClassPtr>());
+        }
+
+        template<typename PARAM>
+        static PARAM subscriberArgument(const PARAM &value, ZS_MAYBE_USED() const SubscriptionPtr &subscription, std::false_type) noexcept
+        {
+          ZS_MAYBE_USED(subscription);
+          return value;
+        }
+
+        template<typename PARAM>
+        static PARAM subscriberArgument(ZS_MAYBE_USED() const PARAM &value, const SubscriptionPtr &subscription, std::true_type) noexcept
+        {
+          ZS_MAYBE_USED(value);
+          return subscription;
+        }
+
+        template<typename... PARAMS>
+        static bool passesSubscription() noexcept
+        {
+          bool passes[] = {false, std::is_same<PARAMS, SubscriptionBaseClassPtr>::value...};
+          for (size_t index = 0; index < sizeof(passes) / sizeof(passes[0]); ++index) {
+            if (passes[index]) return true;
+          }
+          return false;
+        }
+
+        template <typename INVOKE>
+        static void postToQueues(
+                                 const SubscribersPtr &subscribers,
+                                 const char *methodName,
+                                 bool passesSubscription,
+                                 const INVOKE &invoke
+                                 ) noexcept(false)
+        {
+          for (size_t index = 0; index < subscribers->mQueues.size(); ++index) {
+            subscribers->mQueues[index].mQueue->post(IMessageQueueMessageUniPtr(new QueuedEvent<INVOKE>(subscribers, index, methodName, passesSubscription, invoke)));
+          }
+        }
+
+        //---------------------------------------------------------------------
+        // does not take mLock; a replaced snapshot is released as soon as the
+        // last event still holding it is done
+        SubscribersPtr getSubscribers() const noexcept
+        {
+          return std::atomic_load(&mSubscribers);
+        }
+
+        SubscriptionDelegateMapPtr getSubscriptions() const noexcept
+        {
+          SubscribersPtr subscribers = getSubscribers();
+          return SubscriptionDelegateMapPtr(subscribers, &(subscribers->mMap));
+        }
+
         void subscribe(SubscriptionPtr &subscription, DelegatePtr &delegate) noexcept
         {
+          // events for a proxied delegate are grouped by the proxy's queue
+          IMessageQueuePtr queue = DelegateProxy::getAssociatedMessageQueue(delegate);
+          if (DelegateProxy::original(delegate) == delegate) queue.reset();
+
           AutoRecursiveLock lock(mLock);
-          SubscriptionDelegateMapPtr temp(new SubscriptionDelegateMap(*mSubscriptions));
-          (*temp)[subscription.get()] = SubscriptionDelegatePair(subscription, delegate);
-          mSubscriptions = temp;
+          Subscriber subscriber;
+          subscriber.mKey = subscription.get();
+          subscriber.mSubscription = subscription;
+          subscriber.mDelegate = delegate;
+          subscriber.mQueue = queue;
+
+          SubscriberList subscribers(mSubscribers->mSubscribers);
+          subscribers.push_back(subscriber);
+          publish(createSubscribers(subscribers));
         }
 
         void cancel(Subscription *gone) noexcept
         {
           AutoRecursiveLock lock(mLock);
-          SubscriptionDelegateMapPtr temp(make_shared<SubscriptionDelegateMap>(*mSubscriptions));
-          typename SubscriptionDelegateMap::iterator found = temp->find(gone);
-          if (found == temp->end()) return;
-          temp->erase(found);
-          mSubscriptions = temp;
+          if (mSubscribers->mMap.find(gone) == mSubscribers->mMap.end()) return;
+
+          SubscriberList subscribers;
+          subscribers.reserve(mSubscribers->mSubscribers.size());
+          for (auto iter = mSubscribers->mSubscribers.begin(); iter != mSubscribers->mSubscribers.end(); ++iter) {
+            if ((*iter).mKey == gone) continue;
+            subscribers.push_back(*iter);
+          }
+          publish(createSubscribers(subscribers));
         }
 
         void background(SubscriptionPtr subscription) noexcept
@@ -243,30 +448,64 @@ namespace zsLib
         {
           ZS_MAYBE_USED(ignore);
           AutoRecursiveLock lock(mLock);
-          SubscriptionDelegateMapPtr temp(make_shared<SubscriptionDelegateMap>());
-          mSubscriptions = temp;
+          publish(make_shared<Subscribers>());
           mBackgroundSubscriptions.clear();
         }
 
         size_type size(ZS_MAYBE_USED() Subscription *ignore) noexcept
         {
           ZS_MAYBE_USED(ignore);
-          AutoRecursiveLock lock(mLock);
-          return mSubscriptions->size();
+          return getSubscribers()->mSubscribers.size();
         }
 
         DelegatePtr find(Subscription *subscription) noexcept
         {
-          AutoRecursiveLock lock(mLock);
-          typename SubscriptionDelegateMap::iterator found = mSubscriptions->find(subscription);
-          if (found == mSubscriptions->end()) return DelegatePtr();
+          SubscribersPtr subscribers = getSubscribers();
+          typename SubscriptionDelegateMap::iterator found = subscribers->mMap.find(subscription);
+          if (found == subscribers->mMap.end()) return DelegatePtr();
 
           return (*found).second.second;
         }
 
+      protected:
+        //---------------------------------------------------------------------
+        // must be called with mLock held
+        void publish(const SubscribersPtr &replacement) noexcept
+        {
+          std::atomic_store(&mSubscribers, replacement);
+        }
+
+        //---------------------------------------------------------------------
+        static SubscribersPtr createSubscribers(SubscriberList &subscribers) noexcept
+        {
+          SubscribersPtr result(make_shared<Subscribers>());
+          result->mSubscribers.swap(subscribers);
+
+          typedef std::map<IMessageQueue *, size_t> QueueIndexMap;
+          QueueIndexMap queues;
+
+          for (size_t index = 0; index < result->mSubscribers.size(); ++index) {
+            const Subscriber &subscriber = result->mSubscribers[index];
+            result->mMap[subscriber.mKey] = SubscriptionDelegatePair(subscriber.mSubscription, subscriber.mDelegate);
+
+            const IMessageQueuePtr &queue = subscriber.mQueue;
+            if (!queue) continue;
+
+            auto found = queues.find(queue.get());
+            if (found == queues.end()) {
+              found = queues.insert(QueueIndexMap::value_type(queue.get(), result->mQueues.size())).first;
+              SubscriberQueue added;
+              added.mQueue = queue;
+              result->mQueues.push_back(added);
+            }
+            result->mQueues[(*found).second].mSubscribers.push_back(index);
+          }
+          return result;
+        }
+
       public:
-        zsLib::RecursiveLock mLock;
-        SubscriptionDelegateMapPtr mSubscriptions;
+        mutable zsLib::RecursiveLock mLock;
+        SubscribersPtr mSubscribers;                            // changed only with mLock held (and atomically)
 
         SubscriptionBackgroundMap mBackgroundSubscriptions;
       };
@@ -331,82 +570,82 @@ namespace zsLib
 #define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_TYPEDEF(xOriginalType, xTypeAlias)                                                \
     typedef xOriginalType xTypeAlias;
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_0(xConst,xThrow,xMethod)                                                                            \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_0(xQueued,xConst,xThrow,xMethod)                                                                    \
     void xMethod() xConst xThrow override;                                                                                                                 \
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_1(xConst,xThrow,xMethod,t1)                                                                         \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_1(xQueued,xConst,xThrow,xMethod,t1)                                                                 \
     void xMethod(t1 v1) xConst xThrow override;                                                                                                            \
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_2(xConst,xThrow,xMethod,t1,t2)                                                                      \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_2(xQueued,xConst,xThrow,xMethod,t1,t2)                                                              \
     void xMethod(t1 v1, t2 v2) xConst xThrow override;                                                                                                     \
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_3(xConst,xThrow,xMethod,t1,t2,t3)                                                                   \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_3(xQueued,xConst,xThrow,xMethod,t1,t2,t3)                                                           \
     void xMethod(t1 v1, t2 v2, t3 v3) xConst xThrow override;                                                                                              \
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_4(xConst,xThrow,xMethod,t1,t2,t3,t4)                                                                \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_4(xQueued,xConst,xThrow,xMethod,t1,t2,t3,t4)                                                        \
     void xMethod(t1 v1, t2 v2, t3 v3, t4 v4) xConst xThrow override;                                                                                       \
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_5(xConst,xThrow,xMethod,t1,t2,t3,t4,t5)                                                             \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_5(xQueued,xConst,xThrow,xMethod,t1,t2,t3,t4,t5)                                                     \
     void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5) xConst xThrow override;                                                                                \
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_6(xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6)                                                          \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_6(xQueued,xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6)                                                  \
     void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6) xConst xThrow override;                                                                         \
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_7(xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7)                                                       \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_7(xQueued,xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7)                                               \
     void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7) xConst xThrow override;                                                                  \
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_8(xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8)                                                    \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_8(xQueued,xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8)                                            \
     void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7, t8 v8) xConst xThrow override;                                                           \
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_9(xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9)                                                 \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_9(xQueued,xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9)                                         \
     void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7, t8 v8, t9 v9) xConst xThrow override;                                                    \
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_10(xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10)                                            \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_10(xQueued,xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10)                                    \
     void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7, t8 v8, t9 v9, t10 v10) xConst xThrow override;                                           \
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_11(xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11)                                        \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_11(xQueued,xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11)                                \
     void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7, t8 v8, t9 v9, t10 v10, t11 v11) xConst xThrow override;                                  \
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_12(xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12)                                    \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_12(xQueued,xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12)                            \
     void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7, t8 v8, t9 v9, t10 v10, t11 v11, t12 v12) xConst xThrow override;                         \
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_13(xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13)                                \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_13(xQueued,xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13)                        \
     void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7, t8 v8, t9 v9, t10 v10, t11 v11, t12 v12, t13 v13) xConst xThrow override;                \
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_14(xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14)                                            \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_14(xQueued,xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14)                                    \
     void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7, t8 v8, t9 v9, t10 v10, t11 v11, t12 v12, t13 v13, t14 v14) xConst xThrow override;                       \
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_15(xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15)                                        \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_15(xQueued,xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15)                                \
     void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7, t8 v8, t9 v9, t10 v10, t11 v11, t12 v12, t13 v13, t14 v14, t15 v15) xConst xThrow override;              \
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_16(xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16)                                                                                                            \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_16(xQueued,xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16)                                                                                                    \
     void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7, t8 v8, t9 v9, t10 v10, t11 v11, t12 v12, t13 v13, t14 v14, t15 v15, t16 v16) xConst xThrow override;                                                                             \
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_17(xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17)                                                                                                        \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_17(xQueued,xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17)                                                                                                \
     void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7, t8 v8, t9 v9, t10 v10, t11 v11, t12 v12, t13 v13, t14 v14, t15 v15, t16 v16, t17 v17) xConst xThrow override;                                                                    \
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_18(xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18)                                                                                                    \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_18(xQueued,xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18)                                                                                            \
     void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7, t8 v8, t9 v9, t10 v10, t11 v11, t12 v12, t13 v13, t14 v14, t15 v15, t16 v16, t17 v17, t18 v18) xConst xThrow override;                                                           \
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_19(xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19)                                                                                                \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_19(xQueued,xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19)                                                                                        \
     void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7, t8 v8, t9 v9, t10 v10, t11 v11, t12 v12, t13 v13, t14 v14, t15 v15, t16 v16, t17 v17, t18 v18, t19 v19) xConst xThrow override;                                                  \
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_20(xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20)                                                                                            \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_20(xQueued,xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20)                                                                                    \
     void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7, t8 v8, t9 v9, t10 v10, t11 v11, t12 v12, t13 v13, t14 v14, t15 v15, t16 v16, t17 v17, t18 v18, t19 v19, t20 v20) xConst xThrow override;                                         \
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_21(xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21)                                                                                        \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_21(xQueued,xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21)                                                                                \
     void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7, t8 v8, t9 v9, t10 v10, t11 v11, t12 v12, t13 v13, t14 v14, t15 v15, t16 v16, t17 v17, t18 v18, t19 v19, t20 v20, t21 v21) xConst xThrow override;                                \
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_22(xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21,t22)                                                                                    \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_22(xQueued,xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21,t22)                                                                            \
     void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7, t8 v8, t9 v9, t10 v10, t11 v11, t12 v12, t13 v13, t14 v14, t15 v15, t16 v16, t17 v17, t18 v18, t19 v19, t20 v20, t21 v21, t22 v22) xConst xThrow override;                       \
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_23(xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21,t22,t23)                                                                                \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_23(xQueued,xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21,t22,t23)                                                                        \
     void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7, t8 v8, t9 v9, t10 v10, t11 v11, t12 v12, t13 v13, t14 v14, t15 v15, t16 v16, t17 v17, t18 v18, t19 v19, t20 v20, t21 v21, t22 v22, t23 v23) xConst xThrow override;              \
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_24(xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21,t22,t23,t24)                                                                                            \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_24(xQueued,xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21,t22,t23,t24)                                                                                    \
     void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7, t8 v8, t9 v9, t10 v10, t11 v11, t12 v12, t13 v13, t14 v14, t15 v15, t16 v16, t17 v17, t18 v18, t19 v19, t20 v20, t21 v21, t22 v22, t23 v23, t24 v24) xConst xThrow override;                     \
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_25(xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21,t22,t23,t24,t25)                                                                                        \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_25(xQueued,xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21,t22,t23,t24,t25)                                                                                \
     void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7, t8 v8, t9 v9, t10 v10, t11 v11, t12 v12, t13 v13, t14 v14, t15 v15, t16 v16, t17 v17, t18 v18, t19 v19, t20 v20, t21 v21, t22 v22, t23 v23, t24 v24, t25 v25) xConst xThrow override;            \
 
 
@@ -457,11 +696,7 @@ namespace zsLib
   typedef ProxySubscriptionsType::SubscriptionDelegateMap::key_type xSubscriptionsMapKeyTypename;                                                                                                         \
   typedef ProxySubscriptionsType::SubscriptionDelegateMap::value_type xDelegatPtrTypename;                                                                                                                \
   typedef ProxySubscriptionsType::DelegateProxy xDelegateProxyTypename;                                                                                                                                   \
-  SubscriptionDelegateMapPtr _temp_subscriptions;                                                                                                                                                         \
-  {                                                                                                                                                                                                       \
-    AutoRecursiveLock lock(mLock);                                                                                                                                                                        \
-    _temp_subscriptions = mSubscriptions;                                                                                                                                                                 \
-  }                                                                                                                                                                                                       \
+  SubscriptionDelegateMapPtr _temp_subscriptions = getSubscriptions();                                                                                                                                    \
   xSubscriptionsMapTypename &xSubscriptionsMapVariable = (*_temp_subscriptions);
 
 #define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_ITERATOR_VALUES(xIterator, xKeyValueName, xSusbcriptionWeakPtrValueName, xDelegatePtrValueName)  \
@@ -473,844 +708,1297 @@ namespace zsLib
   {DelegateImpl::cancel(xSubscriptionsMapKeyValue);}
 
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_0(xConst,xThrow,xMethod)                                                                     \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_0(xQueued,xConst,xThrow,xMethod)                                                             \
     void xMethod() xConst xThrow override {                                                                                                         \
-      SubscriptionDelegateMapPtr subscription;                                                                                                      \
-      {                                                                                                                                             \
-        AutoRecursiveLock lock(mLock);                                                                                                              \
-        subscription = mSubscriptions;                                                                                                              \
+      SubscribersPtr subscribers = getSubscribers();                                                                                                \
+      if ((xQueued) && (subscribers->mQueues.size() > 0)) {                                                                                         \
+        postToQueues(subscribers, #xMethod, passesSubscription<>(), [](Delegate &delegate, ZS_MAYBE_USED() SubscriptionPtr &subscription) {         \
+          ZS_MAYBE_USED(subscription);                                                                                                              \
+          delegate.xMethod();                                                                                                                       \
+        });                                                                                                                                         \
       }                                                                                                                                             \
-      for (SubscriptionDelegateMap::iterator iter = subscription->begin(); iter != subscription->end(); ) {                                         \
-        SubscriptionDelegateMap::iterator current = iter; ++iter;                                                                                   \
+      for (auto iter = subscribers->mSubscribers.begin(); iter != subscribers->mSubscribers.end(); ++iter) {                                        \
+        const Subscriber &subscriber = (*iter);                                                                                                     \
+        if ((xQueued) && (subscriber.mQueue)) continue;                                                                                             \
         try {                                                                                                                                       \
-          (*current).second.second->xMethod();                                                                                                      \
+          subscriber.mDelegate->xMethod();                                                                                                          \
         } catch(DelegateProxy::Exceptions::DelegateGone &) {                                                                                        \
-          cancel((*current).first);                                                                                                                 \
+          cancel(subscriber.mKey);                                                                                                                  \
         }                                                                                                                                           \
       }                                                                                                                                             \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_1(xConst,xThrow,xMethod,t1)                                                                  \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_1(xQueued,xConst,xThrow,xMethod,t1)                                                          \
     void xMethod(t1 v1) xConst xThrow override {                                                                                                    \
-      SubscriptionDelegateMapPtr subscription;                                                                                                      \
-      {                                                                                                                                             \
-        AutoRecursiveLock lock(mLock);                                                                                                              \
-        subscription = mSubscriptions;                                                                                                              \
+      SubscribersPtr subscribers = getSubscribers();                                                                                                \
+      if ((xQueued) && (subscribers->mQueues.size() > 0)) {                                                                                         \
+        typedef internal::ProxySubscriptionsArguments<t1> Arguments;                                                                                \
+        std::shared_ptr<Arguments> arguments(make_shared<Arguments>(v1));                                                                           \
+        postToQueues(subscribers, #xMethod, passesSubscription<t1>(), [arguments](Delegate &delegate, SubscriptionPtr &subscription) {              \
+          delegate.xMethod(                                                                                                                         \
+            subscriberArgument<t1>(std::get<0>(arguments->mValues), subscription)                                                                   \
+          );                                                                                                                                        \
+        });                                                                                                                                         \
       }                                                                                                                                             \
-      for (SubscriptionDelegateMap::iterator iter = subscription->begin(); iter != subscription->end(); ) {                                         \
-        SubscriptionDelegateMap::iterator current = iter; ++iter;                                                                                   \
+      for (auto iter = subscribers->mSubscribers.begin(); iter != subscribers->mSubscribers.end(); ++iter) {                                        \
+        const Subscriber &subscriber = (*iter);                                                                                                     \
+        if ((xQueued) && (subscriber.mQueue)) continue;                                                                                             \
         try {                                                                                                                                       \
           bool filled = false;                                                                                                                      \
           SubscriptionPtr result;                                                                                                                   \
-          fillWithSubscription<t1>(v1, (*current).second.first, result, filled);                                                                    \
-          if ((filled) && (!result)) {cancel((*current).first); continue;}                                                                          \
-          (*current).second.second->xMethod(v1);                                                                                                    \
+          fillWithSubscription<t1>(v1, subscriber.mSubscription, result, filled);                                                                   \
+          if ((filled) && (!result)) {cancel(subscriber.mKey); continue;}                                                                           \
+          subscriber.mDelegate->xMethod(v1);                                                                                                        \
         } catch(DelegateProxy::Exceptions::DelegateGone &) {                                                                                        \
-          cancel((*current).first);                                                                                                                 \
+          cancel(subscriber.mKey);                                                                                                                  \
         }                                                                                                                                           \
       }                                                                                                                                             \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_2(xConst,xThrow,xMethod,t1,t2)                                                               \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_2(xQueued,xConst,xThrow,xMethod,t1,t2)                                                       \
     void xMethod(t1 v1, t2 v2) xConst xThrow override {                                                                                             \
-      SubscriptionDelegateMapPtr subscription;                                                                                                      \
-      {                                                                                                                                             \
-        AutoRecursiveLock lock(mLock);                                                                                                              \
-        subscription = mSubscriptions;                                                                                                              \
+      SubscribersPtr subscribers = getSubscribers();                                                                                                \
+      if ((xQueued) && (subscribers->mQueues.size() > 0)) {                                                                                         \
+        typedef internal::ProxySubscriptionsArguments<t1,t2> Arguments;                                                                             \
+        std::shared_ptr<Arguments> arguments(make_shared<Arguments>(v1,v2));                                                                        \
+        postToQueues(subscribers, #xMethod, passesSubscription<t1,t2>(), [arguments](Delegate &delegate, SubscriptionPtr &subscription) {           \
+          delegate.xMethod(                                                                                                                         \
+            subscriberArgument<t1>(std::get<0>(arguments->mValues), subscription),                                                                  \
+            subscriberArgument<t2>(std::get<1>(arguments->mValues), subscription)                                                                   \
+          );                                                                                                                                        \
+        });                                                                                                                                         \
       }                                                                                                                                             \
-      for (SubscriptionDelegateMap::iterator iter = subscription->begin(); iter != subscription->end(); ) {                                         \
-        SubscriptionDelegateMap::iterator current = iter; ++iter;                                                                                   \
+      for (auto iter = subscribers->mSubscribers.begin(); iter != subscribers->mSubscribers.end(); ++iter) {                                        \
+        const Subscriber &subscriber = (*iter);                                                                                                     \
+        if ((xQueued) && (subscriber.mQueue)) continue;                                                                                             \
         try {                                                                                                                                       \
           bool filled = false;                                                                                                                      \
           SubscriptionPtr result;                                                                                                                   \
-          fillWithSubscription<t1>(v1, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t2>(v2, (*current).second.first, result, filled);                                                                    \
-          if ((filled) && (!result)) {cancel((*current).first); continue;}                                                                          \
-          (*current).second.second->xMethod(v1,v2);                                                                                                 \
+          fillWithSubscription<t1>(v1, subscriber.mSubscription, result, filled);                                                                   \
+          fillWithSubscription<t2>(v2, subscriber.mSubscription, result, filled);                                                                   \
+          if ((filled) && (!result)) {cancel(subscriber.mKey); continue;}                                                                           \
+          subscriber.mDelegate->xMethod(v1,v2);                                                                                                     \
         } catch(DelegateProxy::Exceptions::DelegateGone &) {                                                                                        \
-          cancel((*current).first);                                                                                                                 \
+          cancel(subscriber.mKey);                                                                                                                  \
         }                                                                                                                                           \
       }                                                                                                                                             \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_3(xConst,xThrow,xMethod,t1,t2,t3)                                                            \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_3(xQueued,xConst,xThrow,xMethod,t1,t2,t3)                                                    \
     void xMethod(t1 v1, t2 v2, t3 v3) xConst xThrow override {                                                                                      \
-      SubscriptionDelegateMapPtr subscription;                                                                                                      \
-      {                                                                                                                                             \
-        AutoRecursiveLock lock(mLock);                                                                                                              \
-        subscription = mSubscriptions;                                                                                                              \
+      SubscribersPtr subscribers = getSubscribers();                                                                                                \
+      if ((xQueued) && (subscribers->mQueues.size() > 0)) {                                                                                         \
+        typedef internal::ProxySubscriptionsArguments<t1,t2,t3> Arguments;                                                                          \
+        std::shared_ptr<Arguments> arguments(make_shared<Arguments>(v1,v2,v3));                                                                     \
+        postToQueues(subscribers, #xMethod, passesSubscription<t1,t2,t3>(), [arguments](Delegate &delegate, SubscriptionPtr &subscription) {        \
+          delegate.xMethod(                                                                                                                         \
+            subscriberArgument<t1>(std::get<0>(arguments->mValues), subscription),                                                                  \
+            subscriberArgument<t2>(std::get<1>(arguments->mValues), subscription),                                                                  \
+            subscriberArgument<t3>(std::get<2>(arguments->mValues), subscription)                                                                   \
+          );                                                                                                                                        \
+        });                                                                                                                                         \
       }                                                                                                                                             \
-      for (SubscriptionDelegateMap::iterator iter = subscription->begin(); iter != subscription->end(); ) {                                         \
-        SubscriptionDelegateMap::iterator current = iter; ++iter;                                                                                   \
+      for (auto iter = subscribers->mSubscribers.begin(); iter != subscribers->mSubscribers.end(); ++iter) {                                        \
+        const Subscriber &subscriber = (*iter);                                                                                                     \
+        if ((xQueued) && (subscriber.mQueue)) continue;                                                                                             \
         try {                                                                                                                                       \
           bool filled = false;                                                                                                                      \
           SubscriptionPtr result;                                                                                                                   \
-          fillWithSubscription<t1>(v1, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t2>(v2, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t3>(v3, (*current).second.first, result, filled);                                                                    \
-          if ((filled) && (!result)) {cancel((*current).first); continue;}                                                                          \
-          (*current).second.second->xMethod(v1,v2,v3);                                                                                              \
+          fillWithSubscription<t1>(v1, subscriber.mSubscription, result, filled);                                                                   \
+          fillWithSubscription<t2>(v2, subscriber.mSubscription, result, filled);                                                                   \
+          fillWithSubscription<t3>(v3, subscriber.mSubscription, result, filled);                                                                   \
+          if ((filled) && (!result)) {cancel(subscriber.mKey); continue;}                                                                           \
+          subscriber.mDelegate->xMethod(v1,v2,v3);                                                                                                  \
         } catch(DelegateProxy::Exceptions::DelegateGone &) {                                                                                        \
-          cancel((*current).first);                                                                                                                 \
+          cancel(subscriber.mKey);                                                                                                                  \
         }                                                                                                                                           \
       }                                                                                                                                             \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_4(xConst,xThrow,xMethod,t1,t2,t3,t4)                                                         \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_4(xQueued,xConst,xThrow,xMethod,t1,t2,t3,t4)                                                 \
     void xMethod(t1 v1, t2 v2, t3 v3, t4 v4) xConst xThrow override {                                                                               \
-      SubscriptionDelegateMapPtr subscription;                                                                                                      \
-      {                                                                                                                                             \
-        AutoRecursiveLock lock(mLock);                                                                                                              \
-        subscription = mSubscriptions;                                                                                                              \
+      SubscribersPtr subscribers = getSubscribers();                                                                                                \
+      if ((xQueued) && (subscribers->mQueues.size() > 0)) {                                                                                         \
+        typedef internal::ProxySubscriptionsArguments<t1,t2,t3,t4> Arguments;                                                                       \
+        std::shared_ptr<Arguments> arguments(make_shared<Arguments>(v1,v2,v3,v4));                                                                  \
+        postToQueues(subscribers, #xMethod, passesSubscription<t1,t2,t3,t4>(), [arguments](Delegate &delegate, SubscriptionPtr &subscription) {     \
+          delegate.xMethod(                                                                                                                         \
+            subscriberArgument<t1>(std::get<0>(arguments->mValues), subscription),                                                                  \
+            subscriberArgument<t2>(std::get<1>(arguments->mValues), subscription),                                                                  \
+            subscriberArgument<t3>(std::get<2>(arguments->mValues), subscription),                                                                  \
+            subscriberArgument<t4>(std::get<3>(arguments->mValues), subscription)                                                                   \
+          );                                                                                                                                        \
+        });                                                                                                                                         \
       }                                                                                                                                             \
-      for (SubscriptionDelegateMap::iterator iter = subscription->begin(); iter != subscription->end(); ) {                                         \
-        SubscriptionDelegateMap::iterator current = iter; ++iter;                                                                                   \
+      for (auto iter = subscribers->mSubscribers.begin(); iter != subscribers->mSubscribers.end(); ++iter) {                                        \
+        const Subscriber &subscriber = (*iter);                                                                                                     \
+        if ((xQueued) && (subscriber.mQueue)) continue;                                                                                             \
         try {                                                                                                                                       \
           bool filled = false;                                                                                                                      \
           SubscriptionPtr result;                                                                                                                   \
-          fillWithSubscription<t1>(v1, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t2>(v2, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t3>(v3, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t4>(v4, (*current).second.first, result, filled);                                                                    \
-          if ((filled) && (!result)) {cancel((*current).first); continue;}                                                                          \
-          (*current).second.second->xMethod(v1,v2,v3,v4);                                                                                           \
+          fillWithSubscription<t1>(v1, subscriber.mSubscription, result, filled);                                                                   \
+          fillWithSubscription<t2>(v2, subscriber.mSubscription, result, filled);                                                                   \
+          fillWithSubscription<t3>(v3, subscriber.mSubscription, result, filled);                                                                   \
+          fillWithSubscription<t4>(v4, subscriber.mSubscription, result, filled);                                                                   \
+          if ((filled) && (!result)) {cancel(subscriber.mKey); continue;}                                                                           \
+          subscriber.mDelegate->xMethod(v1,v2,v3,v4);                                                                                               \
         } catch(DelegateProxy::Exceptions::DelegateGone &) {                                                                                        \
-          cancel((*current).first);                                                                                                                 \
+          cancel(subscriber.mKey);                                                                                                                  \
         }                                                                                                                                           \
       }                                                                                                                                             \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_5(xConst,xThrow,xMethod,t1,t2,t3,t4,t5)                                                      \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_5(xQueued,xConst,xThrow,xMethod,t1,t2,t3,t4,t5)                                              \
     void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5) xConst xThrow override {                                                                        \
-      SubscriptionDelegateMapPtr subscription;                                                                                                      \
-      {                                                                                                                                             \
-        AutoRecursiveLock lock(mLock);                                                                                                              \
-        subscription = mSubscriptions;                                                                                                              \
+      SubscribersPtr subscribers = getSubscribers();                                                                                                \
+      if ((xQueued) && (subscribers->mQueues.size() > 0)) {                                                                                         \
+        typedef internal::ProxySubscriptionsArguments<t1,t2,t3,t4,t5> Arguments;                                                                    \
+        std::shared_ptr<Arguments> arguments(make_shared<Arguments>(v1,v2,v3,v4,v5));                                                               \
+        postToQueues(subscribers, #xMethod, passesSubscription<t1,t2,t3,t4,t5>(), [arguments](Delegate &delegate, SubscriptionPtr &subscription) {  \
+          delegate.xMethod(                                                                                                                         \
+            subscriberArgument<t1>(std::get<0>(arguments->mValues), subscription),                                                                  \
+            subscriberArgument<t2>(std::get<1>(arguments->mValues), subscription),                                                                  \
+            subscriberArgument<t3>(std::get<2>(arguments->mValues), subscription),                                                                  \
+            subscriberArgument<t4>(std::get<3>(arguments->mValues), subscription),                                                                  \
+            subscriberArgument<t5>(std::get<4>(arguments->mValues), subscription)                                                                   \
+          );                                                                                                                                        \
+        });                                                                                                                                         \
       }                                                                                                                                             \
-      for (SubscriptionDelegateMap::iterator iter = subscription->begin(); iter != subscription->end(); ) {                                         \
-        SubscriptionDelegateMap::iterator current = iter; ++iter;                                                                                   \
+      for (auto iter = subscribers->mSubscribers.begin(); iter != subscribers->mSubscribers.end(); ++iter) {                                        \
+        const Subscriber &subscriber = (*iter);                                                                                                     \
+        if ((xQueued) && (subscriber.mQueue)) continue;                                                                                             \
         try {                                                                                                                                       \
           bool filled = false;                                                                                                                      \
           SubscriptionPtr result;                                                                                                                   \
-          fillWithSubscription<t1>(v1, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t2>(v2, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t3>(v3, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t4>(v4, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t5>(v5, (*current).second.first, result, filled);                                                                    \
-          if ((filled) && (!result)) {cancel((*current).first); continue;}                                                                          \
-          (*current).second.second->xMethod(v1,v2,v3,v4,v5);                                                                                        \
+          fillWithSubscription<t1>(v1, subscriber.mSubscription, result, filled);                                                                   \
+          fillWithSubscription<t2>(v2, subscriber.mSubscription, result, filled);                                                                   \
+          fillWithSubscription<t3>(v3, subscriber.mSubscription, result, filled);                                                                   \
+          fillWithSubscription<t4>(v4, subscriber.mSubscription, result, filled);                                                                   \
+          fillWithSubscription<t5>(v5, subscriber.mSubscription, result, filled);                                                                   \
+          if ((filled) && (!result)) {cancel(subscriber.mKey); continue;}                                                                           \
+          subscriber.mDelegate->xMethod(v1,v2,v3,v4,v5);                                                                                            \
         } catch(DelegateProxy::Exceptions::DelegateGone &) {                                                                                        \
-          cancel((*current).first);                                                                                                                 \
+          cancel(subscriber.mKey);                                                                                                                  \
         }                                                                                                                                           \
       }                                                                                                                                             \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_6(xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6)                                                   \
-    void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6) xConst xThrow override {                                                                 \
-      SubscriptionDelegateMapPtr subscription;                                                                                                      \
-      {                                                                                                                                             \
-        AutoRecursiveLock lock(mLock);                                                                                                              \
-        subscription = mSubscriptions;                                                                                                              \
-      }                                                                                                                                             \
-      for (SubscriptionDelegateMap::iterator iter = subscription->begin(); iter != subscription->end(); ) {                                         \
-        SubscriptionDelegateMap::iterator current = iter; ++iter;                                                                                   \
-        try {                                                                                                                                       \
-          bool filled = false;                                                                                                                      \
-          SubscriptionPtr result;                                                                                                                   \
-          fillWithSubscription<t1>(v1, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t2>(v2, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t3>(v3, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t4>(v4, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t5>(v5, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t6>(v6, (*current).second.first, result, filled);                                                                    \
-          if ((filled) && (!result)) {cancel((*current).first); continue;}                                                                          \
-          (*current).second.second->xMethod(v1,v2,v3,v4,v5,v6);                                                                                     \
-        } catch(DelegateProxy::Exceptions::DelegateGone &) {                                                                                        \
-          cancel((*current).first);                                                                                                                 \
-        }                                                                                                                                           \
-      }                                                                                                                                             \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_6(xQueued,xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6)                                             \
+    void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6) xConst xThrow override {                                                                   \
+      SubscribersPtr subscribers = getSubscribers();                                                                                                  \
+      if ((xQueued) && (subscribers->mQueues.size() > 0)) {                                                                                           \
+        typedef internal::ProxySubscriptionsArguments<t1,t2,t3,t4,t5,t6> Arguments;                                                                   \
+        std::shared_ptr<Arguments> arguments(make_shared<Arguments>(v1,v2,v3,v4,v5,v6));                                                              \
+        postToQueues(subscribers, #xMethod, passesSubscription<t1,t2,t3,t4,t5,t6>(), [arguments](Delegate &delegate, SubscriptionPtr &subscription) { \
+          delegate.xMethod(                                                                                                                           \
+            subscriberArgument<t1>(std::get<0>(arguments->mValues), subscription),                                                                    \
+            subscriberArgument<t2>(std::get<1>(arguments->mValues), subscription),                                                                    \
+            subscriberArgument<t3>(std::get<2>(arguments->mValues), subscription),                                                                    \
+            subscriberArgument<t4>(std::get<3>(arguments->mValues), subscription),                                                                    \
+            subscriberArgument<t5>(std::get<4>(arguments->mValues), subscription),                                                                    \
+            subscriberArgument<t6>(std::get<5>(arguments->mValues), subscription)                                                                     \
+          );                                                                                                                                          \
+        });                                                                                                                                           \
+      }                                                                                                                                               \
+      for (auto iter = subscribers->mSubscribers.begin(); iter != subscribers->mSubscribers.end(); ++iter) {                                          \
+        const Subscriber &subscriber = (*iter);                                                                                                       \
+        if ((xQueued) && (subscriber.mQueue)) continue;                                                                                               \
+        try {                                                                                                                                         \
+          bool filled = false;                                                                                                                        \
+          SubscriptionPtr result;                                                                                                                     \
+          fillWithSubscription<t1>(v1, subscriber.mSubscription, result, filled);                                                                     \
+          fillWithSubscription<t2>(v2, subscriber.mSubscription, result, filled);                                                                     \
+          fillWithSubscription<t3>(v3, subscriber.mSubscription, result, filled);                                                                     \
+          fillWithSubscription<t4>(v4, subscriber.mSubscription, result, filled);                                                                     \
+          fillWithSubscription<t5>(v5, subscriber.mSubscription, result, filled);                                                                     \
+          fillWithSubscription<t6>(v6, subscriber.mSubscription, result, filled);                                                                     \
+          if ((filled) && (!result)) {cancel(subscriber.mKey); continue;}                                                                             \
+          subscriber.mDelegate->xMethod(v1,v2,v3,v4,v5,v6);                                                                                           \
+        } catch(DelegateProxy::Exceptions::DelegateGone &) {                                                                                          \
+          cancel(subscriber.mKey);                                                                                                                    \
+        }                                                                                                                                             \
+      }                                                                                                                                               \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_7(xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7)                                                \
-    void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7) xConst xThrow override {                                                          \
-      SubscriptionDelegateMapPtr subscription;                                                                                                      \
-      {                                                                                                                                             \
-        AutoRecursiveLock lock(mLock);                                                                                                              \
-        subscription = mSubscriptions;                                                                                                              \
-      }                                                                                                                                             \
-      for (SubscriptionDelegateMap::iterator iter = subscription->begin(); iter != subscription->end(); ) {                                         \
-        SubscriptionDelegateMap::iterator current = iter; ++iter;                                                                                   \
-        try {                                                                                                                                       \
-          bool filled = false;                                                                                                                      \
-          SubscriptionPtr result;                                                                                                                   \
-          fillWithSubscription<t1>(v1, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t2>(v2, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t3>(v3, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t4>(v4, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t5>(v5, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t6>(v6, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t7>(v7, (*current).second.first, result, filled);                                                                    \
-          if ((filled) && (!result)) {cancel((*current).first); continue;}                                                                          \
-          (*current).second.second->xMethod(v1,v2,v3,v4,v5,v6,v7);                                                                                  \
-        } catch(DelegateProxy::Exceptions::DelegateGone &) {                                                                                        \
-          cancel((*current).first);                                                                                                                 \
-        }                                                                                                                                           \
-      }                                                                                                                                             \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_7(xQueued,xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7)                                             \
+    void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7) xConst xThrow override {                                                               \
+      SubscribersPtr subscribers = getSubscribers();                                                                                                     \
+      if ((xQueued) && (subscribers->mQueues.size() > 0)) {                                                                                              \
+        typedef internal::ProxySubscriptionsArguments<t1,t2,t3,t4,t5,t6,t7> Arguments;                                                                   \
+        std::shared_ptr<Arguments> arguments(make_shared<Arguments>(v1,v2,v3,v4,v5,v6,v7));                                                              \
+        postToQueues(subscribers, #xMethod, passesSubscription<t1,t2,t3,t4,t5,t6,t7>(), [arguments](Delegate &delegate, SubscriptionPtr &subscription) { \
+          delegate.xMethod(                                                                                                                              \
+            subscriberArgument<t1>(std::get<0>(arguments->mValues), subscription),                                                                       \
+            subscriberArgument<t2>(std::get<1>(arguments->mValues), subscription),                                                                       \
+            subscriberArgument<t3>(std::get<2>(arguments->mValues), subscription),                                                                       \
+            subscriberArgument<t4>(std::get<3>(arguments->mValues), subscription),                                                                       \
+            subscriberArgument<t5>(std::get<4>(arguments->mValues), subscription),                                                                       \
+            subscriberArgument<t6>(std::get<5>(arguments->mValues), subscription),                                                                       \
+            subscriberArgument<t7>(std::get<6>(arguments->mValues), subscription)                                                                        \
+          );                                                                                                                                             \
+        });                                                                                                                                              \
+      }                                                                                                                                                  \
+      for (auto iter = subscribers->mSubscribers.begin(); iter != subscribers->mSubscribers.end(); ++iter) {                                             \
+        const Subscriber &subscriber = (*iter);                                                                                                          \
+        if ((xQueued) && (subscriber.mQueue)) continue;                                                                                                  \
+        try {                                                                                                                                            \
+          bool filled = false;                                                                                                                           \
+          SubscriptionPtr result;                                                                                                                        \
+          fillWithSubscription<t1>(v1, subscriber.mSubscription, result, filled);                                                                        \
+          fillWithSubscription<t2>(v2, subscriber.mSubscription, result, filled);                                                                        \
+          fillWithSubscription<t3>(v3, subscriber.mSubscription, result, filled);                                                                        \
+          fillWithSubscription<t4>(v4, subscriber.mSubscription, result, filled);                                                                        \
+          fillWithSubscription<t5>(v5, subscriber.mSubscription, result, filled);                                                                        \
+          fillWithSubscription<t6>(v6, subscriber.mSubscription, result, filled);                                                                        \
+          fillWithSubscription<t7>(v7, subscriber.mSubscription, result, filled);                                                                        \
+          if ((filled) && (!result)) {cancel(subscriber.mKey); continue;}                                                                                \
+          subscriber.mDelegate->xMethod(v1,v2,v3,v4,v5,v6,v7);                                                                                           \
+        } catch(DelegateProxy::Exceptions::DelegateGone &) {                                                                                             \
+          cancel(subscriber.mKey);                                                                                                                       \
+        }                                                                                                                                                \
+      }                                                                                                                                                  \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_8(xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8)                                             \
-    void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7, t8 v8) xConst xThrow override {                                                   \
-      SubscriptionDelegateMapPtr subscription;                                                                                                      \
-      {                                                                                                                                             \
-        AutoRecursiveLock lock(mLock);                                                                                                              \
-        subscription = mSubscriptions;                                                                                                              \
-      }                                                                                                                                             \
-      for (SubscriptionDelegateMap::iterator iter = subscription->begin(); iter != subscription->end(); ) {                                         \
-        SubscriptionDelegateMap::iterator current = iter; ++iter;                                                                                   \
-        try {                                                                                                                                       \
-          bool filled = false;                                                                                                                      \
-          SubscriptionPtr result;                                                                                                                   \
-          fillWithSubscription<t1>(v1, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t2>(v2, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t3>(v3, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t4>(v4, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t5>(v5, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t6>(v6, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t7>(v7, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t8>(v8, (*current).second.first, result, filled);                                                                    \
-          if ((filled) && (!result)) {cancel((*current).first); continue;}                                                                          \
-          (*current).second.second->xMethod(v1,v2,v3,v4,v5,v6,v7,v8);                                                                               \
-        } catch(DelegateProxy::Exceptions::DelegateGone &) {                                                                                        \
-          cancel((*current).first);                                                                                                                 \
-        }                                                                                                                                           \
-      }                                                                                                                                             \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_8(xQueued,xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8)                                             \
+    void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7, t8 v8) xConst xThrow override {                                                           \
+      SubscribersPtr subscribers = getSubscribers();                                                                                                        \
+      if ((xQueued) && (subscribers->mQueues.size() > 0)) {                                                                                                 \
+        typedef internal::ProxySubscriptionsArguments<t1,t2,t3,t4,t5,t6,t7,t8> Arguments;                                                                   \
+        std::shared_ptr<Arguments> arguments(make_shared<Arguments>(v1,v2,v3,v4,v5,v6,v7,v8));                                                              \
+        postToQueues(subscribers, #xMethod, passesSubscription<t1,t2,t3,t4,t5,t6,t7,t8>(), [arguments](Delegate &delegate, SubscriptionPtr &subscription) { \
+          delegate.xMethod(                                                                                                                                 \
+            subscriberArgument<t1>(std::get<0>(arguments->mValues), subscription),                                                                          \
+            subscriberArgument<t2>(std::get<1>(arguments->mValues), subscription),                                                                          \
+            subscriberArgument<t3>(std::get<2>(arguments->mValues), subscription),                                                                          \
+            subscriberArgument<t4>(std::get<3>(arguments->mValues), subscription),                                                                          \
+            subscriberArgument<t5>(std::get<4>(arguments->mValues), subscription),                                                                          \
+            subscriberArgument<t6>(std::get<5>(arguments->mValues), subscription),                                                                          \
+            subscriberArgument<t7>(std::get<6>(arguments->mValues), subscription),                                                                          \
+            subscriberArgument<t8>(std::get<7>(arguments->mValues), subscription)                                                                           \
+          );                                                                                                                                                \
+        });                                                                                                                                                 \
+      }                                                                                                                                                     \
+      for (auto iter = subscribers->mSubscribers.begin(); iter != subscribers->mSubscribers.end(); ++iter) {                                                \
+        const Subscriber &subscriber = (*iter);                                                                                                             \
+        if ((xQueued) && (subscriber.mQueue)) continue;                                                                                                     \
+        try {                                                                                                                                               \
+          bool filled = false;                                                                                                                              \
+          SubscriptionPtr result;                                                                                                                           \
+          fillWithSubscription<t1>(v1, subscriber.mSubscription, result, filled);                                                                           \
+          fillWithSubscription<t2>(v2, subscriber.mSubscription, result, filled);                                                                           \
+          fillWithSubscription<t3>(v3, subscriber.mSubscription, result, filled);                                                                           \
+          fillWithSubscription<t4>(v4, subscriber.mSubscription, result, filled);                                                                           \
+          fillWithSubscription<t5>(v5, subscriber.mSubscription, result, filled);                                                                           \
+          fillWithSubscription<t6>(v6, subscriber.mSubscription, result, filled);                                                                           \
+          fillWithSubscription<t7>(v7, subscriber.mSubscription, result, filled);                                                                           \
+          fillWithSubscription<t8>(v8, subscriber.mSubscription, result, filled);                                                                           \
+          if ((filled) && (!result)) {cancel(subscriber.mKey); continue;}                                                                                   \
+          subscriber.mDelegate->xMethod(v1,v2,v3,v4,v5,v6,v7,v8);                                                                                           \
+        } catch(DelegateProxy::Exceptions::DelegateGone &) {                                                                                                \
+          cancel(subscriber.mKey);                                                                                                                          \
+        }                                                                                                                                                   \
+      }                                                                                                                                                     \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_9(xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9)                                          \
-    void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7, t8 v8, t9 v9) xConst xThrow override {                                            \
-      SubscriptionDelegateMapPtr subscription;                                                                                                      \
-      {                                                                                                                                             \
-        AutoRecursiveLock lock(mLock);                                                                                                              \
-        subscription = mSubscriptions;                                                                                                              \
-      }                                                                                                                                             \
-      for (SubscriptionDelegateMap::iterator iter = subscription->begin(); iter != subscription->end(); ) {                                         \
-        SubscriptionDelegateMap::iterator current = iter; ++iter;                                                                                   \
-        try {                                                                                                                                       \
-          bool filled = false;                                                                                                                      \
-          SubscriptionPtr result;                                                                                                                   \
-          fillWithSubscription<t1>(v1, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t2>(v2, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t3>(v3, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t4>(v4, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t5>(v5, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t6>(v6, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t7>(v7, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t8>(v8, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t9>(v9, (*current).second.first, result, filled);                                                                    \
-          if ((filled) && (!result)) {cancel((*current).first); continue;}                                                                          \
-          (*current).second.second->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9);                                                                            \
-        } catch(DelegateProxy::Exceptions::DelegateGone &) {                                                                                        \
-          cancel((*current).first);                                                                                                                 \
-        }                                                                                                                                           \
-      }                                                                                                                                             \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_9(xQueued,xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9)                                             \
+    void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7, t8 v8, t9 v9) xConst xThrow override {                                                       \
+      SubscribersPtr subscribers = getSubscribers();                                                                                                           \
+      if ((xQueued) && (subscribers->mQueues.size() > 0)) {                                                                                                    \
+        typedef internal::ProxySubscriptionsArguments<t1,t2,t3,t4,t5,t6,t7,t8,t9> Arguments;                                                                   \
+        std::shared_ptr<Arguments> arguments(make_shared<Arguments>(v1,v2,v3,v4,v5,v6,v7,v8,v9));                                                              \
+        postToQueues(subscribers, #xMethod, passesSubscription<t1,t2,t3,t4,t5,t6,t7,t8,t9>(), [arguments](Delegate &delegate, SubscriptionPtr &subscription) { \
+          delegate.xMethod(                                                                                                                                    \
+            subscriberArgument<t1>(std::get<0>(arguments->mValues), subscription),                                                                             \
+            subscriberArgument<t2>(std::get<1>(arguments->mValues), subscription),                                                                             \
+            subscriberArgument<t3>(std::get<2>(arguments->mValues), subscription),                                                                             \
+            subscriberArgument<t4>(std::get<3>(arguments->mValues), subscription),                                                                             \
+            subscriberArgument<t5>(std::get<4>(arguments->mValues), subscription),                                                                             \
+            subscriberArgument<t6>(std::get<5>(arguments->mValues), subscription),                                                                             \
+            subscriberArgument<t7>(std::get<6>(arguments->mValues), subscription),                                                                             \
+            subscriberArgument<t8>(std::get<7>(arguments->mValues), subscription),                                                                             \
+            subscriberArgument<t9>(std::get<8>(arguments->mValues), subscription)                                                                              \
+          );                                                                                                                                                   \
+        });                                                                                                                                                    \
+      }                                                                                                                                                        \
+      for (auto iter = subscribers->mSubscribers.begin(); iter != subscribers->mSubscribers.end(); ++iter) {                                                   \
+        const Subscriber &subscriber = (*iter);                                                                                                                \
+        if ((xQueued) && (subscriber.mQueue)) continue;                                                                                                        \
+        try {                                                                                                                                                  \
+          bool filled = false;                                                                                                                                 \
+          SubscriptionPtr result;                                                                                                                              \
+          fillWithSubscription<t1>(v1, subscriber.mSubscription, result, filled);                                                                              \
+          fillWithSubscription<t2>(v2, subscriber.mSubscription, result, filled);                                                                              \
+          fillWithSubscription<t3>(v3, subscriber.mSubscription, result, filled);                                                                              \
+          fillWithSubscription<t4>(v4, subscriber.mSubscription, result, filled);                                                                              \
+          fillWithSubscription<t5>(v5, subscriber.mSubscription, result, filled);                                                                              \
+          fillWithSubscription<t6>(v6, subscriber.mSubscription, result, filled);                                                                              \
+          fillWithSubscription<t7>(v7, subscriber.mSubscription, result, filled);                                                                              \
+          fillWithSubscription<t8>(v8, subscriber.mSubscription, result, filled);                                                                              \
+          fillWithSubscription<t9>(v9, subscriber.mSubscription, result, filled);                                                                              \
+          if ((filled) && (!result)) {cancel(subscriber.mKey); continue;}                                                                                      \
+          subscriber.mDelegate->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9);                                                                                           \
+        } catch(DelegateProxy::Exceptions::DelegateGone &) {                                                                                                   \
+          cancel(subscriber.mKey);                                                                                                                             \
+        }                                                                                                                                                      \
+      }                                                                                                                                                        \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_10(xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10)                                     \
-    void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7, t8 v8, t9 v9, t10 v10) xConst xThrow override {                                   \
-      SubscriptionDelegateMapPtr subscription;                                                                                                      \
-      {                                                                                                                                             \
-        AutoRecursiveLock lock(mLock);                                                                                                              \
-        subscription = mSubscriptions;                                                                                                              \
-      }                                                                                                                                             \
-      for (SubscriptionDelegateMap::iterator iter = subscription->begin(); iter != subscription->end(); ) {                                         \
-        SubscriptionDelegateMap::iterator current = iter; ++iter;                                                                                   \
-        try {                                                                                                                                       \
-          bool filled = false;                                                                                                                      \
-          SubscriptionPtr result;                                                                                                                   \
-          fillWithSubscription<t1>(v1, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t2>(v2, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t3>(v3, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t4>(v4, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t5>(v5, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t6>(v6, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t7>(v7, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t8>(v8, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t9>(v9, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t10>(v10, (*current).second.first, result, filled);                                                                  \
-          if ((filled) && (!result)) {cancel((*current).first); continue;}                                                                          \
-          (*current).second.second->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10);                                                                        \
-        } catch(DelegateProxy::Exceptions::DelegateGone &) {                                                                                        \
-          cancel((*current).first);                                                                                                                 \
-        }                                                                                                                                           \
-      }                                                                                                                                             \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_10(xQueued,xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10)                                            \
+    void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7, t8 v8, t9 v9, t10 v10) xConst xThrow override {                                                  \
+      SubscribersPtr subscribers = getSubscribers();                                                                                                               \
+      if ((xQueued) && (subscribers->mQueues.size() > 0)) {                                                                                                        \
+        typedef internal::ProxySubscriptionsArguments<t1,t2,t3,t4,t5,t6,t7,t8,t9,t10> Arguments;                                                                   \
+        std::shared_ptr<Arguments> arguments(make_shared<Arguments>(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10));                                                              \
+        postToQueues(subscribers, #xMethod, passesSubscription<t1,t2,t3,t4,t5,t6,t7,t8,t9,t10>(), [arguments](Delegate &delegate, SubscriptionPtr &subscription) { \
+          delegate.xMethod(                                                                                                                                        \
+            subscriberArgument<t1>(std::get<0>(arguments->mValues), subscription),                                                                                 \
+            subscriberArgument<t2>(std::get<1>(arguments->mValues), subscription),                                                                                 \
+            subscriberArgument<t3>(std::get<2>(arguments->mValues), subscription),                                                                                 \
+            subscriberArgument<t4>(std::get<3>(arguments->mValues), subscription),                                                                                 \
+            subscriberArgument<t5>(std::get<4>(arguments->mValues), subscription),                                                                                 \
+            subscriberArgument<t6>(std::get<5>(arguments->mValues), subscription),                                                                                 \
+            subscriberArgument<t7>(std::get<6>(arguments->mValues), subscription),                                                                                 \
+            subscriberArgument<t8>(std::get<7>(arguments->mValues), subscription),                                                                                 \
+            subscriberArgument<t9>(std::get<8>(arguments->mValues), subscription),                                                                                 \
+            subscriberArgument<t10>(std::get<9>(arguments->mValues), subscription)                                                                                 \
+          );                                                                                                                                                       \
+        });                                                                                                                                                        \
+      }                                                                                                                                                            \
+      for (auto iter = subscribers->mSubscribers.begin(); iter != subscribers->mSubscribers.end(); ++iter) {                                                       \
+        const Subscriber &subscriber = (*iter);                                                                                                                    \
+        if ((xQueued) && (subscriber.mQueue)) continue;                                                                                                            \
+        try {                                                                                                                                                      \
+          bool filled = false;                                                                                                                                     \
+          SubscriptionPtr result;                                                                                                                                  \
+          fillWithSubscription<t1>(v1, subscriber.mSubscription, result, filled);                                                                                  \
+          fillWithSubscription<t2>(v2, subscriber.mSubscription, result, filled);                                                                                  \
+          fillWithSubscription<t3>(v3, subscriber.mSubscription, result, filled);                                                                                  \
+          fillWithSubscription<t4>(v4, subscriber.mSubscription, result, filled);                                                                                  \
+          fillWithSubscription<t5>(v5, subscriber.mSubscription, result, filled);                                                                                  \
+          fillWithSubscription<t6>(v6, subscriber.mSubscription, result, filled);                                                                                  \
+          fillWithSubscription<t7>(v7, subscriber.mSubscription, result, filled);                                                                                  \
+          fillWithSubscription<t8>(v8, subscriber.mSubscription, result, filled);                                                                                  \
+          fillWithSubscription<t9>(v9, subscriber.mSubscription, result, filled);                                                                                  \
+          fillWithSubscription<t10>(v10, subscriber.mSubscription, result, filled);                                                                                \
+          if ((filled) && (!result)) {cancel(subscriber.mKey); continue;}                                                                                          \
+          subscriber.mDelegate->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10);                                                                                           \
+        } catch(DelegateProxy::Exceptions::DelegateGone &) {                                                                                                       \
+          cancel(subscriber.mKey);                                                                                                                                 \
+        }                                                                                                                                                          \
+      }                                                                                                                                                            \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_11(xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11)                                 \
-    void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7, t8 v8, t9 v9, t10 v10, t11 v11) xConst xThrow override {                          \
-      SubscriptionDelegateMapPtr subscription;                                                                                                      \
-      {                                                                                                                                             \
-        AutoRecursiveLock lock(mLock);                                                                                                              \
-        subscription = mSubscriptions;                                                                                                              \
-      }                                                                                                                                             \
-      for (SubscriptionDelegateMap::iterator iter = subscription->begin(); iter != subscription->end(); ) {                                         \
-        SubscriptionDelegateMap::iterator current = iter; ++iter;                                                                                   \
-        try {                                                                                                                                       \
-          bool filled = false;                                                                                                                      \
-          SubscriptionPtr result;                                                                                                                   \
-          fillWithSubscription<t1>(v1, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t2>(v2, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t3>(v3, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t4>(v4, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t5>(v5, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t6>(v6, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t7>(v7, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t8>(v8, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t9>(v9, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t10>(v10, (*current).second.first, result, filled);                                                                  \
-          fillWithSubscription<t11>(v11, (*current).second.first, result, filled);                                                                  \
-          if ((filled) && (!result)) {cancel((*current).first); continue;}                                                                          \
-          (*current).second.second->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11);                                                                    \
-        } catch(DelegateProxy::Exceptions::DelegateGone &) {                                                                                        \
-          cancel((*current).first);                                                                                                                 \
-        }                                                                                                                                           \
-      }                                                                                                                                             \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_11(xQueued,xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11)                                            \
+    void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7, t8 v8, t9 v9, t10 v10, t11 v11) xConst xThrow override {                                             \
+      SubscribersPtr subscribers = getSubscribers();                                                                                                                   \
+      if ((xQueued) && (subscribers->mQueues.size() > 0)) {                                                                                                            \
+        typedef internal::ProxySubscriptionsArguments<t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11> Arguments;                                                                   \
+        std::shared_ptr<Arguments> arguments(make_shared<Arguments>(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11));                                                              \
+        postToQueues(subscribers, #xMethod, passesSubscription<t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11>(), [arguments](Delegate &delegate, SubscriptionPtr &subscription) { \
+          delegate.xMethod(                                                                                                                                            \
+            subscriberArgument<t1>(std::get<0>(arguments->mValues), subscription),                                                                                     \
+            subscriberArgument<t2>(std::get<1>(arguments->mValues), subscription),                                                                                     \
+            subscriberArgument<t3>(std::get<2>(arguments->mValues), subscription),                                                                                     \
+            subscriberArgument<t4>(std::get<3>(arguments->mValues), subscription),                                                                                     \
+            subscriberArgument<t5>(std::get<4>(arguments->mValues), subscription),                                                                                     \
+            subscriberArgument<t6>(std::get<5>(arguments->mValues), subscription),                                                                                     \
+            subscriberArgument<t7>(std::get<6>(arguments->mValues), subscription),                                                                                     \
+            subscriberArgument<t8>(std::get<7>(arguments->mValues), subscription),                                                                                     \
+            subscriberArgument<t9>(std::get<8>(arguments->mValues), subscription),                                                                                     \
+            subscriberArgument<t10>(std::get<9>(arguments->mValues), subscription),                                                                                    \
+            subscriberArgument<t11>(std::get<10>(arguments->mValues), subscription)                                                                                    \
+          );                                                                                                                                                           \
+        });                                                                                                                                                            \
+      }                                                                                                                                                                \
+      for (auto iter = subscribers->mSubscribers.begin(); iter != subscribers->mSubscribers.end(); ++iter) {                                                           \
+        const Subscriber &subscriber = (*iter);                                                                                                                        \
+        if ((xQueued) && (subscriber.mQueue)) continue;                                                                                                                \
+        try {                                                                                                                                                          \
+          bool filled = false;                                                                                                                                         \
+          SubscriptionPtr result;                                                                                                                                      \
+          fillWithSubscription<t1>(v1, subscriber.mSubscription, result, filled);                                                                                      \
+          fillWithSubscription<t2>(v2, subscriber.mSubscription, result, filled);                                                                                      \
+          fillWithSubscription<t3>(v3, subscriber.mSubscription, result, filled);                                                                                      \
+          fillWithSubscription<t4>(v4, subscriber.mSubscription, result, filled);                                                                                      \
+          fillWithSubscription<t5>(v5, subscriber.mSubscription, result, filled);                                                                                      \
+          fillWithSubscription<t6>(v6, subscriber.mSubscription, result, filled);                                                                                      \
+          fillWithSubscription<t7>(v7, subscriber.mSubscription, result, filled);                                                                                      \
+          fillWithSubscription<t8>(v8, subscriber.mSubscription, result, filled);                                                                                      \
+          fillWithSubscription<t9>(v9, subscriber.mSubscription, result, filled);                                                                                      \
+          fillWithSubscription<t10>(v10, subscriber.mSubscription, result, filled);                                                                                    \
+          fillWithSubscription<t11>(v11, subscriber.mSubscription, result, filled);                                                                                    \
+          if ((filled) && (!result)) {cancel(subscriber.mKey); continue;}                                                                                              \
+          subscriber.mDelegate->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11);                                                                                           \
+        } catch(DelegateProxy::Exceptions::DelegateGone &) {                                                                                                           \
+          cancel(subscriber.mKey);                                                                                                                                     \
+        }                                                                                                                                                              \
+      }                                                                                                                                                                \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_12(xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12)                             \
-    void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7, t8 v8, t9 v9, t10 v10, t11 v11, t12 v12) xConst xThrow override {                 \
-      SubscriptionDelegateMapPtr subscription;                                                                                                      \
-      {                                                                                                                                             \
-        AutoRecursiveLock lock(mLock);                                                                                                              \
-        subscription = mSubscriptions;                                                                                                              \
-      }                                                                                                                                             \
-      for (SubscriptionDelegateMap::iterator iter = subscription->begin(); iter != subscription->end(); ) {                                         \
-        SubscriptionDelegateMap::iterator current = iter; ++iter;                                                                                   \
-        try {                                                                                                                                       \
-          bool filled = false;                                                                                                                      \
-          SubscriptionPtr result;                                                                                                                   \
-          fillWithSubscription<t1>(v1, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t2>(v2, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t3>(v3, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t4>(v4, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t5>(v5, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t6>(v6, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t7>(v7, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t8>(v8, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t9>(v9, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t10>(v10, (*current).second.first, result, filled);                                                                  \
-          fillWithSubscription<t11>(v11, (*current).second.first, result, filled);                                                                  \
-          fillWithSubscription<t12>(v12, (*current).second.first, result, filled);                                                                  \
-          if ((filled) && (!result)) {cancel((*current).first); continue;}                                                                          \
-          (*current).second.second->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12);                                                                \
-        } catch(DelegateProxy::Exceptions::DelegateGone &) {                                                                                        \
-          cancel((*current).first);                                                                                                                 \
-        }                                                                                                                                           \
-      }                                                                                                                                             \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_12(xQueued,xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12)                                            \
+    void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7, t8 v8, t9 v9, t10 v10, t11 v11, t12 v12) xConst xThrow override {                                        \
+      SubscribersPtr subscribers = getSubscribers();                                                                                                                       \
+      if ((xQueued) && (subscribers->mQueues.size() > 0)) {                                                                                                                \
+        typedef internal::ProxySubscriptionsArguments<t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12> Arguments;                                                                   \
+        std::shared_ptr<Arguments> arguments(make_shared<Arguments>(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12));                                                              \
+        postToQueues(subscribers, #xMethod, passesSubscription<t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12>(), [arguments](Delegate &delegate, SubscriptionPtr &subscription) { \
+          delegate.xMethod(                                                                                                                                                \
+            subscriberArgument<t1>(std::get<0>(arguments->mValues), subscription),                                                                                         \
+            subscriberArgument<t2>(std::get<1>(arguments->mValues), subscription),                                                                                         \
+            subscriberArgument<t3>(std::get<2>(arguments->mValues), subscription),                                                                                         \
+            subscriberArgument<t4>(std::get<3>(arguments->mValues), subscription),                                                                                         \
+            subscriberArgument<t5>(std::get<4>(arguments->mValues), subscription),                                                                                         \
+            subscriberArgument<t6>(std::get<5>(arguments->mValues), subscription),                                                                                         \
+            subscriberArgument<t7>(std::get<6>(arguments->mValues), subscription),                                                                                         \
+            subscriberArgument<t8>(std::get<7>(arguments->mValues), subscription),                                                                                         \
+            subscriberArgument<t9>(std::get<8>(arguments->mValues), subscription),                                                                                         \
+            subscriberArgument<t10>(std::get<9>(arguments->mValues), subscription),                                                                                        \
+            subscriberArgument<t11>(std::get<10>(arguments->mValues), subscription),                                                                                       \
+            subscriberArgument<t12>(std::get<11>(arguments->mValues), subscription)                                                                                        \
+          );                                                                                                                                                               \
+        });                                                                                                                                                                \
+      }                                                                                                                                                                    \
+      for (auto iter = subscribers->mSubscribers.begin(); iter != subscribers->mSubscribers.end(); ++iter) {                                                               \
+        const Subscriber &subscriber = (*iter);                                                                                                                            \
+        if ((xQueued) && (subscriber.mQueue)) continue;                                                                                                                    \
+        try {                                                                                                                                                              \
+          bool filled = false;                                                                                                                                             \
+          SubscriptionPtr result;                                                                                                                                          \
+          fillWithSubscription<t1>(v1, subscriber.mSubscription, result, filled);                                                                                          \
+          fillWithSubscription<t2>(v2, subscriber.mSubscription, result, filled);                                                                                          \
+          fillWithSubscription<t3>(v3, subscriber.mSubscription, result, filled);                                                                                          \
+          fillWithSubscription<t4>(v4, subscriber.mSubscription, result, filled);                                                                                          \
+          fillWithSubscription<t5>(v5, subscriber.mSubscription, result, filled);                                                                                          \
+          fillWithSubscription<t6>(v6, subscriber.mSubscription, result, filled);                                                                                          \
+          fillWithSubscription<t7>(v7, subscriber.mSubscription, result, filled);                                                                                          \
+          fillWithSubscription<t8>(v8, subscriber.mSubscription, result, filled);                                                                                          \
+          fillWithSubscription<t9>(v9, subscriber.mSubscription, result, filled);                                                                                          \
+          fillWithSubscription<t10>(v10, subscriber.mSubscription, result, filled);                                                                                        \
+          fillWithSubscription<t11>(v11, subscriber.mSubscription, result, filled);                                                                                        \
+          fillWithSubscription<t12>(v12, subscriber.mSubscription, result, filled);                                                                                        \
+          if ((filled) && (!result)) {cancel(subscriber.mKey); continue;}                                                                                                  \
+          subscriber.mDelegate->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12);                                                                                           \
+        } catch(DelegateProxy::Exceptions::DelegateGone &) {                                                                                                               \
+          cancel(subscriber.mKey);                                                                                                                                         \
+        }                                                                                                                                                                  \
+      }                                                                                                                                                                    \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_13(xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13)                         \
-    void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7, t8 v8, t9 v9, t10 v10, t11 v11, t12 v12, t13 v13) xConst xThrow override {        \
-      SubscriptionDelegateMapPtr subscription;                                                                                                      \
-      {                                                                                                                                             \
-        AutoRecursiveLock lock(mLock);                                                                                                              \
-        subscription = mSubscriptions;                                                                                                              \
-      }                                                                                                                                             \
-      for (SubscriptionDelegateMap::iterator iter = subscription->begin(); iter != subscription->end(); ) {                                         \
-        SubscriptionDelegateMap::iterator current = iter; ++iter;                                                                                   \
-        try {                                                                                                                                       \
-          bool filled = false;                                                                                                                      \
-          SubscriptionPtr result;                                                                                                                   \
-          fillWithSubscription<t1>(v1, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t2>(v2, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t3>(v3, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t4>(v4, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t5>(v5, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t6>(v6, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t7>(v7, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t8>(v8, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t9>(v9, (*current).second.first, result, filled);                                                                    \
-          fillWithSubscription<t10>(v10, (*current).second.first, result, filled);                                                                  \
-          fillWithSubscription<t11>(v11, (*current).second.first, result, filled);                                                                  \
-          fillWithSubscription<t12>(v12, (*current).second.first, result, filled);                                                                  \
-          fillWithSubscription<t13>(v13, (*current).second.first, result, filled);                                                                  \
-          if ((filled) && (!result)) {cancel((*current).first); continue;}                                                                          \
-          (*current).second.second->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13);                                                            \
-        } catch(DelegateProxy::Exceptions::DelegateGone &) {                                                                                        \
-          cancel((*current).first);                                                                                                                 \
-        }                                                                                                                                           \
-      }                                                                                                                                             \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_13(xQueued,xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13)                                            \
+    void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7, t8 v8, t9 v9, t10 v10, t11 v11, t12 v12, t13 v13) xConst xThrow override {                                   \
+      SubscribersPtr subscribers = getSubscribers();                                                                                                                           \
+      if ((xQueued) && (subscribers->mQueues.size() > 0)) {                                                                                                                    \
+        typedef internal::ProxySubscriptionsArguments<t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13> Arguments;                                                                   \
+        std::shared_ptr<Arguments> arguments(make_shared<Arguments>(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13));                                                              \
+        postToQueues(subscribers, #xMethod, passesSubscription<t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13>(), [arguments](Delegate &delegate, SubscriptionPtr &subscription) { \
+          delegate.xMethod(                                                                                                                                                    \
+            subscriberArgument<t1>(std::get<0>(arguments->mValues), subscription),                                                                                             \
+            subscriberArgument<t2>(std::get<1>(arguments->mValues), subscription),                                                                                             \
+            subscriberArgument<t3>(std::get<2>(arguments->mValues), subscription),                                                                                             \
+            subscriberArgument<t4>(std::get<3>(arguments->mValues), subscription),                                                                                             \
+            subscriberArgument<t5>(std::get<4>(arguments->mValues), subscription),                                                                                             \
+            subscriberArgument<t6>(std::get<5>(arguments->mValues), subscription),                                                                                             \
+            subscriberArgument<t7>(std::get<6>(arguments->mValues), subscription),                                                                                             \
+            subscriberArgument<t8>(std::get<7>(arguments->mValues), subscription),                                                                                             \
+            subscriberArgument<t9>(std::get<8>(arguments->mValues), subscription),                                                                                             \
+            subscriberArgument<t10>(std::get<9>(arguments->mValues), subscription),                                                                                            \
+            subscriberArgument<t11>(std::get<10>(arguments->mValues), subscription),                                                                                           \
+            subscriberArgument<t12>(std::get<11>(arguments->mValues), subscription),                                                                                           \
+            subscriberArgument<t13>(std::get<12>(arguments->mValues), subscription)                                                                                            \
+          );                                                                                                                                                                   \
+        });                                                                                                                                                                    \
+      }                                                                                                                                                                        \
+      for (auto iter = subscribers->mSubscribers.begin(); iter != subscribers->mSubscribers.end(); ++iter) {                                                                   \
+        const Subscriber &subscriber = (*iter);                                                                                                                                \
+        if ((xQueued) && (subscriber.mQueue)) continue;                                                                                                                        \
+        try {                                                                                                                                                                  \
+          bool filled = false;                                                                                                                                                 \
+          SubscriptionPtr result;                                                                                                                                              \
+          fillWithSubscription<t1>(v1, subscriber.mSubscription, result, filled);                                                                                              \
+          fillWithSubscription<t2>(v2, subscriber.mSubscription, result, filled);                                                                                              \
+          fillWithSubscription<t3>(v3, subscriber.mSubscription, result, filled);                                                                                              \
+          fillWithSubscription<t4>(v4, subscriber.mSubscription, result, filled);                                                                                              \
+          fillWithSubscription<t5>(v5, subscriber.mSubscription, result, filled);                                                                                              \
+          fillWithSubscription<t6>(v6, subscriber.mSubscription, result, filled);                                                                                              \
+          fillWithSubscription<t7>(v7, subscriber.mSubscription, result, filled);                                                                                              \
+          fillWithSubscription<t8>(v8, subscriber.mSubscription, result, filled);                                                                                              \
+          fillWithSubscription<t9>(v9, subscriber.mSubscription, result, filled);                                                                                              \
+          fillWithSubscription<t10>(v10, subscriber.mSubscription, result, filled);                                                                                            \
+          fillWithSubscription<t11>(v11, subscriber.mSubscription, result, filled);                                                                                            \
+          fillWithSubscription<t12>(v12, subscriber.mSubscription, result, filled);                                                                                            \
+          fillWithSubscription<t13>(v13, subscriber.mSubscription, result, filled);                                                                                            \
+          if ((filled) && (!result)) {cancel(subscriber.mKey); continue;}                                                                                                      \
+          subscriber.mDelegate->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13);                                                                                           \
+        } catch(DelegateProxy::Exceptions::DelegateGone &) {                                                                                                                   \
+          cancel(subscriber.mKey);                                                                                                                                             \
+        }                                                                                                                                                                      \
+      }                                                                                                                                                                        \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_14(xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14)                                     \
-    void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7, t8 v8, t9 v9, t10 v10, t11 v11, t12 v12, t13 v13, t14 v14) xConst xThrow override {               \
-      SubscriptionDelegateMapPtr subscription;                                                                                                                      \
-      {                                                                                                                                                             \
-        AutoRecursiveLock lock(mLock);                                                                                                                              \
-        subscription = mSubscriptions;                                                                                                                              \
-      }                                                                                                                                                             \
-      for (SubscriptionDelegateMap::iterator iter = subscription->begin(); iter != subscription->end(); ) {                                                         \
-        SubscriptionDelegateMap::iterator current = iter; ++iter;                                                                                                   \
-        try {                                                                                                                                                       \
-          bool filled = false;                                                                                                                                      \
-          SubscriptionPtr result;                                                                                                                                   \
-          fillWithSubscription<t1>(v1, (*current).second.first, result, filled);                                                                                    \
-          fillWithSubscription<t2>(v2, (*current).second.first, result, filled);                                                                                    \
-          fillWithSubscription<t3>(v3, (*current).second.first, result, filled);                                                                                    \
-          fillWithSubscription<t4>(v4, (*current).second.first, result, filled);                                                                                    \
-          fillWithSubscription<t5>(v5, (*current).second.first, result, filled);                                                                                    \
-          fillWithSubscription<t6>(v6, (*current).second.first, result, filled);                                                                                    \
-          fillWithSubscription<t7>(v7, (*current).second.first, result, filled);                                                                                    \
-          fillWithSubscription<t8>(v8, (*current).second.first, result, filled);                                                                                    \
-          fillWithSubscription<t9>(v9, (*current).second.first, result, filled);                                                                                    \
-          fillWithSubscription<t10>(v10, (*current).second.first, result, filled);                                                                                  \
-          fillWithSubscription<t11>(v11, (*current).second.first, result, filled);                                                                                  \
-          fillWithSubscription<t12>(v12, (*current).second.first, result, filled);                                                                                  \
-          fillWithSubscription<t13>(v13, (*current).second.first, result, filled);                                                                                  \
-          fillWithSubscription<t14>(v14, (*current).second.first, result, filled);                                                                                  \
-          if ((filled) && (!result)) {cancel((*current).first); continue;}                                                                                          \
-          (*current).second.second->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14);                                                                        \
-        } catch(DelegateProxy::Exceptions::DelegateGone &) {                                                                                                        \
-          cancel((*current).first);                                                                                                                                 \
-        }                                                                                                                                                           \
-      }                                                                                                                                                             \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_14(xQueued,xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14)                                            \
+    void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7, t8 v8, t9 v9, t10 v10, t11 v11, t12 v12, t13 v13, t14 v14) xConst xThrow override {                              \
+      SubscribersPtr subscribers = getSubscribers();                                                                                                                               \
+      if ((xQueued) && (subscribers->mQueues.size() > 0)) {                                                                                                                        \
+        typedef internal::ProxySubscriptionsArguments<t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14> Arguments;                                                                   \
+        std::shared_ptr<Arguments> arguments(make_shared<Arguments>(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14));                                                              \
+        postToQueues(subscribers, #xMethod, passesSubscription<t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14>(), [arguments](Delegate &delegate, SubscriptionPtr &subscription) { \
+          delegate.xMethod(                                                                                                                                                        \
+            subscriberArgument<t1>(std::get<0>(arguments->mValues), subscription),                                                                                                 \
+            subscriberArgument<t2>(std::get<1>(arguments->mValues), subscription),                                                                                                 \
+            subscriberArgument<t3>(std::get<2>(arguments->mValues), subscription),                                                                                                 \
+            subscriberArgument<t4>(std::get<3>(arguments->mValues), subscription),                                                                                                 \
+            subscriberArgument<t5>(std::get<4>(arguments->mValues), subscription),                                                                                                 \
+            subscriberArgument<t6>(std::get<5>(arguments->mValues), subscription),                                                                                                 \
+            subscriberArgument<t7>(std::get<6>(arguments->mValues), subscription),                                                                                                 \
+            subscriberArgument<t8>(std::get<7>(arguments->mValues), subscription),                                                                                                 \
+            subscriberArgument<t9>(std::get<8>(arguments->mValues), subscription),                                                                                                 \
+            subscriberArgument<t10>(std::get<9>(arguments->mValues), subscription),                                                                                                \
+            subscriberArgument<t11>(std::get<10>(arguments->mValues), subscription),                                                                                               \
+            subscriberArgument<t12>(std::get<11>(arguments->mValues), subscription),                                                                                               \
+            subscriberArgument<t13>(std::get<12>(arguments->mValues), subscription),                                                                                               \
+            subscriberArgument<t14>(std::get<13>(arguments->mValues), subscription)                                                                                                \
+          );                                                                                                                                                                       \
+        });                                                                                                                                                                        \
+      }                                                                                                                                                                            \
+      for (auto iter = subscribers->mSubscribers.begin(); iter != subscribers->mSubscribers.end(); ++iter) {                                                                       \
+        const Subscriber &subscriber = (*iter);                                                                                                                                    \
+        if ((xQueued) && (subscriber.mQueue)) continue;                                                                                                                            \
+        try {                                                                                                                                                                      \
+          bool filled = false;                                                                                                                                                     \
+          SubscriptionPtr result;                                                                                                                                                  \
+          fillWithSubscription<t1>(v1, subscriber.mSubscription, result, filled);                                                                                                  \
+          fillWithSubscription<t2>(v2, subscriber.mSubscription, result, filled);                                                                                                  \
+          fillWithSubscription<t3>(v3, subscriber.mSubscription, result, filled);                                                                                                  \
+          fillWithSubscription<t4>(v4, subscriber.mSubscription, result, filled);                                                                                                  \
+          fillWithSubscription<t5>(v5, subscriber.mSubscription, result, filled);                                                                                                  \
+          fillWithSubscription<t6>(v6, subscriber.mSubscription, result, filled);                                                                                                  \
+          fillWithSubscription<t7>(v7, subscriber.mSubscription, result, filled);                                                                                                  \
+          fillWithSubscription<t8>(v8, subscriber.mSubscription, result, filled);                                                                                                  \
+          fillWithSubscription<t9>(v9, subscriber.mSubscription, result, filled);                                                                                                  \
+          fillWithSubscription<t10>(v10, subscriber.mSubscription, result, filled);                                                                                                \
+          fillWithSubscription<t11>(v11, subscriber.mSubscription, result, filled);                                                                                                \
+          fillWithSubscription<t12>(v12, subscriber.mSubscription, result, filled);                                                                                                \
+          fillWithSubscription<t13>(v13, subscriber.mSubscription, result, filled);                                                                                                \
+          fillWithSubscription<t14>(v14, subscriber.mSubscription, result, filled);                                                                                                \
+          if ((filled) && (!result)) {cancel(subscriber.mKey); continue;}                                                                                                          \
+          subscriber.mDelegate->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14);                                                                                           \
+        } catch(DelegateProxy::Exceptions::DelegateGone &) {                                                                                                                       \
+          cancel(subscriber.mKey);                                                                                                                                                 \
+        }                                                                                                                                                                          \
+      }                                                                                                                                                                            \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_15(xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15)                                 \
-    void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7, t8 v8, t9 v9, t10 v10, t11 v11, t12 v12, t13 v13, t14 v14, t15 v15) xConst xThrow override {      \
-      SubscriptionDelegateMapPtr subscription;                                                                                                                      \
-      {                                                                                                                                                             \
-        AutoRecursiveLock lock(mLock);                                                                                                                              \
-        subscription = mSubscriptions;                                                                                                                              \
-      }                                                                                                                                                             \
-      for (SubscriptionDelegateMap::iterator iter = subscription->begin(); iter != subscription->end(); ) {                                                         \
-        SubscriptionDelegateMap::iterator current = iter; ++iter;                                                                                                   \
-        try {                                                                                                                                                       \
-          bool filled = false;                                                                                                                                      \
-          SubscriptionPtr result;                                                                                                                                   \
-          fillWithSubscription<t1>(v1, (*current).second.first, result, filled);                                                                                    \
-          fillWithSubscription<t2>(v2, (*current).second.first, result, filled);                                                                                    \
-          fillWithSubscription<t3>(v3, (*current).second.first, result, filled);                                                                                    \
-          fillWithSubscription<t4>(v4, (*current).second.first, result, filled);                                                                                    \
-          fillWithSubscription<t5>(v5, (*current).second.first, result, filled);                                                                                    \
-          fillWithSubscription<t6>(v6, (*current).second.first, result, filled);                                                                                    \
-          fillWithSubscription<t7>(v7, (*current).second.first, result, filled);                                                                                    \
-          fillWithSubscription<t8>(v8, (*current).second.first, result, filled);                                                                                    \
-          fillWithSubscription<t9>(v9, (*current).second.first, result, filled);                                                                                    \
-          fillWithSubscription<t10>(v10, (*current).second.first, result, filled);                                                                                  \
-          fillWithSubscription<t11>(v11, (*current).second.first, result, filled);                                                                                  \
-          fillWithSubscription<t12>(v12, (*current).second.first, result, filled);                                                                                  \
-          fillWithSubscription<t13>(v13, (*current).second.first, result, filled);                                                                                  \
-          fillWithSubscription<t14>(v14, (*current).second.first, result, filled);                                                                                  \
-          fillWithSubscription<t15>(v15, (*current).second.first, result, filled);                                                                                  \
-          if ((filled) && (!result)) {cancel((*current).first); continue;}                                                                                          \
-          (*current).second.second->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15);                                                                    \
-        } catch(DelegateProxy::Exceptions::DelegateGone &) {                                                                                                        \
-          cancel((*current).first);                                                                                                                                 \
-        }                                                                                                                                                           \
-      }                                                                                                                                                             \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_15(xQueued,xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15)                                            \
+    void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7, t8 v8, t9 v9, t10 v10, t11 v11, t12 v12, t13 v13, t14 v14, t15 v15) xConst xThrow override {                         \
+      SubscribersPtr subscribers = getSubscribers();                                                                                                                                   \
+      if ((xQueued) && (subscribers->mQueues.size() > 0)) {                                                                                                                            \
+        typedef internal::ProxySubscriptionsArguments<t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15> Arguments;                                                                   \
+        std::shared_ptr<Arguments> arguments(make_shared<Arguments>(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15));                                                              \
+        postToQueues(subscribers, #xMethod, passesSubscription<t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15>(), [arguments](Delegate &delegate, SubscriptionPtr &subscription) { \
+          delegate.xMethod(                                                                                                                                                            \
+            subscriberArgument<t1>(std::get<0>(arguments->mValues), subscription),                                                                                                     \
+            subscriberArgument<t2>(std::get<1>(arguments->mValues), subscription),                                                                                                     \
+            subscriberArgument<t3>(std::get<2>(arguments->mValues), subscription),                                                                                                     \
+            subscriberArgument<t4>(std::get<3>(arguments->mValues), subscription),                                                                                                     \
+            subscriberArgument<t5>(std::get<4>(arguments->mValues), subscription),                                                                                                     \
+            subscriberArgument<t6>(std::get<5>(arguments->mValues), subscription),                                                                                                     \
+            subscriberArgument<t7>(std::get<6>(arguments->mValues), subscription),                                                                                                     \
+            subscriberArgument<t8>(std::get<7>(arguments->mValues), subscription),                                                                                                     \
+            subscriberArgument<t9>(std::get<8>(arguments->mValues), subscription),                                                                                                     \
+            subscriberArgument<t10>(std::get<9>(arguments->mValues), subscription),                                                                                                    \
+            subscriberArgument<t11>(std::get<10>(arguments->mValues), subscription),                                                                                                   \
+            subscriberArgument<t12>(std::get<11>(arguments->mValues), subscription),                                                                                                   \
+            subscriberArgument<t13>(std::get<12>(arguments->mValues), subscription),                                                                                                   \
+            subscriberArgument<t14>(std::get<13>(arguments->mValues), subscription),                                                                                                   \
+            subscriberArgument<t15>(std::get<14>(arguments->mValues), subscription)                                                                                                    \
+          );                                                                                                                                                                           \
+        });                                                                                                                                                                            \
+      }                                                                                                                                                                                \
+      for (auto iter = subscribers->mSubscribers.begin(); iter != subscribers->mSubscribers.end(); ++iter) {                                                                           \
+        const Subscriber &subscriber = (*iter);                                                                                                                                        \
+        if ((xQueued) && (subscriber.mQueue)) continue;                                                                                                                                \
+        try {                                                                                                                                                                          \
+          bool filled = false;                                                                                                                                                         \
+          SubscriptionPtr result;                                                                                                                                                      \
+          fillWithSubscription<t1>(v1, subscriber.mSubscription, result, filled);                                                                                                      \
+          fillWithSubscription<t2>(v2, subscriber.mSubscription, result, filled);                                                                                                      \
+          fillWithSubscription<t3>(v3, subscriber.mSubscription, result, filled);                                                                                                      \
+          fillWithSubscription<t4>(v4, subscriber.mSubscription, result, filled);                                                                                                      \
+          fillWithSubscription<t5>(v5, subscriber.mSubscription, result, filled);                                                                                                      \
+          fillWithSubscription<t6>(v6, subscriber.mSubscription, result, filled);                                                                                                      \
+          fillWithSubscription<t7>(v7, subscriber.mSubscription, result, filled);                                                                                                      \
+          fillWithSubscription<t8>(v8, subscriber.mSubscription, result, filled);                                                                                                      \
+          fillWithSubscription<t9>(v9, subscriber.mSubscription, result, filled);                                                                                                      \
+          fillWithSubscription<t10>(v10, subscriber.mSubscription, result, filled);                                                                                                    \
+          fillWithSubscription<t11>(v11, subscriber.mSubscription, result, filled);                                                                                                    \
+          fillWithSubscription<t12>(v12, subscriber.mSubscription, result, filled);                                                                                                    \
+          fillWithSubscription<t13>(v13, subscriber.mSubscription, result, filled);                                                                                                    \
+          fillWithSubscription<t14>(v14, subscriber.mSubscription, result, filled);                                                                                                    \
+          fillWithSubscription<t15>(v15, subscriber.mSubscription, result, filled);                                                                                                    \
+          if ((filled) && (!result)) {cancel(subscriber.mKey); continue;}                                                                                                              \
+          subscriber.mDelegate->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15);                                                                                           \
+        } catch(DelegateProxy::Exceptions::DelegateGone &) {                                                                                                                           \
+          cancel(subscriber.mKey);                                                                                                                                                     \
+        }                                                                                                                                                                              \
+      }                                                                                                                                                                                \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_16(xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16)                                                                                                     \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_16(xQueued,xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16)                                                                                             \
     void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7, t8 v8, t9 v9, t10 v10, t11 v11, t12 v12, t13 v13, t14 v14, t15 v15, t16 v16) xConst xThrow override {                                                                     \
-      SubscriptionDelegateMapPtr subscription;                                                                                                                                                                                              \
-      {                                                                                                                                                                                                                                     \
-        AutoRecursiveLock lock(mLock);                                                                                                                                                                                                      \
-        subscription = mSubscriptions;                                                                                                                                                                                                      \
+      SubscribersPtr subscribers = getSubscribers();                                                                                                                                                                                        \
+      if ((xQueued) && (subscribers->mQueues.size() > 0)) {                                                                                                                                                                                 \
+        typedef internal::ProxySubscriptionsArguments<t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16> Arguments;                                                                                                                    \
+        std::shared_ptr<Arguments> arguments(make_shared<Arguments>(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16));                                                                                                               \
+        postToQueues(subscribers, #xMethod, passesSubscription<t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16>(), [arguments](Delegate &delegate, SubscriptionPtr &subscription) {                                                  \
+          delegate.xMethod(                                                                                                                                                                                                                 \
+            subscriberArgument<t1>(std::get<0>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t2>(std::get<1>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t3>(std::get<2>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t4>(std::get<3>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t5>(std::get<4>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t6>(std::get<5>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t7>(std::get<6>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t8>(std::get<7>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t9>(std::get<8>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t10>(std::get<9>(arguments->mValues), subscription),                                                                                                                                                         \
+            subscriberArgument<t11>(std::get<10>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t12>(std::get<11>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t13>(std::get<12>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t14>(std::get<13>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t15>(std::get<14>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t16>(std::get<15>(arguments->mValues), subscription)                                                                                                                                                         \
+          );                                                                                                                                                                                                                                \
+        });                                                                                                                                                                                                                                 \
       }                                                                                                                                                                                                                                     \
-      for (SubscriptionDelegateMap::iterator iter = subscription->begin(); iter != subscription->end(); ) {                                                                                                                                 \
-        SubscriptionDelegateMap::iterator current = iter; ++iter;                                                                                                                                                                           \
+      for (auto iter = subscribers->mSubscribers.begin(); iter != subscribers->mSubscribers.end(); ++iter) {                                                                                                                                \
+        const Subscriber &subscriber = (*iter);                                                                                                                                                                                             \
+        if ((xQueued) && (subscriber.mQueue)) continue;                                                                                                                                                                                     \
         try {                                                                                                                                                                                                                               \
           bool filled = false;                                                                                                                                                                                                              \
           SubscriptionPtr result;                                                                                                                                                                                                           \
-          fillWithSubscription<t1>(v1, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t2>(v2, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t3>(v3, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t4>(v4, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t5>(v5, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t6>(v6, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t7>(v7, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t8>(v8, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t9>(v9, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t10>(v10, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t11>(v11, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t12>(v12, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t13>(v13, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t14>(v14, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t15>(v15, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t16>(v16, (*current).second.first, result, filled);                                                                                                                                                          \
-          if ((filled) && (!result)) {cancel((*current).first); continue;}                                                                                                                                                                  \
-          (*current).second.second->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16);                                                                                                                                        \
+          fillWithSubscription<t1>(v1, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t2>(v2, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t3>(v3, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t4>(v4, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t5>(v5, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t6>(v6, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t7>(v7, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t8>(v8, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t9>(v9, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t10>(v10, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t11>(v11, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t12>(v12, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t13>(v13, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t14>(v14, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t15>(v15, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t16>(v16, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          if ((filled) && (!result)) {cancel(subscriber.mKey); continue;}                                                                                                                                                                   \
+          subscriber.mDelegate->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16);                                                                                                                                            \
         } catch(DelegateProxy::Exceptions::DelegateGone &) {                                                                                                                                                                                \
-          cancel((*current).first);                                                                                                                                                                                                         \
+          cancel(subscriber.mKey);                                                                                                                                                                                                          \
         }                                                                                                                                                                                                                                   \
       }                                                                                                                                                                                                                                     \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_17(xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17)                                                                                                 \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_17(xQueued,xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17)                                                                                         \
     void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7, t8 v8, t9 v9, t10 v10, t11 v11, t12 v12, t13 v13, t14 v14, t15 v15, t16 v16, t17 v17) xConst xThrow override {                                                            \
-      SubscriptionDelegateMapPtr subscription;                                                                                                                                                                                              \
-      {                                                                                                                                                                                                                                     \
-        AutoRecursiveLock lock(mLock);                                                                                                                                                                                                      \
-        subscription = mSubscriptions;                                                                                                                                                                                                      \
+      SubscribersPtr subscribers = getSubscribers();                                                                                                                                                                                        \
+      if ((xQueued) && (subscribers->mQueues.size() > 0)) {                                                                                                                                                                                 \
+        typedef internal::ProxySubscriptionsArguments<t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17> Arguments;                                                                                                                \
+        std::shared_ptr<Arguments> arguments(make_shared<Arguments>(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17));                                                                                                           \
+        postToQueues(subscribers, #xMethod, passesSubscription<t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17>(), [arguments](Delegate &delegate, SubscriptionPtr &subscription) {                                              \
+          delegate.xMethod(                                                                                                                                                                                                                 \
+            subscriberArgument<t1>(std::get<0>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t2>(std::get<1>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t3>(std::get<2>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t4>(std::get<3>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t5>(std::get<4>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t6>(std::get<5>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t7>(std::get<6>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t8>(std::get<7>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t9>(std::get<8>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t10>(std::get<9>(arguments->mValues), subscription),                                                                                                                                                         \
+            subscriberArgument<t11>(std::get<10>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t12>(std::get<11>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t13>(std::get<12>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t14>(std::get<13>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t15>(std::get<14>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t16>(std::get<15>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t17>(std::get<16>(arguments->mValues), subscription)                                                                                                                                                         \
+          );                                                                                                                                                                                                                                \
+        });                                                                                                                                                                                                                                 \
       }                                                                                                                                                                                                                                     \
-      for (SubscriptionDelegateMap::iterator iter = subscription->begin(); iter != subscription->end(); ) {                                                                                                                                 \
-        SubscriptionDelegateMap::iterator current = iter; ++iter;                                                                                                                                                                           \
+      for (auto iter = subscribers->mSubscribers.begin(); iter != subscribers->mSubscribers.end(); ++iter) {                                                                                                                                \
+        const Subscriber &subscriber = (*iter);                                                                                                                                                                                             \
+        if ((xQueued) && (subscriber.mQueue)) continue;                                                                                                                                                                                     \
         try {                                                                                                                                                                                                                               \
           bool filled = false;                                                                                                                                                                                                              \
           SubscriptionPtr result;                                                                                                                                                                                                           \
-          fillWithSubscription<t1>(v1, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t2>(v2, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t3>(v3, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t4>(v4, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t5>(v5, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t6>(v6, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t7>(v7, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t8>(v8, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t9>(v9, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t10>(v10, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t11>(v11, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t12>(v12, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t13>(v13, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t14>(v14, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t15>(v15, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t16>(v16, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t17>(v17, (*current).second.first, result, filled);                                                                                                                                                          \
-          if ((filled) && (!result)) {cancel((*current).first); continue;}                                                                                                                                                                  \
-          (*current).second.second->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17);                                                                                                                                    \
+          fillWithSubscription<t1>(v1, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t2>(v2, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t3>(v3, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t4>(v4, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t5>(v5, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t6>(v6, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t7>(v7, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t8>(v8, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t9>(v9, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t10>(v10, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t11>(v11, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t12>(v12, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t13>(v13, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t14>(v14, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t15>(v15, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t16>(v16, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t17>(v17, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          if ((filled) && (!result)) {cancel(subscriber.mKey); continue;}                                                                                                                                                                   \
+          subscriber.mDelegate->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17);                                                                                                                                        \
         } catch(DelegateProxy::Exceptions::DelegateGone &) {                                                                                                                                                                                \
-          cancel((*current).first);                                                                                                                                                                                                         \
+          cancel(subscriber.mKey);                                                                                                                                                                                                          \
         }                                                                                                                                                                                                                                   \
       }                                                                                                                                                                                                                                     \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_18(xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18)                                                                                             \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_18(xQueued,xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18)                                                                                     \
     void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7, t8 v8, t9 v9, t10 v10, t11 v11, t12 v12, t13 v13, t14 v14, t15 v15, t16 v16, t17 v17, t18 v18) xConst xThrow override {                                                   \
-      SubscriptionDelegateMapPtr subscription;                                                                                                                                                                                              \
-      {                                                                                                                                                                                                                                     \
-        AutoRecursiveLock lock(mLock);                                                                                                                                                                                                      \
-        subscription = mSubscriptions;                                                                                                                                                                                                      \
+      SubscribersPtr subscribers = getSubscribers();                                                                                                                                                                                        \
+      if ((xQueued) && (subscribers->mQueues.size() > 0)) {                                                                                                                                                                                 \
+        typedef internal::ProxySubscriptionsArguments<t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18> Arguments;                                                                                                            \
+        std::shared_ptr<Arguments> arguments(make_shared<Arguments>(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17,v18));                                                                                                       \
+        postToQueues(subscribers, #xMethod, passesSubscription<t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18>(), [arguments](Delegate &delegate, SubscriptionPtr &subscription) {                                          \
+          delegate.xMethod(                                                                                                                                                                                                                 \
+            subscriberArgument<t1>(std::get<0>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t2>(std::get<1>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t3>(std::get<2>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t4>(std::get<3>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t5>(std::get<4>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t6>(std::get<5>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t7>(std::get<6>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t8>(std::get<7>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t9>(std::get<8>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t10>(std::get<9>(arguments->mValues), subscription),                                                                                                                                                         \
+            subscriberArgument<t11>(std::get<10>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t12>(std::get<11>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t13>(std::get<12>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t14>(std::get<13>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t15>(std::get<14>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t16>(std::get<15>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t17>(std::get<16>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t18>(std::get<17>(arguments->mValues), subscription)                                                                                                                                                         \
+          );                                                                                                                                                                                                                                \
+        });                                                                                                                                                                                                                                 \
       }                                                                                                                                                                                                                                     \
-      for (SubscriptionDelegateMap::iterator iter = subscription->begin(); iter != subscription->end(); ) {                                                                                                                                 \
-        SubscriptionDelegateMap::iterator current = iter; ++iter;                                                                                                                                                                           \
+      for (auto iter = subscribers->mSubscribers.begin(); iter != subscribers->mSubscribers.end(); ++iter) {                                                                                                                                \
+        const Subscriber &subscriber = (*iter);                                                                                                                                                                                             \
+        if ((xQueued) && (subscriber.mQueue)) continue;                                                                                                                                                                                     \
         try {                                                                                                                                                                                                                               \
           bool filled = false;                                                                                                                                                                                                              \
           SubscriptionPtr result;                                                                                                                                                                                                           \
-          fillWithSubscription<t1>(v1, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t2>(v2, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t3>(v3, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t4>(v4, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t5>(v5, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t6>(v6, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t7>(v7, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t8>(v8, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t9>(v9, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t10>(v10, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t11>(v11, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t12>(v12, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t13>(v13, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t14>(v14, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t15>(v15, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t16>(v16, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t17>(v17, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t18>(v18, (*current).second.first, result, filled);                                                                                                                                                          \
-          if ((filled) && (!result)) {cancel((*current).first); continue;}                                                                                                                                                                  \
-          (*current).second.second->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17,v18);                                                                                                                                \
+          fillWithSubscription<t1>(v1, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t2>(v2, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t3>(v3, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t4>(v4, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t5>(v5, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t6>(v6, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t7>(v7, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t8>(v8, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t9>(v9, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t10>(v10, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t11>(v11, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t12>(v12, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t13>(v13, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t14>(v14, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t15>(v15, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t16>(v16, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t17>(v17, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t18>(v18, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          if ((filled) && (!result)) {cancel(subscriber.mKey); continue;}                                                                                                                                                                   \
+          subscriber.mDelegate->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17,v18);                                                                                                                                    \
         } catch(DelegateProxy::Exceptions::DelegateGone &) {                                                                                                                                                                                \
-          cancel((*current).first);                                                                                                                                                                                                         \
+          cancel(subscriber.mKey);                                                                                                                                                                                                          \
         }                                                                                                                                                                                                                                   \
       }                                                                                                                                                                                                                                     \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_19(xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19)                                                                                         \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_19(xQueued,xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19)                                                                                 \
     void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7, t8 v8, t9 v9, t10 v10, t11 v11, t12 v12, t13 v13, t14 v14, t15 v15, t16 v16, t17 v17, t18 v18, t19 v19) xConst xThrow override {                                          \
-      SubscriptionDelegateMapPtr subscription;                                                                                                                                                                                              \
-      {                                                                                                                                                                                                                                     \
-        AutoRecursiveLock lock(mLock);                                                                                                                                                                                                      \
-        subscription = mSubscriptions;                                                                                                                                                                                                      \
+      SubscribersPtr subscribers = getSubscribers();                                                                                                                                                                                        \
+      if ((xQueued) && (subscribers->mQueues.size() > 0)) {                                                                                                                                                                                 \
+        typedef internal::ProxySubscriptionsArguments<t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19> Arguments;                                                                                                        \
+        std::shared_ptr<Arguments> arguments(make_shared<Arguments>(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17,v18,v19));                                                                                                   \
+        postToQueues(subscribers, #xMethod, passesSubscription<t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19>(), [arguments](Delegate &delegate, SubscriptionPtr &subscription) {                                      \
+          delegate.xMethod(                                                                                                                                                                                                                 \
+            subscriberArgument<t1>(std::get<0>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t2>(std::get<1>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t3>(std::get<2>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t4>(std::get<3>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t5>(std::get<4>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t6>(std::get<5>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t7>(std::get<6>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t8>(std::get<7>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t9>(std::get<8>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t10>(std::get<9>(arguments->mValues), subscription),                                                                                                                                                         \
+            subscriberArgument<t11>(std::get<10>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t12>(std::get<11>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t13>(std::get<12>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t14>(std::get<13>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t15>(std::get<14>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t16>(std::get<15>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t17>(std::get<16>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t18>(std::get<17>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t19>(std::get<18>(arguments->mValues), subscription)                                                                                                                                                         \
+          );                                                                                                                                                                                                                                \
+        });                                                                                                                                                                                                                                 \
       }                                                                                                                                                                                                                                     \
-      for (SubscriptionDelegateMap::iterator iter = subscription->begin(); iter != subscription->end(); ) {                                                                                                                                 \
-        SubscriptionDelegateMap::iterator current = iter; ++iter;                                                                                                                                                                           \
+      for (auto iter = subscribers->mSubscribers.begin(); iter != subscribers->mSubscribers.end(); ++iter) {                                                                                                                                \
+        const Subscriber &subscriber = (*iter);                                                                                                                                                                                             \
+        if ((xQueued) && (subscriber.mQueue)) continue;                                                                                                                                                                                     \
         try {                                                                                                                                                                                                                               \
           bool filled = false;                                                                                                                                                                                                              \
           SubscriptionPtr result;                                                                                                                                                                                                           \
-          fillWithSubscription<t1>(v1, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t2>(v2, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t3>(v3, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t4>(v4, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t5>(v5, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t6>(v6, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t7>(v7, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t8>(v8, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t9>(v9, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t10>(v10, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t11>(v11, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t12>(v12, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t13>(v13, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t14>(v14, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t15>(v15, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t16>(v16, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t17>(v17, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t18>(v18, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t19>(v19, (*current).second.first, result, filled);                                                                                                                                                          \
-          if ((filled) && (!result)) {cancel((*current).first); continue;}                                                                                                                                                                  \
-          (*current).second.second->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17,v18,v19);                                                                                                                            \
+          fillWithSubscription<t1>(v1, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t2>(v2, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t3>(v3, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t4>(v4, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t5>(v5, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t6>(v6, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t7>(v7, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t8>(v8, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t9>(v9, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t10>(v10, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t11>(v11, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t12>(v12, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t13>(v13, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t14>(v14, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t15>(v15, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t16>(v16, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t17>(v17, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t18>(v18, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t19>(v19, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          if ((filled) && (!result)) {cancel(subscriber.mKey); continue;}                                                                                                                                                                   \
+          subscriber.mDelegate->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17,v18,v19);                                                                                                                                \
         } catch(DelegateProxy::Exceptions::DelegateGone &) {                                                                                                                                                                                \
-          cancel((*current).first);                                                                                                                                                                                                         \
+          cancel(subscriber.mKey);                                                                                                                                                                                                          \
         }                                                                                                                                                                                                                                   \
       }                                                                                                                                                                                                                                     \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_20(xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20)                                                                                     \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_20(xQueued,xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20)                                                                             \
     void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7, t8 v8, t9 v9, t10 v10, t11 v11, t12 v12, t13 v13, t14 v14, t15 v15, t16 v16, t17 v17, t18 v18, t19 v19, t20 v20) xConst xThrow override {                                 \
-      SubscriptionDelegateMapPtr subscription;                                                                                                                                                                                              \
-      {                                                                                                                                                                                                                                     \
-        AutoRecursiveLock lock(mLock);                                                                                                                                                                                                      \
-        subscription = mSubscriptions;                                                                                                                                                                                                      \
+      SubscribersPtr subscribers = getSubscribers();                                                                                                                                                                                        \
+      if ((xQueued) && (subscribers->mQueues.size() > 0)) {                                                                                                                                                                                 \
+        typedef internal::ProxySubscriptionsArguments<t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20> Arguments;                                                                                                    \
+        std::shared_ptr<Arguments> arguments(make_shared<Arguments>(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17,v18,v19,v20));                                                                                               \
+        postToQueues(subscribers, #xMethod, passesSubscription<t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20>(), [arguments](Delegate &delegate, SubscriptionPtr &subscription) {                                  \
+          delegate.xMethod(                                                                                                                                                                                                                 \
+            subscriberArgument<t1>(std::get<0>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t2>(std::get<1>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t3>(std::get<2>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t4>(std::get<3>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t5>(std::get<4>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t6>(std::get<5>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t7>(std::get<6>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t8>(std::get<7>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t9>(std::get<8>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t10>(std::get<9>(arguments->mValues), subscription),                                                                                                                                                         \
+            subscriberArgument<t11>(std::get<10>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t12>(std::get<11>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t13>(std::get<12>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t14>(std::get<13>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t15>(std::get<14>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t16>(std::get<15>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t17>(std::get<16>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t18>(std::get<17>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t19>(std::get<18>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t20>(std::get<19>(arguments->mValues), subscription)                                                                                                                                                         \
+          );                                                                                                                                                                                                                                \
+        });                                                                                                                                                                                                                                 \
       }                                                                                                                                                                                                                                     \
-      for (SubscriptionDelegateMap::iterator iter = subscription->begin(); iter != subscription->end(); ) {                                                                                                                                 \
-        SubscriptionDelegateMap::iterator current = iter; ++iter;                                                                                                                                                                           \
+      for (auto iter = subscribers->mSubscribers.begin(); iter != subscribers->mSubscribers.end(); ++iter) {                                                                                                                                \
+        const Subscriber &subscriber = (*iter);                                                                                                                                                                                             \
+        if ((xQueued) && (subscriber.mQueue)) continue;                                                                                                                                                                                     \
         try {                                                                                                                                                                                                                               \
           bool filled = false;                                                                                                                                                                                                              \
           SubscriptionPtr result;                                                                                                                                                                                                           \
-          fillWithSubscription<t1>(v1, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t2>(v2, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t3>(v3, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t4>(v4, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t5>(v5, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t6>(v6, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t7>(v7, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t8>(v8, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t9>(v9, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t10>(v10, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t11>(v11, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t12>(v12, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t13>(v13, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t14>(v14, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t15>(v15, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t16>(v16, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t17>(v17, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t18>(v18, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t19>(v19, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t20>(v20, (*current).second.first, result, filled);                                                                                                                                                          \
-          if ((filled) && (!result)) {cancel((*current).first); continue;}                                                                                                                                                                  \
-          (*current).second.second->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17,v18,v19,v20);                                                                                                                        \
+          fillWithSubscription<t1>(v1, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t2>(v2, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t3>(v3, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t4>(v4, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t5>(v5, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t6>(v6, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t7>(v7, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t8>(v8, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t9>(v9, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t10>(v10, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t11>(v11, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t12>(v12, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t13>(v13, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t14>(v14, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t15>(v15, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t16>(v16, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t17>(v17, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t18>(v18, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t19>(v19, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t20>(v20, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          if ((filled) && (!result)) {cancel(subscriber.mKey); continue;}                                                                                                                                                                   \
+          subscriber.mDelegate->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17,v18,v19,v20);                                                                                                                            \
         } catch(DelegateProxy::Exceptions::DelegateGone &) {                                                                                                                                                                                \
-          cancel((*current).first);                                                                                                                                                                                                         \
+          cancel(subscriber.mKey);                                                                                                                                                                                                          \
         }                                                                                                                                                                                                                                   \
       }                                                                                                                                                                                                                                     \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_21(xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21)                                                                                 \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_21(xQueued,xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21)                                                                         \
     void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7, t8 v8, t9 v9, t10 v10, t11 v11, t12 v12, t13 v13, t14 v14, t15 v15, t16 v16, t17 v17, t18 v18, t19 v19, t20 v20, t21 v21) xConst xThrow override {                        \
-      SubscriptionDelegateMapPtr subscription;                                                                                                                                                                                              \
-      {                                                                                                                                                                                                                                     \
-        AutoRecursiveLock lock(mLock);                                                                                                                                                                                                      \
-        subscription = mSubscriptions;                                                                                                                                                                                                      \
+      SubscribersPtr subscribers = getSubscribers();                                                                                                                                                                                        \
+      if ((xQueued) && (subscribers->mQueues.size() > 0)) {                                                                                                                                                                                 \
+        typedef internal::ProxySubscriptionsArguments<t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21> Arguments;                                                                                                \
+        std::shared_ptr<Arguments> arguments(make_shared<Arguments>(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17,v18,v19,v20,v21));                                                                                           \
+        postToQueues(subscribers, #xMethod, passesSubscription<t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21>(), [arguments](Delegate &delegate, SubscriptionPtr &subscription) {                              \
+          delegate.xMethod(                                                                                                                                                                                                                 \
+            subscriberArgument<t1>(std::get<0>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t2>(std::get<1>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t3>(std::get<2>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t4>(std::get<3>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t5>(std::get<4>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t6>(std::get<5>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t7>(std::get<6>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t8>(std::get<7>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t9>(std::get<8>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t10>(std::get<9>(arguments->mValues), subscription),                                                                                                                                                         \
+            subscriberArgument<t11>(std::get<10>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t12>(std::get<11>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t13>(std::get<12>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t14>(std::get<13>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t15>(std::get<14>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t16>(std::get<15>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t17>(std::get<16>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t18>(std::get<17>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t19>(std::get<18>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t20>(std::get<19>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t21>(std::get<20>(arguments->mValues), subscription)                                                                                                                                                         \
+          );                                                                                                                                                                                                                                \
+        });                                                                                                                                                                                                                                 \
       }                                                                                                                                                                                                                                     \
-      for (SubscriptionDelegateMap::iterator iter = subscription->begin(); iter != subscription->end(); ) {                                                                                                                                 \
-        SubscriptionDelegateMap::iterator current = iter; ++iter;                                                                                                                                                                           \
+      for (auto iter = subscribers->mSubscribers.begin(); iter != subscribers->mSubscribers.end(); ++iter) {                                                                                                                                \
+        const Subscriber &subscriber = (*iter);                                                                                                                                                                                             \
+        if ((xQueued) && (subscriber.mQueue)) continue;                                                                                                                                                                                     \
         try {                                                                                                                                                                                                                               \
           bool filled = false;                                                                                                                                                                                                              \
           SubscriptionPtr result;                                                                                                                                                                                                           \
-          fillWithSubscription<t1>(v1, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t2>(v2, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t3>(v3, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t4>(v4, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t5>(v5, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t6>(v6, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t7>(v7, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t8>(v8, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t9>(v9, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t10>(v10, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t11>(v11, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t12>(v12, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t13>(v13, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t14>(v14, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t15>(v15, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t16>(v16, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t17>(v17, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t18>(v18, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t19>(v19, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t20>(v20, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t21>(v21, (*current).second.first, result, filled);                                                                                                                                                          \
-          if ((filled) && (!result)) {cancel((*current).first); continue;}                                                                                                                                                                  \
-          (*current).second.second->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17,v18,v19,v20,v21);                                                                                                                    \
+          fillWithSubscription<t1>(v1, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t2>(v2, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t3>(v3, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t4>(v4, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t5>(v5, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t6>(v6, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t7>(v7, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t8>(v8, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t9>(v9, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t10>(v10, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t11>(v11, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t12>(v12, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t13>(v13, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t14>(v14, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t15>(v15, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t16>(v16, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t17>(v17, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t18>(v18, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t19>(v19, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t20>(v20, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t21>(v21, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          if ((filled) && (!result)) {cancel(subscriber.mKey); continue;}                                                                                                                                                                   \
+          subscriber.mDelegate->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17,v18,v19,v20,v21);                                                                                                                        \
         } catch(DelegateProxy::Exceptions::DelegateGone &) {                                                                                                                                                                                \
-          cancel((*current).first);                                                                                                                                                                                                         \
+          cancel(subscriber.mKey);                                                                                                                                                                                                          \
         }                                                                                                                                                                                                                                   \
       }                                                                                                                                                                                                                                     \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_22(xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21,t22)                                                                             \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_22(xQueued,xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21,t22)                                                                     \
     void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7, t8 v8, t9 v9, t10 v10, t11 v11, t12 v12, t13 v13, t14 v14, t15 v15, t16 v16, t17 v17, t18 v18, t19 v19, t20 v20, t21 v21, t22 v22) xConst xThrow override {               \
-      SubscriptionDelegateMapPtr subscription;                                                                                                                                                                                              \
-      {                                                                                                                                                                                                                                     \
-        AutoRecursiveLock lock(mLock);                                                                                                                                                                                                      \
-        subscription = mSubscriptions;                                                                                                                                                                                                      \
+      SubscribersPtr subscribers = getSubscribers();                                                                                                                                                                                        \
+      if ((xQueued) && (subscribers->mQueues.size() > 0)) {                                                                                                                                                                                 \
+        typedef internal::ProxySubscriptionsArguments<t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21,t22> Arguments;                                                                                            \
+        std::shared_ptr<Arguments> arguments(make_shared<Arguments>(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17,v18,v19,v20,v21,v22));                                                                                       \
+        postToQueues(subscribers, #xMethod, passesSubscription<t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21,t22>(), [arguments](Delegate &delegate, SubscriptionPtr &subscription) {                          \
+          delegate.xMethod(                                                                                                                                                                                                                 \
+            subscriberArgument<t1>(std::get<0>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t2>(std::get<1>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t3>(std::get<2>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t4>(std::get<3>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t5>(std::get<4>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t6>(std::get<5>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t7>(std::get<6>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t8>(std::get<7>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t9>(std::get<8>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t10>(std::get<9>(arguments->mValues), subscription),                                                                                                                                                         \
+            subscriberArgument<t11>(std::get<10>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t12>(std::get<11>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t13>(std::get<12>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t14>(std::get<13>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t15>(std::get<14>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t16>(std::get<15>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t17>(std::get<16>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t18>(std::get<17>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t19>(std::get<18>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t20>(std::get<19>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t21>(std::get<20>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t22>(std::get<21>(arguments->mValues), subscription)                                                                                                                                                         \
+          );                                                                                                                                                                                                                                \
+        });                                                                                                                                                                                                                                 \
       }                                                                                                                                                                                                                                     \
-      for (SubscriptionDelegateMap::iterator iter = subscription->begin(); iter != subscription->end(); ) {                                                                                                                                 \
-        SubscriptionDelegateMap::iterator current = iter; ++iter;                                                                                                                                                                           \
+      for (auto iter = subscribers->mSubscribers.begin(); iter != subscribers->mSubscribers.end(); ++iter) {                                                                                                                                \
+        const Subscriber &subscriber = (*iter);                                                                                                                                                                                             \
+        if ((xQueued) && (subscriber.mQueue)) continue;                                                                                                                                                                                     \
         try {                                                                                                                                                                                                                               \
           bool filled = false;                                                                                                                                                                                                              \
           SubscriptionPtr result;                                                                                                                                                                                                           \
-          fillWithSubscription<t1>(v1, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t2>(v2, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t3>(v3, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t4>(v4, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t5>(v5, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t6>(v6, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t7>(v7, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t8>(v8, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t9>(v9, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t10>(v10, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t11>(v11, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t12>(v12, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t13>(v13, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t14>(v14, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t15>(v15, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t16>(v16, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t17>(v17, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t18>(v18, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t19>(v19, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t20>(v20, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t21>(v21, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t22>(v22, (*current).second.first, result, filled);                                                                                                                                                          \
-          if ((filled) && (!result)) {cancel((*current).first); continue;}                                                                                                                                                                  \
-          (*current).second.second->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17,v18,v19,v20,v21,v22);                                                                                                                \
+          fillWithSubscription<t1>(v1, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t2>(v2, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t3>(v3, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t4>(v4, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t5>(v5, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t6>(v6, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t7>(v7, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t8>(v8, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t9>(v9, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t10>(v10, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t11>(v11, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t12>(v12, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t13>(v13, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t14>(v14, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t15>(v15, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t16>(v16, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t17>(v17, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t18>(v18, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t19>(v19, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t20>(v20, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t21>(v21, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t22>(v22, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          if ((filled) && (!result)) {cancel(subscriber.mKey); continue;}                                                                                                                                                                   \
+          subscriber.mDelegate->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17,v18,v19,v20,v21,v22);                                                                                                                    \
         } catch(DelegateProxy::Exceptions::DelegateGone &) {                                                                                                                                                                                \
-          cancel((*current).first);                                                                                                                                                                                                         \
+          cancel(subscriber.mKey);                                                                                                                                                                                                          \
         }                                                                                                                                                                                                                                   \
       }                                                                                                                                                                                                                                     \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_23(xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21,t22,t23)                                                                         \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_23(xQueued,xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21,t22,t23)                                                                 \
     void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7, t8 v8, t9 v9, t10 v10, t11 v11, t12 v12, t13 v13, t14 v14, t15 v15, t16 v16, t17 v17, t18 v18, t19 v19, t20 v20, t21 v21, t22 v22, t23 v23) xConst xThrow override {      \
-      SubscriptionDelegateMapPtr subscription;                                                                                                                                                                                              \
-      {                                                                                                                                                                                                                                     \
-        AutoRecursiveLock lock(mLock);                                                                                                                                                                                                      \
-        subscription = mSubscriptions;                                                                                                                                                                                                      \
+      SubscribersPtr subscribers = getSubscribers();                                                                                                                                                                                        \
+      if ((xQueued) && (subscribers->mQueues.size() > 0)) {                                                                                                                                                                                 \
+        typedef internal::ProxySubscriptionsArguments<t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21,t22,t23> Arguments;                                                                                        \
+        std::shared_ptr<Arguments> arguments(make_shared<Arguments>(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17,v18,v19,v20,v21,v22,v23));                                                                                   \
+        postToQueues(subscribers, #xMethod, passesSubscription<t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21,t22,t23>(), [arguments](Delegate &delegate, SubscriptionPtr &subscription) {                      \
+          delegate.xMethod(                                                                                                                                                                                                                 \
+            subscriberArgument<t1>(std::get<0>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t2>(std::get<1>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t3>(std::get<2>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t4>(std::get<3>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t5>(std::get<4>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t6>(std::get<5>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t7>(std::get<6>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t8>(std::get<7>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t9>(std::get<8>(arguments->mValues), subscription),                                                                                                                                                          \
+            subscriberArgument<t10>(std::get<9>(arguments->mValues), subscription),                                                                                                                                                         \
+            subscriberArgument<t11>(std::get<10>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t12>(std::get<11>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t13>(std::get<12>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t14>(std::get<13>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t15>(std::get<14>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t16>(std::get<15>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t17>(std::get<16>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t18>(std::get<17>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t19>(std::get<18>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t20>(std::get<19>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t21>(std::get<20>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t22>(std::get<21>(arguments->mValues), subscription),                                                                                                                                                        \
+            subscriberArgument<t23>(std::get<22>(arguments->mValues), subscription)                                                                                                                                                         \
+          );                                                                                                                                                                                                                                \
+        });                                                                                                                                                                                                                                 \
       }                                                                                                                                                                                                                                     \
-      for (SubscriptionDelegateMap::iterator iter = subscription->begin(); iter != subscription->end(); ) {                                                                                                                                 \
-        SubscriptionDelegateMap::iterator current = iter; ++iter;                                                                                                                                                                           \
+      for (auto iter = subscribers->mSubscribers.begin(); iter != subscribers->mSubscribers.end(); ++iter) {                                                                                                                                \
+        const Subscriber &subscriber = (*iter);                                                                                                                                                                                             \
+        if ((xQueued) && (subscriber.mQueue)) continue;                                                                                                                                                                                     \
         try {                                                                                                                                                                                                                               \
           bool filled = false;                                                                                                                                                                                                              \
           SubscriptionPtr result;                                                                                                                                                                                                           \
-          fillWithSubscription<t1>(v1, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t2>(v2, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t3>(v3, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t4>(v4, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t5>(v5, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t6>(v6, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t7>(v7, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t8>(v8, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t9>(v9, (*current).second.first, result, filled);                                                                                                                                                            \
-          fillWithSubscription<t10>(v10, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t11>(v11, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t12>(v12, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t13>(v13, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t14>(v14, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t15>(v15, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t16>(v16, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t17>(v17, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t18>(v18, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t19>(v19, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t20>(v20, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t21>(v21, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t22>(v22, (*current).second.first, result, filled);                                                                                                                                                          \
-          fillWithSubscription<t23>(v23, (*current).second.first, result, filled);                                                                                                                                                          \
-          if ((filled) && (!result)) {cancel((*current).first); continue;}                                                                                                                                                                  \
-          (*current).second.second->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17,v18,v19,v20,v21,v22,v23);                                                                                                            \
+          fillWithSubscription<t1>(v1, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t2>(v2, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t3>(v3, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t4>(v4, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t5>(v5, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t6>(v6, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t7>(v7, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t8>(v8, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t9>(v9, subscriber.mSubscription, result, filled);                                                                                                                                                           \
+          fillWithSubscription<t10>(v10, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t11>(v11, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t12>(v12, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t13>(v13, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t14>(v14, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t15>(v15, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t16>(v16, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t17>(v17, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t18>(v18, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t19>(v19, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t20>(v20, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t21>(v21, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t22>(v22, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          fillWithSubscription<t23>(v23, subscriber.mSubscription, result, filled);                                                                                                                                                         \
+          if ((filled) && (!result)) {cancel(subscriber.mKey); continue;}                                                                                                                                                                   \
+          subscriber.mDelegate->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17,v18,v19,v20,v21,v22,v23);                                                                                                                \
         } catch(DelegateProxy::Exceptions::DelegateGone &) {                                                                                                                                                                                \
-          cancel((*current).first);                                                                                                                                                                                                         \
+          cancel(subscriber.mKey);                                                                                                                                                                                                          \
         }                                                                                                                                                                                                                                   \
       }                                                                                                                                                                                                                                     \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_24(xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21,t22,t23,t24)                                                                                     \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_24(xQueued,xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21,t22,t23,t24)                                                                             \
     void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7, t8 v8, t9 v9, t10 v10, t11 v11, t12 v12, t13 v13, t14 v14, t15 v15, t16 v16, t17 v17, t18 v18, t19 v19, t20 v20, t21 v21, t22 v22, t23 v23, t24 v24) xConst xThrow override {             \
-      SubscriptionDelegateMapPtr subscription;                                                                                                                                                                                                              \
-      {                                                                                                                                                                                                                                                     \
-        AutoRecursiveLock lock(mLock);                                                                                                                                                                                                                      \
-        subscription = mSubscriptions;                                                                                                                                                                                                                      \
+      SubscribersPtr subscribers = getSubscribers();                                                                                                                                                                                                        \
+      if ((xQueued) && (subscribers->mQueues.size() > 0)) {                                                                                                                                                                                                 \
+        typedef internal::ProxySubscriptionsArguments<t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21,t22,t23,t24> Arguments;                                                                                                    \
+        std::shared_ptr<Arguments> arguments(make_shared<Arguments>(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17,v18,v19,v20,v21,v22,v23,v24));                                                                                               \
+        postToQueues(subscribers, #xMethod, passesSubscription<t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21,t22,t23,t24>(), [arguments](Delegate &delegate, SubscriptionPtr &subscription) {                                  \
+          delegate.xMethod(                                                                                                                                                                                                                                 \
+            subscriberArgument<t1>(std::get<0>(arguments->mValues), subscription),                                                                                                                                                                          \
+            subscriberArgument<t2>(std::get<1>(arguments->mValues), subscription),                                                                                                                                                                          \
+            subscriberArgument<t3>(std::get<2>(arguments->mValues), subscription),                                                                                                                                                                          \
+            subscriberArgument<t4>(std::get<3>(arguments->mValues), subscription),                                                                                                                                                                          \
+            subscriberArgument<t5>(std::get<4>(arguments->mValues), subscription),                                                                                                                                                                          \
+            subscriberArgument<t6>(std::get<5>(arguments->mValues), subscription),                                                                                                                                                                          \
+            subscriberArgument<t7>(std::get<6>(arguments->mValues), subscription),                                                                                                                                                                          \
+            subscriberArgument<t8>(std::get<7>(arguments->mValues), subscription),                                                                                                                                                                          \
+            subscriberArgument<t9>(std::get<8>(arguments->mValues), subscription),                                                                                                                                                                          \
+            subscriberArgument<t10>(std::get<9>(arguments->mValues), subscription),                                                                                                                                                                         \
+            subscriberArgument<t11>(std::get<10>(arguments->mValues), subscription),                                                                                                                                                                        \
+            subscriberArgument<t12>(std::get<11>(arguments->mValues), subscription),                                                                                                                                                                        \
+            subscriberArgument<t13>(std::get<12>(arguments->mValues), subscription),                                                                                                                                                                        \
+            subscriberArgument<t14>(std::get<13>(arguments->mValues), subscription),                                                                                                                                                                        \
+            subscriberArgument<t15>(std::get<14>(arguments->mValues), subscription),                                                                                                                                                                        \
+            subscriberArgument<t16>(std::get<15>(arguments->mValues), subscription),                                                                                                                                                                        \
+            subscriberArgument<t17>(std::get<16>(arguments->mValues), subscription),                                                                                                                                                                        \
+            subscriberArgument<t18>(std::get<17>(arguments->mValues), subscription),                                                                                                                                                                        \
+            subscriberArgument<t19>(std::get<18>(arguments->mValues), subscription),                                                                                                                                                                        \
+            subscriberArgument<t20>(std::get<19>(arguments->mValues), subscription),                                                                                                                                                                        \
+            subscriberArgument<t21>(std::get<20>(arguments->mValues), subscription),                                                                                                                                                                        \
+            subscriberArgument<t22>(std::get<21>(arguments->mValues), subscription),                                                                                                                                                                        \
+            subscriberArgument<t23>(std::get<22>(arguments->mValues), subscription),                                                                                                                                                                        \
+            subscriberArgument<t24>(std::get<23>(arguments->mValues), subscription)                                                                                                                                                                         \
+          );                                                                                                                                                                                                                                                \
+        });                                                                                                                                                                                                                                                 \
       }                                                                                                                                                                                                                                                     \
-      for (SubscriptionDelegateMap::iterator iter = subscription->begin(); iter != subscription->end(); ) {                                                                                                                                                 \
-        SubscriptionDelegateMap::iterator current = iter; ++iter;                                                                                                                                                                                           \
+      for (auto iter = subscribers->mSubscribers.begin(); iter != subscribers->mSubscribers.end(); ++iter) {                                                                                                                                                \
+        const Subscriber &subscriber = (*iter);                                                                                                                                                                                                             \
+        if ((xQueued) && (subscriber.mQueue)) continue;                                                                                                                                                                                                     \
         try {                                                                                                                                                                                                                                               \
           bool filled = false;                                                                                                                                                                                                                              \
           SubscriptionPtr result;                                                                                                                                                                                                                           \
-          fillWithSubscription<t1>(v1, (*current).second.first, result, filled);                                                                                                                                                                            \
-          fillWithSubscription<t2>(v2, (*current).second.first, result, filled);                                                                                                                                                                            \
-          fillWithSubscription<t3>(v3, (*current).second.first, result, filled);                                                                                                                                                                            \
-          fillWithSubscription<t4>(v4, (*current).second.first, result, filled);                                                                                                                                                                            \
-          fillWithSubscription<t5>(v5, (*current).second.first, result, filled);                                                                                                                                                                            \
-          fillWithSubscription<t6>(v6, (*current).second.first, result, filled);                                                                                                                                                                            \
-          fillWithSubscription<t7>(v7, (*current).second.first, result, filled);                                                                                                                                                                            \
-          fillWithSubscription<t8>(v8, (*current).second.first, result, filled);                                                                                                                                                                            \
-          fillWithSubscription<t9>(v9, (*current).second.first, result, filled);                                                                                                                                                                            \
-          fillWithSubscription<t10>(v10, (*current).second.first, result, filled);                                                                                                                                                                          \
-          fillWithSubscription<t11>(v11, (*current).second.first, result, filled);                                                                                                                                                                          \
-          fillWithSubscription<t12>(v12, (*current).second.first, result, filled);                                                                                                                                                                          \
-          fillWithSubscription<t13>(v13, (*current).second.first, result, filled);                                                                                                                                                                          \
-          fillWithSubscription<t14>(v14, (*current).second.first, result, filled);                                                                                                                                                                          \
-          fillWithSubscription<t15>(v15, (*current).second.first, result, filled);                                                                                                                                                                          \
-          fillWithSubscription<t16>(v16, (*current).second.first, result, filled);                                                                                                                                                                          \
-          fillWithSubscription<t17>(v17, (*current).second.first, result, filled);                                                                                                                                                                          \
-          fillWithSubscription<t18>(v18, (*current).second.first, result, filled);                                                                                                                                                                          \
-          fillWithSubscription<t19>(v19, (*current).second.first, result, filled);                                                                                                                                                                          \
-          fillWithSubscription<t20>(v20, (*current).second.first, result, filled);                                                                                                                                                                          \
-          fillWithSubscription<t21>(v21, (*current).second.first, result, filled);                                                                                                                                                                          \
-          fillWithSubscription<t22>(v22, (*current).second.first, result, filled);                                                                                                                                                                          \
-          fillWithSubscription<t23>(v23, (*current).second.first, result, filled);                                                                                                                                                                          \
-          fillWithSubscription<t24>(v24, (*current).second.first, result, filled);                                                                                                                                                                          \
-          if ((filled) && (!result)) {cancel((*current).first); continue;}                                                                                                                                                                                  \
-          (*current).second.second->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17,v18,v19,v20,v21,v22,v23,v24);                                                                                                                        \
+          fillWithSubscription<t1>(v1, subscriber.mSubscription, result, filled);                                                                                                                                                                           \
+          fillWithSubscription<t2>(v2, subscriber.mSubscription, result, filled);                                                                                                                                                                           \
+          fillWithSubscription<t3>(v3, subscriber.mSubscription, result, filled);                                                                                                                                                                           \
+          fillWithSubscription<t4>(v4, subscriber.mSubscription, result, filled);                                                                                                                                                                           \
+          fillWithSubscription<t5>(v5, subscriber.mSubscription, result, filled);                                                                                                                                                                           \
+          fillWithSubscription<t6>(v6, subscriber.mSubscription, result, filled);                                                                                                                                                                           \
+          fillWithSubscription<t7>(v7, subscriber.mSubscription, result, filled);                                                                                                                                                                           \
+          fillWithSubscription<t8>(v8, subscriber.mSubscription, result, filled);                                                                                                                                                                           \
+          fillWithSubscription<t9>(v9, subscriber.mSubscription, result, filled);                                                                                                                                                                           \
+          fillWithSubscription<t10>(v10, subscriber.mSubscription, result, filled);                                                                                                                                                                         \
+          fillWithSubscription<t11>(v11, subscriber.mSubscription, result, filled);                                                                                                                                                                         \
+          fillWithSubscription<t12>(v12, subscriber.mSubscription, result, filled);                                                                                                                                                                         \
+          fillWithSubscription<t13>(v13, subscriber.mSubscription, result, filled);                                                                                                                                                                         \
+          fillWithSubscription<t14>(v14, subscriber.mSubscription, result, filled);                                                                                                                                                                         \
+          fillWithSubscription<t15>(v15, subscriber.mSubscription, result, filled);                                                                                                                                                                         \
+          fillWithSubscription<t16>(v16, subscriber.mSubscription, result, filled);                                                                                                                                                                         \
+          fillWithSubscription<t17>(v17, subscriber.mSubscription, result, filled);                                                                                                                                                                         \
+          fillWithSubscription<t18>(v18, subscriber.mSubscription, result, filled);                                                                                                                                                                         \
+          fillWithSubscription<t19>(v19, subscriber.mSubscription, result, filled);                                                                                                                                                                         \
+          fillWithSubscription<t20>(v20, subscriber.mSubscription, result, filled);                                                                                                                                                                         \
+          fillWithSubscription<t21>(v21, subscriber.mSubscription, result, filled);                                                                                                                                                                         \
+          fillWithSubscription<t22>(v22, subscriber.mSubscription, result, filled);                                                                                                                                                                         \
+          fillWithSubscription<t23>(v23, subscriber.mSubscription, result, filled);                                                                                                                                                                         \
+          fillWithSubscription<t24>(v24, subscriber.mSubscription, result, filled);                                                                                                                                                                         \
+          if ((filled) && (!result)) {cancel(subscriber.mKey); continue;}                                                                                                                                                                                   \
+          subscriber.mDelegate->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17,v18,v19,v20,v21,v22,v23,v24);                                                                                                                            \
         } catch(DelegateProxy::Exceptions::DelegateGone &) {                                                                                                                                                                                                \
-          cancel((*current).first);                                                                                                                                                                                                                         \
+          cancel(subscriber.mKey);                                                                                                                                                                                                                          \
         }                                                                                                                                                                                                                                                   \
       }                                                                                                                                                                                                                                                     \
     }
 
-#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_25(xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21,t22,t23,t24,t25)                                                                                 \
+#define ZS_INTERNAL_DECLARE_PROXY_SUBSCRIPTIONS_METHOD_25(xQueued,xConst,xThrow,xMethod,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21,t22,t23,t24,t25)                                                                         \
     void xMethod(t1 v1, t2 v2, t3 v3, t4 v4, t5 v5, t6 v6, t7 v7, t8 v8, t9 v9, t10 v10, t11 v11, t12 v12, t13 v13, t14 v14, t15 v15, t16 v16, t17 v17, t18 v18, t19 v19, t20 v20, t21 v21, t22 v22, t23 v23, t24 v24, t25 v25) xConst xThrow override {    \
-      SubscriptionDelegateMapPtr subscription;                                                                                                                                                                                                              \
-      {                                                                                                                                                                                                                                                     \
-        AutoRecursiveLock lock(mLock);                                                                                                                                                                                                                      \
-        subscription = mSubscriptions;                                                                                                                                                                                                                      \
+      SubscribersPtr subscribers = getSubscribers();                                                                                                                                                                                                        \
+      if ((xQueued) && (subscribers->mQueues.size() > 0)) {                                                                                                                                                                                                 \
+        typedef internal::ProxySubscriptionsArguments<t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21,t22,t23,t24,t25> Arguments;                                                                                                \
+        std::shared_ptr<Arguments> arguments(make_shared<Arguments>(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17,v18,v19,v20,v21,v22,v23,v24,v25));                                                                                           \
+        postToQueues(subscribers, #xMethod, passesSubscription<t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19,t20,t21,t22,t23,t24,t25>(), [arguments](Delegate &delegate, SubscriptionPtr &subscription) {                              \
+          delegate.xMethod(                                                                                                                                                                                                                                 \
+            subscriberArgument<t1>(std::get<0>(arguments->mValues), subscription),                                                                                                                                                                          \
+            subscriberArgument<t2>(std::get<1>(arguments->mValues), subscription),                                                                                                                                                                          \
+            subscriberArgument<t3>(std::get<2>(arguments->mValues), subscription),                                                                                                                                                                          \
+            subscriberArgument<t4>(std::get<3>(arguments->mValues), subscription),                                                                                                                                                                          \
+            subscriberArgument<t5>(std::get<4>(arguments->mValues), subscription),                                                                                                                                                                          \
+            subscriberArgument<t6>(std::get<5>(arguments->mValues), subscription),                                                                                                                                                                          \
+            subscriberArgument<t7>(std::get<6>(arguments->mValues), subscription),                                                                                                                                                                          \
+            subscriberArgument<t8>(std::get<7>(arguments->mValues), subscription),                                                                                                                                                                          \
+            subscriberArgument<t9>(std::get<8>(arguments->mValues), subscription),                                                                                                                                                                          \
+            subscriberArgument<t10>(std::get<9>(arguments->mValues), subscription),                                                                                                                                                                         \
+            subscriberArgument<t11>(std::get<10>(arguments->mValues), subscription),                                                                                                                                                                        \
+            subscriberArgument<t12>(std::get<11>(arguments->mValues), subscription),                                                                                                                                                                        \
+            subscriberArgument<t13>(std::get<12>(arguments->mValues), subscription),                                                                                                                                                                        \
+            subscriberArgument<t14>(std::get<13>(arguments->mValues), subscription),                                                                                                                                                                        \
+            subscriberArgument<t15>(std::get<14>(arguments->mValues), subscription),                                                                                                                                                                        \
+            subscriberArgument<t16>(std::get<15>(arguments->mValues), subscription),                                                                                                                                                                        \
+            subscriberArgument<t17>(std::get<16>(arguments->mValues), subscription),                                                                                                                                                                        \
+            subscriberArgument<t18>(std::get<17>(arguments->mValues), subscription),                                                                                                                                                                        \
+            subscriberArgument<t19>(std::get<18>(arguments->mValues), subscription),                                                                                                                                                                        \
+            subscriberArgument<t20>(std::get<19>(arguments->mValues), subscription),                                                                                                                                                                        \
+            subscriberArgument<t21>(std::get<20>(arguments->mValues), subscription),                                                                                                                                                                        \
+            subscriberArgument<t22>(std::get<21>(arguments->mValues), subscription),                                                                                                                                                                        \
+            subscriberArgument<t23>(std::get<22>(arguments->mValues), subscription),                                                                                                                                                                        \
+            subscriberArgument<t24>(std::get<23>(arguments->mValues), subscription),                                                                                                                                                                        \
+            subscriberArgument<t25>(std::get<24>(arguments->mValues), subscription)                                                                                                                                                                         \
+          );                                                                                                                                                                                                                                                \
+        });                                                                                                                                                                                                                                                 \
       }                                                                                                                                                                                                                                                     \
-      for (SubscriptionDelegateMap::iterator iter = subscription->begin(); iter != subscription->end(); ) {                                                                                                                                                 \
-        SubscriptionDelegateMap::iterator current = iter; ++iter;                                                                                                                                                                                           \
+      for (auto iter = subscribers->mSubscribers.begin(); iter != subscribers->mSubscribers.end(); ++iter) {                                                                                                                                                \
+        const Subscriber &subscriber = (*iter);                                                                                                                                                                                                             \
+        if ((xQueued) && (subscriber.mQueue)) continue;                                                                                                                                                                                                     \
         try {                                                                                                                                                                                                                                               \
           bool filled = false;                                                                                                                                                                                                                              \
           SubscriptionPtr result;                                                                                                                                                                                                                           \
-          fillWithSubscription<t1>(v1, (*current).second.first, result, filled);                                                                                                                                                                            \
-          fillWithSubscription<t2>(v2, (*current).second.first, result, filled);                                                                                                                                                                            \
-          fillWithSubscription<t3>(v3, (*current).second.first, result, filled);                                                                                                                                                                            \
-          fillWithSubscription<t4>(v4, (*current).second.first, result, filled);                                                                                                                                                                            \
-          fillWithSubscription<t5>(v5, (*current).second.first, result, filled);                                                                                                                                                                            \
-          fillWithSubscription<t6>(v6, (*current).second.first, result, filled);                                                                                                                                                                            \
-          fillWithSubscription<t7>(v7, (*current).second.first, result, filled);                                                                                                                                                                            \
-          fillWithSubscription<t8>(v8, (*current).second.first, result, filled);                                                                                                                                                                            \
-          fillWithSubscription<t9>(v9, (*current).second.first, result, filled);                                                                                                                                                                            \
-          fillWithSubscription<t10>(v10, (*current).second.first, result, filled);                                                                                                                                                                          \
-          fillWithSubscription<t11>(v11, (*current).second.first, result, filled);                                                                                                                                                                          \
-          fillWithSubscription<t12>(v12, (*current).second.first, result, filled);                                                                                                                                                                          \
-          fillWithSubscription<t13>(v13, (*current).second.first, result, filled);                                                                                                                                                                          \
-          fillWithSubscription<t14>(v14, (*current).second.first, result, filled);                                                                                                                                                                          \
-          fillWithSubscription<t15>(v15, (*current).second.first, result, filled);                                                                                                                                                                          \
-          fillWithSubscription<t16>(v16, (*current).second.first, result, filled);                                                                                                                                                                          \
-          fillWithSubscription<t17>(v17, (*current).second.first, result, filled);                                                                                                                                                                          \
-          fillWithSubscription<t18>(v18, (*current).second.first, result, filled);                                                                                                                                                                          \
-          fillWithSubscription<t19>(v19, (*current).second.first, result, filled);                                                                                                                                                                          \
-          fillWithSubscription<t20>(v20, (*current).second.first, result, filled);                                                                                                                                                                          \
-          fillWithSubscription<t21>(v21, (*current).second.first, result, filled);                                                                                                                                                                          \
-          fillWithSubscription<t22>(v22, (*current).second.first, result, filled);                                                                                                                                                                          \
-          fillWithSubscription<t23>(v23, (*current).second.first, result, filled);                                                                                                                                                                          \
-          fillWithSubscription<t24>(v24, (*current).second.first, result, filled);                                                                                                                                                                          \
-          fillWithSubscription<t25>(v25, (*current).second.first, result, filled);                                                                                                                                                                          \
-          if ((filled) && (!result)) {cancel((*current).first); continue;}                                                                                                                                                                                  \
-          (*current).second.second->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17,v18,v19,v20,v21,v22,v23,v24,v25);                                                                                                                    \
+          fillWithSubscription<t1>(v1, subscriber.mSubscription, result, filled);                                                                                                                                                                           \
+          fillWithSubscription<t2>(v2, subscriber.mSubscription, result, filled);                                                                                                                                                                           \
+          fillWithSubscription<t3>(v3, subscriber.mSubscription, result, filled);                                                                                                                                                                           \
+          fillWithSubscription<t4>(v4, subscriber.mSubscription, result, filled);                                                                                                                                                                           \
+          fillWithSubscription<t5>(v5, subscriber.mSubscription, result, filled);                                                                                                                                                                           \
+          fillWithSubscription<t6>(v6, subscriber.mSubscription, result, filled);                                                                                                                                                                           \
+          fillWithSubscription<t7>(v7, subscriber.mSubscription, result, filled);                                                                                                                                                                           \
+          fillWithSubscription<t8>(v8, subscriber.mSubscription, result, filled);                                                                                                                                                                           \
+          fillWithSubscription<t9>(v9, subscriber.mSubscription, result, filled);                                                                                                                                                                           \
+          fillWithSubscription<t10>(v10, subscriber.mSubscription, result, filled);                                                                                                                                                                         \
+          fillWithSubscription<t11>(v11, subscriber.mSubscription, result, filled);                                                                                                                                                                         \
+          fillWithSubscription<t12>(v12, subscriber.mSubscription, result, filled);                                                                                                                                                                         \
+          fillWithSubscription<t13>(v13, subscriber.mSubscription, result, filled);                                                                                                                                                                         \
+          fillWithSubscription<t14>(v14, subscriber.mSubscription, result, filled);                                                                                                                                                                         \
+          fillWithSubscription<t15>(v15, subscriber.mSubscription, result, filled);                                                                                                                                                                         \
+          fillWithSubscription<t16>(v16, subscriber.mSubscription, result, filled);                                                                                                                                                                         \
+          fillWithSubscription<t17>(v17, subscriber.mSubscription, result, filled);                                                                                                                                                                         \
+          fillWithSubscription<t18>(v18, subscriber.mSubscription, result, filled);                                                                                                                                                                         \
+          fillWithSubscription<t19>(v19, subscriber.mSubscription, result, filled);                                                                                                                                                                         \
+          fillWithSubscription<t20>(v20, subscriber.mSubscription, result, filled);                                                                                                                                                                         \
+          fillWithSubscription<t21>(v21, subscriber.mSubscription, result, filled);                                                                                                                                                                         \
+          fillWithSubscription<t22>(v22, subscriber.mSubscription, result, filled);                                                                                                                                                                         \
+          fillWithSubscription<t23>(v23, subscriber.mSubscription, result, filled);                                                                                                                                                                         \
+          fillWithSubscription<t24>(v24, subscriber.mSubscription, result, filled);                                                                                                                                                                         \
+          fillWithSubscription<t25>(v25, subscriber.mSubscription, result, filled);                                                                                                                                                                         \
+          if ((filled) && (!result)) {cancel(subscriber.mKey); continue;}                                                                                                                                                                                   \
+          subscriber.mDelegate->xMethod(v1,v2,v3,v4,v5,v6,v7,v8,v9,v10,v11,v12,v13,v14,v15,v16,v17,v18,v19,v20,v21,v22,v23,v24,v25);                                                                                                                        \
         } catch(DelegateProxy::Exceptions::DelegateGone &) {                                                                                                                                                                                                \
-          cancel((*current).first);                                                                                                                                                                                                                         \
+          cancel(subscriber.mKey);                                                                                                                                                                                                                          \
         }                                                                                                                                                                                                                                                   \
       }                                                                                                                                                                                                                                                     \
     }
@@ -37,12 +37,61 @@
 #include <zsLib/types.h>
 #include <zsLib/String.h>
 
+#include <atomic>
 #include <map>
 
 namespace zsLib
 {
   namespace internal
   {
+    //-------------------------------------------------------------------------
+    //-------------------------------------------------------------------------
+    //-------------------------------------------------------------------------
+    //-------------------------------------------------------------------------
+    //
+    // SingletonHazards
+    //
+
+    // Per thread hazard slots used by SingletonLazySharedPtr::Access. A reader
+    // publishes the raw object pointer in its own (thread local) slot, so no
+    // cache line is shared between readers, and the singleton's destruction
+    // waits until no slot holds the object any longer.
+    class SingletonHazards
+    {
+    public:
+      enum Sizes
+      {
+        Sizes_SlotsPerThread = 4,
+      };
+
+      struct Record
+      {
+        std::atomic<const void *> mSlots[Sizes_SlotsPerThread] {};
+        size_t mUsed {};
+
+        std::atomic<bool> mActive {};
+        Record *mNext {};
+      };
+
+      // returns NULL when the calling thread is exiting (or has no free slot
+      // left), in which case the caller has to fall back to a strong reference
+      static std::atomic<const void *> *acquireSlot() noexcept;
+      static void releaseSlot(std::atomic<const void *> *slot) noexcept;
+
+      // blocks until no other thread protects the object
+      static void waitUntilUnprotected(const void *object) noexcept;
+    };
+
+    //-------------------------------------------------------------------------
+    // shared state of a SingletonLazySharedPtr, kept in storage that is never
+    // destroyed so it remains readable during static destruction
+    template <typename T>
+    struct SingletonLazyState
+    {
+      std::weak_ptr<T> mWeak;
+      std::atomic<T *> mRaw {};
+    };
+
     //-------------------------------------------------------------------------
     //-------------------------------------------------------------------------
     //-------------------------------------------------------------------------
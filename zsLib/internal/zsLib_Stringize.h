@@ -46,6 +46,25 @@ namespace zsLib
   {
     String convert(ULONGLONG value, size_t base) noexcept;
 
+    // fast base 10 / floating point formatting shared by Stringize,
+    // Log::Param and the IHelper JSON number helpers
+    // NOTE: outBuffer must have room for at least 20 characters (no NUL is written)
+    size_t toChars(ULONGLONG value, char *outBuffer) noexcept;
+    size_t toChars(LONGLONG value, char *outBuffer) noexcept;
+
+    String convertDecimal(ULONGLONG value) noexcept;
+    String convertDecimal(LONGLONG value) noexcept;
+
+    template <typename t_type>
+    String convertDecimal(t_type value) noexcept
+    {
+      typedef typename std::conditional<std::is_signed<t_type>::value, LONGLONG, ULONGLONG>::type UseType;
+      return convertDecimal(static_cast<UseType>(value));
+    }
+
+    String convertFloat(float value) noexcept;      // shortest representation which parses back to the same value
+    String convertFloat(double value) noexcept;     // shortest representation which parses back to the same value
+
     String timeToString(const Time &value) noexcept;
 
     String durationToString(
@@ -72,7 +91,7 @@ namespace zsLib
         return durationToString(seconds, remainder.count(), duration_type::period::den);
       }
 
-      return std::to_string(value.count());
+      return convertDecimal(value.count());
     }
 
     void trimTrailingZeros(std::string &value) noexcept;
@@ -89,7 +108,7 @@ namespace zsLib
   inline Stringize<t_type>::operator String() const noexcept
   {
     if (10 == mBase)
-      return std::to_string(mValue);
+      return internal::convertDecimal(mValue);
 
     return internal::convert((ULONGLONG)mValue, mBase);
   }
@@ -110,7 +129,7 @@ namespace zsLib
   inline Stringize<CHAR>::operator String() const noexcept
   {
     if (10 == mBase)
-      return std::to_string((int)mValue);
+      return internal::convertDecimal(static_cast<LONGLONG>(mValue));
     return internal::convert((ULONGLONG)((UCHAR)mValue), mBase);
   }
 
@@ -118,7 +137,7 @@ namespace zsLib
   inline Stringize<UCHAR>::operator String() const noexcept
   {
     if (10 == mBase)
-      return std::to_string((UINT)mValue);
+      return internal::convertDecimal(static_cast<ULONGLONG>(mValue));
     return internal::convert((ULONGLONG)((UINT)mValue), mBase);
   }
 
@@ -126,7 +145,7 @@ namespace zsLib
   inline Stringize<SHORT>::operator String() const noexcept
   {
     if (10 == mBase)
-      return std::to_string((INT)mValue);
+      return internal::convertDecimal(static_cast<LONGLONG>(mValue));
     return internal::convert((ULONGLONG)((USHORT)mValue), mBase);
   }
 
@@ -134,7 +153,7 @@ namespace zsLib
   inline Stringize<USHORT>::operator String() const noexcept
   {
     if (10 == mBase)
-      return std::to_string((UINT)mValue);
+      return internal::convertDecimal(static_cast<ULONGLONG>(mValue));
     return internal::convert((ULONGLONG)mValue, mBase);
   }
 
@@ -142,7 +161,7 @@ namespace zsLib
   inline Stringize<INT>::operator String() const noexcept
   {
     if (10 == mBase)
-      return std::to_string(mValue);
+      return internal::convertDecimal(mValue);
     return internal::convert((ULONGLONG)((UINT)mValue), mBase);
   }
 
@@ -150,7 +169,7 @@ namespace zsLib
   inline Stringize<UINT>::operator String() const noexcept
   {
     if (10 == mBase)
-      return std::to_string(mValue);
+      return internal::convertDecimal(mValue);
     return internal::convert((ULONGLONG)mValue, mBase);
   }
 
@@ -158,7 +177,7 @@ namespace zsLib
   inline Stringize<LONG>::operator String() const noexcept
   {
     if (10 == mBase)
-      return std::to_string(mValue);
+      return internal::convertDecimal(mValue);
     return internal::convert((ULONGLONG)((ULONG)mValue), mBase);
   }
 
@@ -166,7 +185,7 @@ namespace zsLib
   inline Stringize<ULONG>::operator String() const noexcept
   {
     if (10 == mBase)
-      return std::to_string(mValue);
+      return internal::convertDecimal(mValue);
     return internal::convert((ULONGLONG)mValue, mBase);
   }
 
@@ -174,7 +193,7 @@ namespace zsLib
   inline Stringize<LONGLONG>::operator String() const noexcept
   {
     if (10 == mBase)
-      return std::to_string(mValue);
+      return internal::convertDecimal(mValue);
     return internal::convert((ULONGLONG)mValue, mBase);
   }
 
@@ -182,24 +201,20 @@ namespace zsLib
   inline Stringize<ULONGLONG>::operator String() const noexcept
   {
     if (10 == mBase)
-      return std::to_string(mValue);
+      return internal::convertDecimal(mValue);
     return internal::convert(mValue, mBase);
   }
 
   template<>
   inline Stringize<float>::operator String() const noexcept
   {
-    std::string result = std::to_string(mValue);
-    internal::trimTrailingZeros(result);
-    return result;
+    return internal::convertFloat(mValue);
   }
 
   template<>
   inline Stringize<double>::operator String() const noexcept
   {
-    std::string result = std::to_string(mValue);
-    internal::trimTrailingZeros(result);
-    return result;
+    return internal::convertFloat(mValue);
   }
 
   template<>
@@ -213,21 +228,20 @@ namespace zsLib
   template<>
   inline Stringize<UUID>::operator String() const noexcept
   {
-#ifndef _WIN32
-	char buffer[(sizeof(mValue)*3)+3];  // allow for 00-FF and '{', '}', '-' and nul at end
-	uuid_unparse_lower(mValue.mUUID, buffer);
-	return String((CSTR)buffer);
-#else
-	wchar_t buffer[(sizeof(mValue)*3)+3];
-	int result = StringFromGUID2(mValue.mUUID, &(buffer[0]), sizeof(buffer));
-  ZS_MAYBE_USED(result);
-  ZS_ASSERT(0 != result);
-  String output(buffer);
-  output.trimLeft("{");
-  output.trimRight("}");
-  output.toLower();
-	return output;
-#endif //_WIN32
+    static const char gHex[] = "0123456789abcdef";
+
+    UCHAR bytes[16];
+    mValue.getBytes(bytes);
+
+    char buffer[(sizeof(bytes)*2)+4+1];   // hex digits, 4 x '-' and nul at end
+    char *pos = &(buffer[0]);
+    for (size_t index = 0; index < sizeof(bytes); ++index) {
+      if ((4 == index) || (6 == index) || (8 == index) || (10 == index)) *(pos++) = '-';
+      *(pos++) = gHex[bytes[index] >> 4];
+      *(pos++) = gHex[bytes[index] & 0xF];
+    }
+    *pos = 0;
+    return String((CSTR)buffer);
   }
 
   template<>
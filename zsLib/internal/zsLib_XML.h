@@ -35,6 +35,7 @@
 #define ZSLIB_INTERNAL_XML_H_b78f79d54e0d6193bc57647097d8ce0e
 
 #include <list>
+#include <vector>
 
 #include <zsLib/types.h>
 #include <zsLib/String.h>
@@ -80,6 +81,7 @@ namespace zsLib
         friend class XML::Declaration;
         friend class XML::Unknown;
         friend class XML::Parser;
+        friend class XML::Path;
 
         friend class Document;
         friend class Element;
@@ -89,6 +91,7 @@ namespace zsLib
         friend class Declaration;
         friend class Unknown;
         friend class Parser;
+        friend class Path;
 
       protected:
         Node() noexcept;
@@ -155,6 +158,7 @@ namespace zsLib
       {
       protected:
         friend class XML::Attribute;
+        friend class Path;
 
       public:
         typedef std::list<AttributePtr> AttributeList;
@@ -263,6 +267,13 @@ namespace zsLib
                                 bool encode0xDCharactersInText = false
                                 ) const noexcept;
 
+        size_t writeValueInFormat(
+                                  char * &ioPos,
+                                  UINT format,
+                                  bool normalize = false,
+                                  bool encode0xDCharactersInText = false
+                                  ) const noexcept;
+
       protected:
         Text() noexcept;
         Text(const Text &) noexcept = delete;
@@ -444,6 +455,12 @@ namespace zsLib
         void addWarning(ParserWarningTypes inWarning) noexcept;
         void addWarning(ParserWarningTypes inWarning, const XML::ParserPos &inPos) noexcept;
 
+        // escape directly into an output buffer, when ioPos is NULL only the
+        // length of the escaped output is calculated
+        static size_t writeTextEntitySafe(char * &ioPos, CSTR inString, size_t inLength, bool entityEncode0xD) noexcept;
+        static size_t writeAttributeEntitySafe(char * &ioPos, CSTR inString, size_t inLength, bool escapeDoubleQuote, bool escapeSingleQuote) noexcept;
+        static size_t writeJSONEncoded(char * &ioPos, CSTR inString, size_t inLength) noexcept;
+
       protected:
         const NoChildrenElementList &getContainsNoChildrenElements() const noexcept {return mSingleElements;}
 
@@ -659,6 +676,54 @@ namespace zsLib
         JSONStrs &mStrs;
       };
 
+      //-----------------------------------------------------------------------
+      //-----------------------------------------------------------------------
+      //-----------------------------------------------------------------------
+      //-----------------------------------------------------------------------
+      class Path
+      {
+      protected:
+        struct make_private {};
+
+        struct Step
+        {
+          String mName;                     // empty for a wildcard step
+          String mNameLowerCase;            // used when element names are not case sensitive
+          size_t mIndex {SIZE_MAX};         // SIZE_MAX when every matching sibling is accepted
+        };
+        typedef std::vector<Step> StepVector;
+        typedef std::vector<const Path *> RawPathVector;
+        typedef std::vector<XML::Node *> RawNodeVector;
+
+      public:
+        Path() noexcept;
+        Path(const Path &) noexcept = delete;
+
+        ~Path() noexcept;
+
+      protected:
+        static bool parseIndex(CSTR inStart, CSTR inEnd, size_t &outIndex) noexcept;
+        void addStep(const String &inName, size_t inIndex) noexcept;
+
+        static bool stepMatches(
+                                const Step &inStep,
+                                const String &inElementName,
+                                bool inCaseSensative
+                                ) noexcept;
+
+        static void evaluate(
+                             const NodePtr &inContext,
+                             const RawPathVector &inPaths,
+                             bool inFirstOnly,
+                             RawNodeVector &outFirstResults,
+                             RawNodeVector *outAllResults
+                             ) noexcept;
+
+      protected:
+        String mPath;
+        StepVector mSteps;
+      };
+
     } // namespace internal
 
   } // namespace XML
@@ -275,6 +275,7 @@ namespace zsLib
     ZS_DECLARE_CLASS_PTR(Unknown);
     ZS_DECLARE_CLASS_PTR(Parser);
     ZS_DECLARE_CLASS_PTR(Generator);
+    ZS_DECLARE_CLASS_PTR(Path);
 
     class ParserPos;
     class ParserWarning;
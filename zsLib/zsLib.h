@@ -31,6 +31,7 @@
 
 #pragma once
 
+#include <zsLib/Coroutine.h>
 #include <zsLib/date.h>
 #include <zsLib/Event.h>
 #include <zsLib/Exception.h>
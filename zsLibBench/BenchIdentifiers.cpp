@@ -0,0 +1,162 @@
+/*
+
+ Copyright (c) 2014, Robin Raymond
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation
+ and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ The views and conclusions contained in the software and documentation are those
+ of the authors and should not be interpreted as representing official policies,
+ either expressed or implied, of the FreeBSD Project.
+
+ */
+
+#include <zsLib/helpers.h>
+#include <zsLib/Numeric.h>
+#include <zsLib/Stringize.h>
+
+#include "benchmark.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace bench_identifiers
+{
+  //---------------------------------------------------------------------------
+  // run the same body on several threads started at once
+  static void runThreads(Benchmark::Measure &measure, size_t totalThreads, std::function<void()> body)
+  {
+    std::atomic<size_t> ready {};
+    std::atomic<bool> go {};
+    std::vector<std::thread> threads;
+    for (size_t index = 0; index < totalThreads; ++index) {
+      threads.push_back(std::thread([&ready, &go, &body]() {
+        ++ready;
+        while (!go) std::this_thread::yield();
+        body();
+      }));
+    }
+
+    Benchmark::waitFor([&ready, totalThreads]() -> bool { return totalThreads == ready.load(); });
+    measure.start();
+    go = true;
+    for (auto iter = threads.begin(); iter != threads.end(); ++iter) {
+      (*iter).join();
+    }
+    measure.stop();
+  }
+
+  //---------------------------------------------------------------------------
+  static void benchPUID(size_t totalThreads)
+  {
+    size_t perThread = Benchmark::scaled(2000000);
+    std::string name = "puid.create.threads_" + std::to_string(totalThreads);
+
+    Benchmark::run(name.c_str(), perThread * totalThreads, [totalThreads, perThread](Benchmark::Measure &measure) {
+      std::atomic<size_t> failed {};
+      runThreads(measure, totalThreads, [perThread, &failed]() {
+        zsLib::PUID last = 0;
+        for (size_t loop = 0; loop < perThread; ++loop) {
+          zsLib::PUID id = zsLib::createPUID();
+          if (id <= last) ++failed;
+          last = id;
+        }
+      });
+      if (0 != failed) measure.setOperations(0);
+    });
+  }
+
+  //---------------------------------------------------------------------------
+  static void benchUUIDCreate()
+  {
+    size_t operations = Benchmark::scaled(200000);
+
+    Benchmark::run("uuid.create", operations, [operations](Benchmark::Measure &measure) {
+      size_t nonEmpty = 0;
+      for (size_t loop = 0; loop < operations; ++loop) {
+        zsLib::UUID uuid = zsLib::createUUID();
+        if (!(!uuid)) ++nonEmpty;
+      }
+      if (nonEmpty != operations) measure.setOperations(0);
+    });
+
+    Benchmark::run("uuid.create.time_ordered", operations, [operations](Benchmark::Measure &measure) {
+      zsLib::UUID last;
+      size_t ordered = 0;
+      for (size_t loop = 0; loop < operations; ++loop) {
+        zsLib::UUID uuid = zsLib::createTimeOrderedUUID();
+        if (last < uuid) ++ordered;
+        last = uuid;
+      }
+      if (ordered != operations) measure.setOperations(0);
+    });
+
+    Benchmark::run("uuid.create.bulk", operations, [operations](Benchmark::Measure &measure) {
+      std::vector<zsLib::UUID> uuids(operations);
+      measure.start();
+      zsLib::createUUIDs(&(uuids[0]), uuids.size());
+      measure.stop();
+      if (!uuids.back()) measure.setOperations(0);
+    });
+  }
+
+  //---------------------------------------------------------------------------
+  static void benchUUIDText()
+  {
+    size_t operations = Benchmark::scaled(200000);
+    zsLib::UUID uuid = zsLib::createUUID();
+    zsLib::String text = zsLib::string(uuid);
+
+    Benchmark::run("uuid.stringize", operations, [operations, uuid](Benchmark::Measure &measure) {
+      size_t length = 0;
+      for (size_t loop = 0; loop < operations; ++loop) {
+        length += zsLib::Stringize<zsLib::UUID>(uuid).string().length();
+      }
+      if (length != operations * 36) measure.setOperations(0);
+    });
+
+    Benchmark::run("uuid.numeric", operations, [operations, uuid, text](Benchmark::Measure &measure) {
+      size_t matched = 0;
+      for (size_t loop = 0; loop < operations; ++loop) {
+        zsLib::UUID parsed = zsLib::Numeric<zsLib::UUID>(text);
+        if (parsed == uuid) ++matched;
+      }
+      if (matched != operations) measure.setOperations(0);
+    });
+  }
+}
+
+//-----------------------------------------------------------------------------
+void benchIdentifiers()
+{
+  using namespace bench_identifiers;
+
+  size_t threads = std::thread::hardware_concurrency();
+  if (threads < 2) threads = 2;
+
+  benchPUID(1);
+  benchPUID(threads);
+
+  benchUUIDCreate();
+  benchUUIDText();
+}
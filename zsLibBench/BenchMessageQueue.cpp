@@ -0,0 +1,190 @@
+/*
+
+ Copyright (c) 2014, Robin Raymond
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation
+ and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ The views and conclusions contained in the software and documentation are those
+ of the authors and should not be interpreted as representing official policies,
+ either expressed or implied, of the FreeBSD Project.
+
+ */
+
+#include <zsLib/IMessageQueueThread.h>
+#include <zsLib/IMessageQueueThreadPool.h>
+
+#include "benchmark.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace bench_message_queue
+{
+  //---------------------------------------------------------------------------
+  static void postUnderProducers(size_t producers)
+  {
+    size_t perProducer = Benchmark::scaled(400000) / producers;
+    if (perProducer < 1) perProducer = 1;
+    size_t total = perProducer * producers;
+
+    std::string name = "messagequeue.post.producers_" + std::to_string(producers);
+
+    Benchmark::run(name.c_str(), total, [producers, perProducer, total](Benchmark::Measure &measure) {
+      zsLib::IMessageQueueThreadPtr thread = zsLib::IMessageQueueThread::createBasic("org.zsLib.bench.consumer");
+      std::atomic<size_t> processed {};
+
+      measure.start();
+
+      std::vector<std::thread> workers;
+      for (size_t index = 0; index < producers; ++index) {
+        workers.push_back(std::thread([&thread, &processed, perProducer]() {
+          for (size_t loop = 0; loop < perProducer; ++loop) {
+            thread->postClosure([&processed]() { ++processed; });
+          }
+        }));
+      }
+      for (auto iter = workers.begin(); iter != workers.end(); ++iter) {
+        (*iter).join();
+      }
+
+      Benchmark::waitFor([&processed, total]() -> bool { return processed.load() >= total; });
+
+      measure.stop();
+
+      thread->waitForShutdown();
+    });
+  }
+
+  //---------------------------------------------------------------------------
+  static void postBatches(size_t batchSize)
+  {
+    size_t batches = Benchmark::scaled(400000) / batchSize;
+    if (batches < 1) batches = 1;
+    size_t total = batches * batchSize;
+
+    std::string name = "messagequeue.post.batch_" + std::to_string(batchSize);
+
+    Benchmark::run(name.c_str(), total, [batchSize, batches, total](Benchmark::Measure &measure) {
+      zsLib::IMessageQueueThreadPtr thread = zsLib::IMessageQueueThread::createBasic("org.zsLib.bench.consumer");
+      std::atomic<size_t> processed {};
+
+      auto closure = [&processed]() { ++processed; };
+      std::vector<decltype(closure)> closures(batchSize, closure);
+
+      measure.start();
+      for (size_t loop = 0; loop < batches; ++loop) {
+        thread->postClosureBatch(closures.begin(), closures.end());
+      }
+
+      Benchmark::waitFor([&processed, total]() -> bool { return processed.load() >= total; });
+
+      measure.stop();
+
+      thread->waitForShutdown();
+    });
+  }
+
+  //---------------------------------------------------------------------------
+  static void pingPong()
+  {
+    size_t total = Benchmark::scaled(100000);
+
+    Benchmark::run("messagequeue.pingpong", total, [total](Benchmark::Measure &measure) {
+      zsLib::IMessageQueueThreadPtr threadA = zsLib::IMessageQueueThread::createBasic("org.zsLib.bench.ping");
+      zsLib::IMessageQueueThreadPtr threadB = zsLib::IMessageQueueThread::createBasic("org.zsLib.bench.pong");
+
+      std::atomic<size_t> remaining {total};
+      std::function<void()> ping;
+      std::function<void()> pong;
+
+      ping = [&]() {
+        if (0 == --remaining) return;
+        threadB->postClosure([&pong]() { pong(); });
+      };
+      pong = [&]() {
+        threadA->postClosure([&ping]() { ping(); });
+      };
+
+      measure.start();
+      threadA->postClosure([&ping]() { ping(); });
+      Benchmark::waitFor([&remaining]() -> bool { return 0 == remaining.load(); });
+      measure.stop();
+
+      threadA->waitForShutdown();
+      threadB->waitForShutdown();
+    });
+  }
+}
+
+//-----------------------------------------------------------------------------
+void benchMessageQueue()
+{
+  bench_message_queue::postUnderProducers(1);
+  bench_message_queue::postUnderProducers(2);
+  bench_message_queue::postUnderProducers(4);
+  bench_message_queue::postUnderProducers(8);
+  bench_message_queue::postBatches(16);
+  bench_message_queue::postBatches(256);
+  bench_message_queue::pingPong();
+}
+
+//-----------------------------------------------------------------------------
+void benchThreadPool()
+{
+  size_t threads = std::thread::hardware_concurrency();
+  if (threads < 2) threads = 2;
+
+  const size_t totalQueues = 64;
+  size_t perQueue = Benchmark::scaled(400000) / totalQueues;
+  if (perQueue < 1) perQueue = 1;
+  size_t total = perQueue * totalQueues;
+
+  std::string name = "threadpool.fanout.queues_" + std::to_string(totalQueues) + ".threads_" + std::to_string(threads);
+
+  Benchmark::run(name.c_str(), total, [threads, totalQueues, perQueue, total](Benchmark::Measure &measure) {
+    zsLib::IMessageQueueThreadPoolPtr pool = zsLib::IMessageQueueThreadPool::create();
+    for (size_t index = 0; index < threads; ++index) {
+      pool->createThread("org.zsLib.bench.pool");
+    }
+
+    std::vector<zsLib::IMessageQueuePtr> queues;
+    for (size_t index = 0; index < totalQueues; ++index) {
+      queues.push_back(pool->createQueue());
+    }
+
+    std::atomic<size_t> processed {};
+
+    measure.start();
+    for (size_t loop = 0; loop < perQueue; ++loop) {
+      for (auto iter = queues.begin(); iter != queues.end(); ++iter) {
+        (*iter)->postClosure([&processed]() { ++processed; });
+      }
+    }
+    Benchmark::waitFor([&processed, total]() -> bool { return processed.load() >= total; });
+    measure.stop();
+
+    queues.clear();
+    pool->waitForShutdown();
+  });
+}
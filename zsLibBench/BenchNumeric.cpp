@@ -0,0 +1,112 @@
+/*
+
+ Copyright (c) 2014, Robin Raymond
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation
+ and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ The views and conclusions contained in the software and documentation are those
+ of the authors and should not be interpreted as representing official policies,
+ either expressed or implied, of the FreeBSD Project.
+
+ */
+
+#include <zsLib/Numeric.h>
+#include <zsLib/Stringize.h>
+
+#include "benchmark.h"
+
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+namespace bench_numeric
+{
+  static volatile double gSink {};    // keeps the parse loops from being optimized away
+
+  //---------------------------------------------------------------------------
+  // Numeric / Stringize against the iostream conversions they replace
+  template <typename t_type>
+  static void benchType(const char *typeName, const char *sample)
+  {
+    // streams treat CHAR/UCHAR as characters so compare against a wider type
+    typedef typename std::conditional<std::is_floating_point<t_type>::value, double, typename std::conditional<std::is_signed<t_type>::value, long long, unsigned long long>::type>::type StreamType;
+
+    size_t conversions = Benchmark::scaled(1000000);
+    std::string prefix = std::string("numeric.") + typeName;
+
+    Benchmark::run((prefix + ".parse.numeric").c_str(), conversions, [conversions, sample](Benchmark::Measure &) {
+      t_type total {};
+      for (size_t loop = 0; loop < conversions; ++loop) {
+        total += static_cast<t_type>(zsLib::Numeric<t_type>(sample));
+      }
+      gSink = static_cast<double>(total);
+    });
+
+    Benchmark::run((prefix + ".parse.stream").c_str(), conversions, [conversions, sample](Benchmark::Measure &) {
+      t_type total {};
+      for (size_t loop = 0; loop < conversions; ++loop) {
+        std::istringstream stream(sample);
+        StreamType value {};
+        stream >> value;
+        total += static_cast<t_type>(value);
+      }
+      gSink = static_cast<double>(total);
+    });
+
+    t_type value = static_cast<t_type>(zsLib::Numeric<t_type>(sample));
+
+    Benchmark::run((prefix + ".format.stringize").c_str(), conversions, [conversions, value](Benchmark::Measure &measure) {
+      size_t length = 0;
+      for (size_t loop = 0; loop < conversions; ++loop) {
+        length += zsLib::string(value).length();
+      }
+      if (0 == length) measure.setOperations(0);
+    });
+
+    Benchmark::run((prefix + ".format.stream").c_str(), conversions, [conversions, value](Benchmark::Measure &measure) {
+      size_t length = 0;
+      for (size_t loop = 0; loop < conversions; ++loop) {
+        std::ostringstream stream;
+        stream << static_cast<StreamType>(value);
+        length += stream.str().length();
+      }
+      if (0 == length) measure.setOperations(0);
+    });
+  }
+}
+
+//-----------------------------------------------------------------------------
+void benchNumeric()
+{
+  using namespace bench_numeric;
+
+  benchType<zsLib::CHAR>("char", "-100");
+  benchType<zsLib::UCHAR>("uchar", "200");
+  benchType<zsLib::SHORT>("short", "-31234");
+  benchType<zsLib::USHORT>("ushort", "61234");
+  benchType<zsLib::INT>("int", "-2012345678");
+  benchType<zsLib::UINT>("uint", "4012345678");
+  benchType<zsLib::LONGLONG>("longlong", "-9012345678901234567");
+  benchType<zsLib::ULONGLONG>("ulonglong", "18012345678901234567");
+  benchType<zsLib::FLOAT>("float", "3.14159");
+  benchType<zsLib::DOUBLE>("double", "123456.78901234");
+}
@@ -0,0 +1,130 @@
+/*
+
+ Copyright (c) 2014, Robin Raymond
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation
+ and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ The views and conclusions contained in the software and documentation are those
+ of the authors and should not be interpreted as representing official policies,
+ either expressed or implied, of the FreeBSD Project.
+
+ */
+
+#include <zsLib/Promise.h>
+#include <zsLib/IMessageQueueThread.h>
+
+#include "benchmark.h"
+
+#include <string>
+
+namespace bench_promise
+{
+  //---------------------------------------------------------------------------
+  // settle every input (from the queue thread) and wait for the combined promise
+  static void benchCombinator(const char *kind, size_t inputs, bool preSettled)
+  {
+    std::string name = std::string("promise.") + kind + ".inputs_" + std::to_string(inputs) + (preSettled ? ".settled" : ".pending");
+
+    Benchmark::run(name.c_str(), inputs, [kind, inputs, preSettled](Benchmark::Measure &measure) {
+      zsLib::IMessageQueueThreadPtr thread = zsLib::IMessageQueueThread::createBasic("org.zsLib.bench.promise");
+
+      zsLib::Promise::PromiseList promises;
+      for (size_t index = 0; index < inputs; ++index) {
+        zsLib::PromisePtr promise = zsLib::Promise::create(thread);
+        if (preSettled) promise->resolve();
+        promises.push_back(promise);
+      }
+
+      measure.start();
+      zsLib::PromisePtr combined;
+      if ("all" == std::string(kind)) {
+        combined = zsLib::Promise::all(promises, thread);
+      } else if ("allSettled" == std::string(kind)) {
+        combined = zsLib::Promise::allSettled(promises, thread);
+      } else {
+        combined = zsLib::Promise::race(promises, thread);
+      }
+      if (!preSettled) {
+        thread->postClosure([promises]() {
+          for (auto iter = promises.begin(); iter != promises.end(); ++iter) {
+            (*iter)->resolve();
+          }
+        });
+      }
+      Benchmark::waitFor([&combined]() -> bool { return combined->isSettled(); });
+      measure.stop();
+
+      if (!combined->isResolved()) measure.setOperations(0);
+
+      combined.reset();
+      promises.clear();
+      Benchmark::waitFor([&thread]() -> bool { return 0 == thread->getTotalUnprocessedMessages(); });
+      thread->waitForShutdown();
+    });
+  }
+
+  //---------------------------------------------------------------------------
+  // create, resolve and read back an int either boxed into an AnyPtr or
+  // stored inline by PromiseOf<>
+  static void benchResolve(bool inlineValue)
+  {
+    size_t operations = Benchmark::scaled(200000);
+
+    Benchmark::run((inlineValue ? "promise.resolve.inline" : "promise.resolve.boxed"), operations, [inlineValue, operations](Benchmark::Measure &measure) {
+      typedef zsLib::AnyHolder<int> IntHolder;
+      typedef zsLib::PromiseOf<int> IntPromise;
+
+      size_t total = 0;
+      for (size_t index = 0; index < operations; ++index) {
+        if (inlineValue) {
+          IntPromise::PromiseOfTypePtr promise = IntPromise::create();
+          promise->resolve(static_cast<int>(index));
+          total += static_cast<size_t>(*(promise->value()));
+          continue;
+        }
+
+        zsLib::PromisePtr promise = zsLib::Promise::create();
+        auto value = std::make_shared<IntHolder>();
+        value->value_ = static_cast<int>(index);
+        promise->resolve(value);
+        total += static_cast<size_t>(promise->value<IntHolder>()->value_);
+      }
+      if (total != (operations * (operations - 1)) / 2) measure.setOperations(0);
+    });
+  }
+}
+
+//-----------------------------------------------------------------------------
+void benchPromise()
+{
+  using namespace bench_promise;
+
+  size_t inputs = Benchmark::scaled(20000);
+
+  benchCombinator("all", inputs, false);
+  benchCombinator("all", inputs, true);
+  benchCombinator("allSettled", inputs, false);
+  benchCombinator("race", inputs, false);
+
+  benchResolve(false);
+  benchResolve(true);
+}
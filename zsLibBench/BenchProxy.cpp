@@ -0,0 +1,307 @@
+/*
+
+ Copyright (c) 2014, Robin Raymond
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation
+ and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ The views and conclusions contained in the software and documentation are those
+ of the authors and should not be interpreted as representing official policies,
+ either expressed or implied, of the FreeBSD Project.
+
+ */
+
+#define ZS_DECLARE_TEMPLATE_GENERATE_IMPLEMENTATION
+
+#include <zsLib/Proxy.h>
+#include <zsLib/ProxySubscriptions.h>
+#include <zsLib/IMessageQueueThread.h>
+#include <zsLib/ISettings.h>
+
+#include "benchmark.h"
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+namespace bench_proxy
+{
+  ZS_DECLARE_INTERACTION_PTR(IBenchPingDelegate)
+
+  interaction IBenchPingDelegate
+  {
+    virtual void onPing(size_t remaining) = 0;
+    virtual size_t onAdd(size_t value1, size_t value2) noexcept = 0;
+  };
+
+  ZS_DECLARE_INTERACTION_PROXY(IBenchPingDelegate)
+
+  ZS_DECLARE_INTERACTION_PTR(IBenchEventDelegate)
+
+  interaction IBenchEventDelegate
+  {
+    virtual void onEvent(size_t value) = 0;
+  };
+
+  interaction IBenchEventSubscription
+  {
+    virtual zsLib::PUID getID() const noexcept = 0;
+    virtual void cancel() noexcept = 0;
+    virtual void background() noexcept = 0;
+  };
+
+  ZS_DECLARE_INTERACTION_PROXY(IBenchEventDelegate)
+  ZS_DECLARE_INTERACTION_PROXY_SUBSCRIPTION(IBenchEventSubscription, IBenchEventDelegate)
+}
+
+ZS_DECLARE_PROXY_BEGIN(bench_proxy::IBenchPingDelegate)
+ZS_DECLARE_PROXY_METHOD(onPing, size_t)
+ZS_DECLARE_PROXY_METHOD_SYNC_RETURN(onAdd, size_t, size_t, size_t)
+ZS_DECLARE_PROXY_END()
+
+ZS_DECLARE_PROXY_BEGIN(bench_proxy::IBenchEventDelegate)
+ZS_DECLARE_PROXY_METHOD(onEvent, size_t)
+ZS_DECLARE_PROXY_END()
+
+ZS_DECLARE_PROXY_SUBSCRIPTIONS_BEGIN(bench_proxy::IBenchEventDelegate, bench_proxy::IBenchEventSubscription)
+ZS_DECLARE_PROXY_SUBSCRIPTIONS_METHOD(onEvent, size_t)
+ZS_DECLARE_PROXY_SUBSCRIPTIONS_END()
+
+namespace bench_proxy
+{
+  ZS_DECLARE_CLASS_PTR(BenchPing)
+
+  class BenchPing : public IBenchPingDelegate,
+                    public zsLib::MessageQueueAssociator
+  {
+  private:
+    BenchPing(zsLib::IMessageQueuePtr queue, std::atomic<size_t> &remaining) :
+      zsLib::MessageQueueAssociator(queue),
+      mRemaining(remaining)
+    {
+    }
+
+  public:
+    static BenchPingPtr create(zsLib::IMessageQueuePtr queue, std::atomic<size_t> &remaining)
+    {
+      return BenchPingPtr(new BenchPing(queue, remaining));
+    }
+
+    void setPeer(IBenchPingDelegatePtr peer) {mPeer = peer;}
+
+    virtual void onPing(size_t remaining)
+    {
+      mRemaining = remaining;
+      if (0 == remaining) return;
+
+      IBenchPingDelegatePtr peer = mPeer;
+      if (peer) peer->onPing(remaining - 1);
+    }
+
+    virtual size_t onAdd(size_t value1, size_t value2) noexcept
+    {
+      return value1 + value2;
+    }
+
+  private:
+    std::atomic<size_t> &mRemaining;
+    IBenchPingDelegatePtr mPeer;
+  };
+
+  ZS_DECLARE_CLASS_PTR(BenchEventCounter)
+
+  class BenchEventCounter : public IBenchEventDelegate,
+                            public zsLib::MessageQueueAssociator
+  {
+  private:
+    BenchEventCounter(zsLib::IMessageQueuePtr queue, std::atomic<size_t> &received) :
+      zsLib::MessageQueueAssociator(queue),
+      mReceived(received)
+    {
+    }
+
+  public:
+    static BenchEventCounterPtr create(zsLib::IMessageQueuePtr queue, std::atomic<size_t> &received)
+    {
+      return BenchEventCounterPtr(new BenchEventCounter(queue, received));
+    }
+
+    virtual void onEvent(size_t value)
+    {
+      ++mReceived;
+    }
+
+  private:
+    std::atomic<size_t> &mReceived;
+  };
+
+  //---------------------------------------------------------------------------
+  // one event delivered to many subscribers spread over a few queues
+  static void subscriptionsFanout(size_t totalSubscribers, size_t totalThreads)
+  {
+    size_t events = Benchmark::scaled(400000) / totalSubscribers;
+    if (events < 1) events = 1;
+    size_t total = events * totalSubscribers;
+
+    std::string name = "proxy.subscriptions.fanout.subscribers_" + std::to_string(totalSubscribers) + ".queues_" + std::to_string(totalThreads);
+
+    Benchmark::run(name.c_str(), total, [totalSubscribers, totalThreads, events, total](Benchmark::Measure &measure) {
+      std::vector<zsLib::IMessageQueueThreadPtr> threads;
+      for (size_t index = 0; index < totalThreads; ++index) {
+        threads.push_back(zsLib::IMessageQueueThread::createBasic("org.zsLib.bench.proxy.fanout"));
+      }
+
+      std::atomic<size_t> received {};
+      IBenchEventDelegateSubscriptions subscriptions;
+      std::vector<BenchEventCounterPtr> counters;
+      std::vector<IBenchEventSubscriptionPtr> subscribed;
+      for (size_t index = 0; index < totalSubscribers; ++index) {
+        counters.push_back(BenchEventCounter::create(threads[index % totalThreads], received));
+        subscribed.push_back(subscriptions.subscribe(counters.back()));
+      }
+
+      measure.start();
+      for (size_t loop = 0; loop < events; ++loop) {
+        subscriptions.delegate()->onEvent(loop);
+      }
+      Benchmark::waitFor([&received, total]() -> bool { return received.load() >= total; });
+      measure.stop();
+
+      subscribed.clear();
+      for (auto iter = threads.begin(); iter != threads.end(); ++iter) {
+        (*iter)->waitForShutdown();
+      }
+    });
+  }
+}
+
+//-----------------------------------------------------------------------------
+void benchProxy()
+{
+  using namespace bench_proxy;
+
+  size_t roundTrips = Benchmark::scaled(100000);
+
+  Benchmark::run("proxy.async.roundtrip", roundTrips, [roundTrips](Benchmark::Measure &measure) {
+    zsLib::IMessageQueueThreadPtr threadA = zsLib::IMessageQueueThread::createBasic("org.zsLib.bench.proxy.a");
+    zsLib::IMessageQueueThreadPtr threadB = zsLib::IMessageQueueThread::createBasic("org.zsLib.bench.proxy.b");
+
+    std::atomic<size_t> remaining {roundTrips * 2};
+
+    BenchPingPtr objectA = BenchPing::create(threadA, remaining);
+    BenchPingPtr objectB = BenchPing::create(threadB, remaining);
+
+    objectA->setPeer(IBenchPingDelegateProxy::create(objectB));
+    objectB->setPeer(IBenchPingDelegateProxy::create(objectA));
+
+    IBenchPingDelegatePtr start = IBenchPingDelegateProxy::create(objectA);
+
+    measure.start();
+    start->onPing(roundTrips * 2);
+    Benchmark::waitFor([&remaining]() -> bool { return 0 == remaining.load(); });
+    measure.stop();
+
+    objectA->setPeer(IBenchPingDelegatePtr());
+    objectB->setPeer(IBenchPingDelegatePtr());
+    start.reset();
+
+    Benchmark::waitFor([&threadA, &threadB]() -> bool { return (0 == threadA->getTotalUnprocessedMessages()) && (0 == threadB->getTotalUnprocessedMessages()); });
+    threadA->waitForShutdown();
+    threadB->waitForShutdown();
+  });
+
+  size_t calls = Benchmark::scaled(2000000);
+
+  Benchmark::run("proxy.sync.call", calls, [calls](Benchmark::Measure &measure) {
+    zsLib::IMessageQueueThreadPtr thread = zsLib::IMessageQueueThread::createBasic("org.zsLib.bench.proxy.sync");
+    std::atomic<size_t> remaining {};
+
+    BenchPingPtr object = BenchPing::create(thread, remaining);
+    IBenchPingDelegatePtr proxy = IBenchPingDelegateProxy::create(object);
+
+    size_t total = 0;
+    measure.start();
+    for (size_t loop = 0; loop < calls; ++loop) {
+      total = proxy->onAdd(total, 1);
+    }
+    measure.stop();
+
+    if (total != calls) measure.setOperations(0);
+
+    proxy.reset();
+    thread->waitForShutdown();
+  });
+
+  size_t sameQueueCalls = Benchmark::scaled(1000000);
+
+  for (int direct = 0; direct < 2; ++direct) {
+    // calls made from the delegate's own queue thread
+    Benchmark::run((0 != direct ? "proxy.async.same_queue.direct" : "proxy.async.same_queue.posted"), sameQueueCalls, [sameQueueCalls, direct](Benchmark::Measure &measure) {
+      zsLib::IMessageQueueThreadPtr thread = zsLib::IMessageQueueThread::createBasic("org.zsLib.bench.proxy.same");
+      std::atomic<size_t> remaining {};
+
+      BenchPingPtr object = BenchPing::create(thread, remaining);
+      IBenchPingDelegatePtr proxy = (0 != direct ? IBenchPingDelegateProxy::createDirectWhenSameQueue(object) : IBenchPingDelegateProxy::create(object));
+
+      measure.start();
+      thread->postClosure([proxy, sameQueueCalls]() {
+        for (size_t loop = 1; loop <= sameQueueCalls; ++loop) {
+          proxy->onPing(loop);
+        }
+      });
+      Benchmark::waitFor([&remaining, sameQueueCalls]() -> bool { return sameQueueCalls == remaining.load(); });
+      measure.stop();
+
+      proxy.reset();
+      Benchmark::waitFor([&thread]() -> bool { return 0 == thread->getTotalUnprocessedMessages(); });
+      thread->waitForShutdown();
+    });
+  }
+
+  size_t creates = Benchmark::scaled(1000000);
+
+  for (int census = 0; census < 2; ++census) {
+    // proxy construction / destruction cost with the call-site census off and on
+    Benchmark::run((0 != census ? "proxy.create.census_on" : "proxy.create.census_off"), creates, [creates, census](Benchmark::Measure &measure) {
+      zsLib::IMessageQueueThreadPtr thread = zsLib::IMessageQueueThread::createBasic("org.zsLib.bench.proxy.create");
+      std::atomic<size_t> remaining {};
+
+      BenchPingPtr object = BenchPing::create(thread, remaining);
+
+      zsLib::ISettings::setBool(ZSLIB_SETTING_PROXY_CENSUS, 0 != census);
+      zsLib::proxyCensus();
+
+      measure.start();
+      for (size_t loop = 0; loop < creates; ++loop) {
+        IBenchPingDelegatePtr proxy = IBenchPingDelegateProxy::create(object);
+      }
+      measure.stop();
+
+      zsLib::ISettings::setBool(ZSLIB_SETTING_PROXY_CENSUS, false);
+      zsLib::proxyCensus();
+
+      thread->waitForShutdown();
+    });
+  }
+
+  subscriptionsFanout(500, 4);
+  subscriptionsFanout(16, 4);
+}
@@ -0,0 +1,105 @@
+/*
+
+ Copyright (c) 2014, Robin Raymond
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation
+ and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ The views and conclusions contained in the software and documentation are those
+ of the authors and should not be interpreted as representing official policies,
+ either expressed or implied, of the FreeBSD Project.
+
+ */
+
+#include <zsLib/Singleton.h>
+
+#include "benchmark.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace bench_singleton
+{
+  struct Counter
+  {
+    std::atomic<size_t> mTotal {};
+  };
+
+  typedef zsLib::SingletonLazySharedPtr<Counter> CounterSingleton;
+
+  //---------------------------------------------------------------------------
+  // every thread repeatedly fetches the singleton either as a strong pointer
+  // (reference count traffic on one shared cache line) or as scoped access
+  static void benchFetch(bool scoped, size_t totalThreads)
+  {
+    size_t perThread = Benchmark::scaled(1000000);
+    std::string name = std::string("singleton.") + (scoped ? "access" : "shared_ptr") + ".threads_" + std::to_string(totalThreads);
+
+    Benchmark::run(name.c_str(), perThread * totalThreads, [scoped, totalThreads, perThread](Benchmark::Measure &measure) {
+      CounterSingleton singleton(std::make_shared<Counter>());
+
+      std::atomic<size_t> ready {};
+      std::atomic<bool> go {};
+      std::vector<std::thread> threads;
+      for (size_t index = 0; index < totalThreads; ++index) {
+        threads.push_back(std::thread([&singleton, &ready, &go, scoped, perThread]() {
+          size_t found = 0;
+          ++ready;
+          while (!go) std::this_thread::yield();
+          for (size_t loop = 0; loop < perThread; ++loop) {
+            if (scoped) {
+              CounterSingleton::Access access(singleton);
+              if (access) ++found;
+              continue;
+            }
+            if (singleton.singleton()) ++found;
+          }
+          singleton.singleton()->mTotal += found;
+        }));
+      }
+
+      Benchmark::waitFor([&ready, totalThreads]() -> bool { return totalThreads == ready.load(); });
+      measure.start();
+      go = true;
+      for (auto iter = threads.begin(); iter != threads.end(); ++iter) {
+        (*iter).join();
+      }
+      measure.stop();
+
+      if (singleton.singleton()->mTotal != perThread * totalThreads) measure.setOperations(0);
+    });
+  }
+}
+
+//-----------------------------------------------------------------------------
+void benchSingleton()
+{
+  using namespace bench_singleton;
+
+  size_t threads = std::thread::hardware_concurrency();
+  if (threads < 2) threads = 2;
+
+  benchFetch(false, 1);
+  benchFetch(true, 1);
+  benchFetch(false, threads);
+  benchFetch(true, threads);
+}
@@ -0,0 +1,229 @@
+/*
+
+ Copyright (c) 2014, Robin Raymond
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation
+ and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ The views and conclusions contained in the software and documentation are those
+ of the authors and should not be interpreted as representing official policies,
+ either expressed or implied, of the FreeBSD Project.
+
+ */
+
+#include <zsLib/Socket.h>
+#include <zsLib/IPAddress.h>
+#include <zsLib/IMessageQueueThread.h>
+
+#include "benchmark.h"
+
+#include <atomic>
+
+namespace bench_socket
+{
+  static const size_t kMessageSize = 64;
+
+  ZS_DECLARE_CLASS_PTR(EchoPeer)
+
+  //---------------------------------------------------------------------------
+  // echoes everything it receives (server) or sends the next message once the
+  // previous one came back (client), one message in flight at a time
+  class EchoPeer : public zsLib::MessageQueueAssociator,
+                   public zsLib::ISocketDelegate
+  {
+  private:
+    EchoPeer(zsLib::IMessageQueuePtr queue, bool isClient, size_t messages) :
+      zsLib::MessageQueueAssociator(queue),
+      mIsClient(isClient),
+      mRemaining(messages)
+    {
+    }
+
+  public:
+    static EchoPeerPtr create(zsLib::IMessageQueuePtr queue, bool isClient, size_t messages = 0)
+    {
+      EchoPeerPtr pThis(new EchoPeer(queue, isClient, messages));
+      pThis->mThisWeak = pThis;
+      return pThis;
+    }
+
+    void attach(zsLib::SocketPtr socket)
+    {
+      mSocket = socket;
+      socket->setOptionFlag(zsLib::Socket::SetOptionFlag::NonBlocking, true);
+      socket->setDelegate(mThisWeak.lock());
+    }
+
+    void setRemote(const zsLib::IPAddress &remote) {mRemote = remote;}
+
+    void sendNext()
+    {
+      zsLib::BYTE buffer[kMessageSize] {};
+      bool wouldBlock = false;
+      if (mRemote.isEmpty()) {
+        mSocket->send(buffer, sizeof(buffer), &wouldBlock);
+      } else {
+        mSocket->sendTo(mRemote, buffer, sizeof(buffer), &wouldBlock);
+      }
+    }
+
+    void close()
+    {
+      zsLib::SocketPtr socket = mSocket;
+      zsLib::SocketPtr accepted = mAccepted;
+      mSocket.reset();
+      mAccepted.reset();
+      if (accepted) accepted->close();
+      if (socket) socket->close();
+    }
+
+    virtual void onReadReady(zsLib::SocketPtr socket)
+    {
+      if (!mSocket) return;   // already closed
+
+      try {
+        readReady(socket);
+      } catch (...) {
+        // the peer went away while tearing down
+      }
+    }
+
+    void readReady(zsLib::SocketPtr socket)
+    {
+      if ((!mIsClient) && (socket == mSocket) && (mListening)) {
+        zsLib::IPAddress remote;
+        bool wouldBlock = false;
+        mAccepted = socket->accept(remote, &wouldBlock);
+        if (mAccepted) {
+          mAccepted->setOptionFlag(zsLib::Socket::SetOptionFlag::NonBlocking, true);
+          mAccepted->setDelegate(mThisWeak.lock());
+        }
+        return;
+      }
+
+      while (true) {
+        zsLib::BYTE buffer[kMessageSize * 4];
+        zsLib::IPAddress remote;
+        bool wouldBlock = false;
+        int error = 0;
+
+        size_t read = (mRemote.isEmpty() && (!mDatagram) ?
+                       socket->receive(buffer, sizeof(buffer), &wouldBlock, 0, &error) :
+                       socket->receiveFrom(remote, buffer, sizeof(buffer), &wouldBlock, 0, &error));
+        if ((wouldBlock) || (0 != error) || (0 == read)) break;
+
+        if (!mIsClient) {
+          if (mDatagram) {
+            socket->sendTo(remote, buffer, read, &wouldBlock);
+          } else {
+            socket->send(buffer, read, &wouldBlock);
+          }
+          continue;
+        }
+
+        mPending += read;
+        while (mPending >= kMessageSize) {
+          mPending -= kMessageSize;
+          if (0 == --mRemaining) return;
+          sendNext();
+        }
+      }
+    }
+
+    virtual void onWriteReady(zsLib::SocketPtr socket) {}
+    virtual void onException(zsLib::SocketPtr socket) {}
+
+  public:
+    bool mIsClient {};
+    bool mListening {};
+    bool mDatagram {};
+    std::atomic<size_t> mRemaining {};
+    size_t mPending {};
+
+    EchoPeerWeakPtr mThisWeak;
+    zsLib::SocketPtr mSocket;
+    zsLib::SocketPtr mAccepted;
+    zsLib::IPAddress mRemote;
+  };
+
+  //---------------------------------------------------------------------------
+  static void runEcho(bool udp)
+  {
+    size_t messages = Benchmark::scaled(20000);
+
+    Benchmark::run((udp ? "socket.udp.loopback.echo" : "socket.tcp.loopback.echo"), messages, [udp, messages](Benchmark::Measure &measure) {
+      zsLib::IMessageQueueThreadPtr serverThread = zsLib::IMessageQueueThread::createBasic("org.zsLib.bench.socket.server");
+      zsLib::IMessageQueueThreadPtr clientThread = zsLib::IMessageQueueThread::createBasic("org.zsLib.bench.socket.client");
+
+      EchoPeerPtr server = EchoPeer::create(serverThread, false);
+      EchoPeerPtr client = EchoPeer::create(clientThread, true, messages);
+
+      try {
+        zsLib::SocketPtr serverSocket = (udp ? zsLib::Socket::createUDP() : zsLib::Socket::createTCP());
+        serverSocket->bind(zsLib::IPAddress(zsLib::IPAddress::loopbackV4(), 0));
+        zsLib::IPAddress serverAddress = serverSocket->getLocalAddress();
+
+        server->mDatagram = udp;
+        if (!udp) {
+          serverSocket->listen();
+          server->mListening = true;
+        }
+        server->attach(serverSocket);
+
+        zsLib::SocketPtr clientSocket = (udp ? zsLib::Socket::createUDP() : zsLib::Socket::createTCP());
+        if (udp) {
+          clientSocket->bind(zsLib::IPAddress(zsLib::IPAddress::loopbackV4(), 0));
+          client->mDatagram = true;
+          client->setRemote(serverAddress);
+        } else {
+          clientSocket->connect(serverAddress);
+          clientSocket->setOptionFlag(zsLib::Socket::SetOptionFlag::TCPNoDelay, true);
+        }
+        client->attach(clientSocket);
+
+        measure.start();
+        clientThread->postClosure([client]() { client->sendNext(); });
+        if (!Benchmark::waitFor([&client]() -> bool { return 0 == client->mRemaining.load(); }, zsLib::Seconds(60))) {
+          measure.setOperations(messages - client->mRemaining.load());
+        }
+        measure.stop();
+      } catch (...) {
+        measure.setOperations(0);
+      }
+
+      serverThread->postClosure([server]() { server->close(); });
+      clientThread->postClosure([client]() { client->close(); });
+      Benchmark::waitFor([&server, &client]() -> bool { return (!server->mSocket) && (!client->mSocket); });
+
+      server.reset();
+      client.reset();
+      serverThread->waitForShutdown();
+      clientThread->waitForShutdown();
+    });
+  }
+}
+
+//-----------------------------------------------------------------------------
+void benchSocket()
+{
+  bench_socket::runEcho(true);
+  bench_socket::runEcho(false);
+}
@@ -0,0 +1,115 @@
+/*
+
+ Copyright (c) 2014, Robin Raymond
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation
+ and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ The views and conclusions contained in the software and documentation are those
+ of the authors and should not be interpreted as representing official policies,
+ either expressed or implied, of the FreeBSD Project.
+
+ */
+
+#include <zsLib/ITimer.h>
+#include <zsLib/IMessageQueueThread.h>
+
+#include "benchmark.h"
+
+#include <atomic>
+#include <vector>
+
+namespace bench_timer
+{
+  ZS_DECLARE_CLASS_PTR(BenchTimerCallback)
+
+  class BenchTimerCallback : public zsLib::ITimerDelegate,
+                             public zsLib::MessageQueueAssociator
+  {
+  private:
+    BenchTimerCallback(zsLib::IMessageQueuePtr queue) : zsLib::MessageQueueAssociator(queue) {}
+
+  public:
+    static BenchTimerCallbackPtr create(zsLib::IMessageQueuePtr queue)
+    {
+      return BenchTimerCallbackPtr(new BenchTimerCallback(queue));
+    }
+
+    virtual void onTimer(zsLib::ITimerPtr timer)
+    {
+      ++mFired;
+    }
+
+  public:
+    std::atomic<size_t> mFired {};
+  };
+}
+
+//-----------------------------------------------------------------------------
+void benchTimer()
+{
+  using namespace bench_timer;
+
+  size_t totalTimers = Benchmark::scaled(100000);
+
+  Benchmark::run("timer.churn.create_cancel", totalTimers, [totalTimers](Benchmark::Measure &measure) {
+    zsLib::IMessageQueueThreadPtr thread = zsLib::IMessageQueueThread::createBasic("org.zsLib.bench.timer");
+    BenchTimerCallbackPtr callback = BenchTimerCallback::create(thread);
+
+    std::vector<zsLib::ITimerPtr> timers;
+    timers.reserve(totalTimers);
+
+    measure.start();
+    for (size_t index = 0; index < totalTimers; ++index) {
+      // spread the deadlines so the monitor has a realistic ordering to maintain
+      timers.push_back(zsLib::ITimer::create(callback, zsLib::Seconds(3600 + static_cast<zsLib::LONGLONG>(index % 1000)), false));
+    }
+    for (auto iter = timers.begin(); iter != timers.end(); ++iter) {
+      (*iter)->cancel();
+    }
+    measure.stop();
+
+    timers.clear();
+    Benchmark::waitFor([&thread]() -> bool { return 0 == thread->getTotalUnprocessedMessages(); });
+    thread->waitForShutdown();
+  });
+
+  size_t firingTimers = Benchmark::scaled(10000);
+
+  Benchmark::run("timer.fire.oneshot", firingTimers, [firingTimers](Benchmark::Measure &measure) {
+    zsLib::IMessageQueueThreadPtr thread = zsLib::IMessageQueueThread::createBasic("org.zsLib.bench.timer.fire");
+    BenchTimerCallbackPtr callback = BenchTimerCallback::create(thread);
+
+    std::vector<zsLib::ITimerPtr> timers;
+    timers.reserve(firingTimers);
+
+    measure.start();
+    for (size_t index = 0; index < firingTimers; ++index) {
+      timers.push_back(zsLib::ITimer::create(callback, zsLib::Milliseconds(1 + static_cast<zsLib::LONGLONG>(index % 10)), false));
+    }
+    Benchmark::waitFor([&callback, firingTimers]() -> bool { return callback->mFired.load() >= firingTimers; });
+    measure.stop();
+
+    timers.clear();
+    Benchmark::waitFor([&thread]() -> bool { return 0 == thread->getTotalUnprocessedMessages(); });
+    thread->waitForShutdown();
+  });
+}
@@ -0,0 +1,171 @@
+/*
+
+ Copyright (c) 2014, Robin Raymond
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation
+ and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ The views and conclusions contained in the software and documentation are those
+ of the authors and should not be interpreted as representing official policies,
+ either expressed or implied, of the FreeBSD Project.
+
+ */
+
+#include <zsLib/XML.h>
+
+#include "benchmark.h"
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace bench_xml
+{
+  //---------------------------------------------------------------------------
+  // fixed seed so every run (and every commit) parses identical documents
+  class Random
+  {
+  public:
+    zsLib::ULONG next() {mSeed = (mSeed * 1103515245) + 12345; return (mSeed >> 8);}
+    size_t below(size_t value) {return static_cast<size_t>(next() % value);}
+
+  private:
+    zsLib::ULONG mSeed {0x5EED};
+  };
+
+  //---------------------------------------------------------------------------
+  static std::string word(Random &random)
+  {
+    static const char *gWords[] = {"alpha", "bravo", "charlie", "delta", "echo", "foxtrot", "golf", "hotel", "caf\\u00e9", "line\\nbreak", "\\\"quoted\\\"", "tab\\tbed"};
+    return gWords[random.below(sizeof(gWords) / sizeof(gWords[0]))];
+  }
+
+  //---------------------------------------------------------------------------
+  // statuses with nested user objects and lots of short strings (social feed style)
+  static std::string makeStatusCorpus(size_t statuses)
+  {
+    Random random;
+    std::stringstream ss;
+    ss << "{\"statuses\":[";
+    for (size_t index = 0; index < statuses; ++index) {
+      if (0 != index) ss << ",";
+      ss << "{\"id\":" << (1000000000 + index) << ",\"text\":\"";
+      for (size_t loop = 0; loop < 12; ++loop) ss << (0 == loop ? "" : " ") << word(random);
+      ss << "\",\"user\":{\"id\":" << random.next() << ",\"name\":\"" << word(random) << "\",\"screen_name\":\"" << word(random) << "\",\"followers_count\":" << random.below(100000) << ",\"verified\":" << (random.below(2) ? "true" : "false") << "},";
+      ss << "\"entities\":{\"hashtags\":[\"" << word(random) << "\",\"" << word(random) << "\"],\"urls\":[]},\"retweet_count\":" << random.below(1000) << ",\"favorited\":false}";
+    }
+    ss << "]}";
+    return ss.str();
+  }
+
+  //---------------------------------------------------------------------------
+  // long arrays of coordinates (geographic shape style)
+  static std::string makeCoordinateCorpus(size_t polygons)
+  {
+    Random random;
+    std::stringstream ss;
+    ss << "{\"type\":\"FeatureCollection\",\"features\":[{\"type\":\"Feature\",\"geometry\":{\"type\":\"Polygon\",\"coordinates\":[";
+    for (size_t index = 0; index < polygons; ++index) {
+      if (0 != index) ss << ",";
+      ss << "[";
+      for (size_t point = 0; point < 64; ++point) {
+        if (0 != point) ss << ",";
+        ss << "[" << -(static_cast<double>(random.below(18000000)) / 100000.0) << "," << (static_cast<double>(random.below(9000000)) / 100000.0) << "]";
+      }
+      ss << "]";
+    }
+    ss << "]}}]}";
+    return ss.str();
+  }
+
+  //---------------------------------------------------------------------------
+  static std::string makeXMLCorpus(size_t items)
+  {
+    Random random;
+    std::stringstream ss;
+    ss << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<catalog>";
+    for (size_t index = 0; index < items; ++index) {
+      ss << "<item id=\"" << index << "\" kind=\"" << (random.below(2) ? "book" : "disc") << "\"><title>Title &amp; " << random.next() << "</title>";
+      ss << "<price currency=\"USD\">" << random.below(10000) << "</price><description><![CDATA[Some <raw> text " << random.next() << "]]></description></item>";
+    }
+    ss << "</catalog>";
+    return ss.str();
+  }
+
+  //---------------------------------------------------------------------------
+  static void benchDocument(const std::string &corpusName, const std::string &document, bool isJSON)
+  {
+    const char *format = (isJSON ? "json" : "xml");
+    size_t bytes = document.size();
+
+    std::string parseName = std::string(format) + ".parse." + corpusName;
+    Benchmark::run(parseName.c_str(), bytes, [&document, isJSON](Benchmark::Measure &measure) {
+      zsLib::XML::ParserPtr parser = (isJSON ? zsLib::XML::Parser::createJSONParser() : zsLib::XML::Parser::createXMLParser());
+
+      measure.start();
+      zsLib::XML::DocumentPtr parsed = parser->parse(document.c_str());
+      measure.stop();
+
+      if (!parsed) measure.setOperations(0);
+    }, "byte");
+
+    zsLib::XML::ParserPtr parser = (isJSON ? zsLib::XML::Parser::createJSONParser() : zsLib::XML::Parser::createXMLParser());
+    zsLib::XML::DocumentPtr parsed = parser->parse(document.c_str());
+
+    std::string generateName = std::string(format) + ".generate." + corpusName;
+    Benchmark::run(generateName.c_str(), bytes, [parsed, isJSON](Benchmark::Measure &measure) {
+      zsLib::XML::GeneratorPtr generator = (isJSON ? zsLib::XML::Generator::createJSONGenerator() : zsLib::XML::Generator::createXMLGenerator());
+
+      size_t length = 0;
+      std::unique_ptr<char[]> output = generator->write(parsed, &length);
+      measure.setOperations(length);
+    }, "byte");
+  }
+}
+
+//-----------------------------------------------------------------------------
+void benchXML()
+{
+  using namespace bench_xml;
+
+  benchDocument("statuses", makeStatusCorpus(Benchmark::scaled(2000)), true);
+  benchDocument("coordinates", makeCoordinateCorpus(Benchmark::scaled(400)), true);
+  benchDocument("catalog", makeXMLCorpus(Benchmark::scaled(20000)), false);
+
+  // externally supplied corpora (e.g. the usual twitter.json / canada.json / citm_catalog.json)
+  const Benchmark::PathList &files = Benchmark::corpusFiles();
+  for (auto iter = files.begin(); iter != files.end(); ++iter) {
+    const std::string &path = (*iter);
+
+    std::ifstream file(path.c_str(), std::ios::in | std::ios::binary);
+    if (!file) continue;
+
+    std::stringstream ss;
+    ss << file.rdbuf();
+
+    std::string name = path;
+    size_t slash = name.find_last_of("/\\");
+    if (std::string::npos != slash) name = name.substr(slash + 1);
+
+    bool isJSON = !((name.size() > 4) && (".xml" == name.substr(name.size() - 4)));
+    benchDocument(name, ss.str(), isJSON);
+  }
+}
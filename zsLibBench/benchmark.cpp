@@ -0,0 +1,329 @@
+/*
+
+ Copyright (c) 2014, Robin Raymond
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation
+ and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ The views and conclusions contained in the software and documentation are those
+ of the authors and should not be interpreted as representing official policies,
+ either expressed or implied, of the FreeBSD Project.
+
+ */
+
+#include "benchmark.h"
+
+#include <zsLib/Singleton.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+void benchMessageQueue();
+void benchThreadPool();
+void benchProxy();
+void benchPromise();
+void benchSingleton();
+void benchIdentifiers();
+void benchNumeric();
+void benchTimer();
+void benchXML();
+void benchSocket();
+
+namespace Benchmark
+{
+  struct Settings
+  {
+    std::string mFilter;
+    size_t mRepetitions {5};
+    double mScale {1.0};
+    std::string mOutputPath;        // empty writes the JSON to stdout
+    PathList mCorpusFiles;
+    bool mList {};
+  };
+
+  struct Result
+  {
+    std::string mName;
+    std::string mUnit;
+    size_t mOperations {};
+    std::vector<zsLib::LONGLONG> mSamples;    // nanoseconds per repetition
+  };
+
+  //---------------------------------------------------------------------------
+  static Settings &settings()
+  {
+    static Settings gSettings;
+    return gSettings;
+  }
+
+  //---------------------------------------------------------------------------
+  static std::vector<Result> &results()
+  {
+    static std::vector<Result> gResults;
+    return gResults;
+  }
+
+  //---------------------------------------------------------------------------
+  static std::string jsonEscape(const std::string &value)
+  {
+    std::string result;
+    for (auto iter = value.begin(); iter != value.end(); ++iter) {
+      char ch = *iter;
+      switch (ch) {
+        case '"':   result += "\\\""; break;
+        case '\\':  result += "\\\\"; break;
+        default: {
+          if (static_cast<unsigned char>(ch) < 0x20) {
+            char buffer[8];
+            snprintf(buffer, sizeof(buffer), "\\u%04x", static_cast<unsigned>(static_cast<unsigned char>(ch)));
+            result += buffer;
+            break;
+          }
+          result += ch;
+          break;
+        }
+      }
+    }
+    return result;
+  }
+
+  //---------------------------------------------------------------------------
+  void Measure::start() noexcept
+  {
+    mStarted = true;
+    mRunning = true;
+    mStart = std::chrono::steady_clock::now();
+  }
+
+  //---------------------------------------------------------------------------
+  void Measure::stop() noexcept
+  {
+    if (!mRunning) return;
+    mRunning = false;
+    mElapsed += std::chrono::duration_cast<zsLib::Nanoseconds>(std::chrono::steady_clock::now() - mStart);
+  }
+
+  //---------------------------------------------------------------------------
+  static Result measure(const char *name, size_t operations, Body &body, size_t repetitions)
+  {
+    Result result;
+    result.mName = name;
+    result.mOperations = operations;
+
+    for (size_t loop = 0; loop < repetitions; ++loop) {
+      Measure measure(operations);
+
+      auto start = std::chrono::steady_clock::now();
+      body(measure);
+      auto finish = std::chrono::steady_clock::now();
+
+      zsLib::Nanoseconds elapsed = (measure.wasStarted() ? measure.elapsed() : std::chrono::duration_cast<zsLib::Nanoseconds>(finish - start));
+      result.mOperations = measure.operations();
+      result.mSamples.push_back(static_cast<zsLib::LONGLONG>(elapsed.count()));
+    }
+    return result;
+  }
+
+  //---------------------------------------------------------------------------
+  void run(
+           const char *name,
+           size_t operations,
+           Body body,
+           const char *unit
+           ) noexcept
+  {
+    Settings &current = settings();
+    if ((current.mFilter.size() > 0) &&
+        (std::string::npos == std::string(name).find(current.mFilter))) return;
+
+    if (current.mList) {
+      std::cerr << name << "\n";
+      return;
+    }
+
+    std::cerr << "RUNNING:      " << name << " (" << operations << " operations)\n";
+
+    measure(name, operations, body, 1);   // warm up caches, allocators and lazily created threads
+    Result result = measure(name, operations, body, current.mRepetitions);
+    result.mUnit = (unit ? unit : "op");
+
+    std::vector<zsLib::LONGLONG> sorted(result.mSamples);
+    std::sort(sorted.begin(), sorted.end());
+    double median = static_cast<double>(sorted[sorted.size() / 2]);
+    double perOperation = (result.mOperations > 0 ? median / static_cast<double>(result.mOperations) : median);
+
+    std::cerr << "              median " << (median / 1000000.0) << "ms, " << perOperation << "ns/" << result.mUnit << "\n";
+
+    results().push_back(result);
+  }
+
+  //---------------------------------------------------------------------------
+  size_t scaled(size_t operations) noexcept
+  {
+    size_t result = static_cast<size_t>(static_cast<double>(operations) * settings().mScale);
+    return (result < 1 ? 1 : result);
+  }
+
+  //---------------------------------------------------------------------------
+  const PathList &corpusFiles() noexcept
+  {
+    return settings().mCorpusFiles;
+  }
+
+  //---------------------------------------------------------------------------
+  bool waitFor(
+               std::function<bool()> condition,
+               zsLib::Milliseconds timeout
+               ) noexcept
+  {
+    auto giveUp = std::chrono::steady_clock::now() + timeout;
+    while (!condition()) {
+      if (std::chrono::steady_clock::now() > giveUp) {
+        std::cerr << "TIMEOUT:      benchmark condition was never met\n";
+        return false;
+      }
+      std::this_thread::yield();
+    }
+    return true;
+  }
+
+  //---------------------------------------------------------------------------
+  bool parseArguments(int argc, char * const argv[]) noexcept
+  {
+    Settings &current = settings();
+
+    for (int index = 1; index < argc; ++index) {
+      std::string arg(argv[index]);
+      bool hasValue = (index + 1 < argc);
+
+      if (("--filter" == arg) && (hasValue)) { current.mFilter = argv[++index]; continue; }
+      if (("--repetitions" == arg) && (hasValue)) { current.mRepetitions = static_cast<size_t>(strtoul(argv[++index], NULL, 10)); continue; }
+      if (("--scale" == arg) && (hasValue)) { current.mScale = strtod(argv[++index], NULL); continue; }
+      if (("--output" == arg) && (hasValue)) { current.mOutputPath = argv[++index]; continue; }
+      if (("--corpus" == arg) && (hasValue)) { current.mCorpusFiles.push_back(argv[++index]); continue; }
+      if ("--list" == arg) { current.mList = true; continue; }
+
+      std::cerr << "usage: " << argv[0] << " [--filter <substring>] [--repetitions <n>] [--scale <factor>] [--output <file.json>] [--corpus <file.json|file.xml>]... [--list]\n";
+      return false;
+    }
+
+    if (current.mRepetitions < 1) current.mRepetitions = 1;
+    if (current.mScale <= 0.0) current.mScale = 1.0;
+    return true;
+  }
+
+  //---------------------------------------------------------------------------
+  void runAllBenchmarks() noexcept
+  {
+    zsLib::SingletonManager::Initializer init;
+
+    benchMessageQueue();
+    benchThreadPool();
+    benchProxy();
+    benchPromise();
+    benchSingleton();
+    benchIdentifiers();
+    benchNumeric();
+    benchTimer();
+    benchXML();
+    benchSocket();
+  }
+
+  //---------------------------------------------------------------------------
+  int output() noexcept
+  {
+    Settings &current = settings();
+    if (current.mList) return 0;
+
+    std::stringstream ss;
+
+    ss << "{\n";
+    ss << "  \"context\": {\n";
+#ifdef NDEBUG
+    ss << "    \"build\": \"release\",\n";
+#else
+    ss << "    \"build\": \"debug\",\n";
+#endif //NDEBUG
+#if defined(__clang__)
+    ss << "    \"compiler\": \"clang " << __clang_major__ << "." << __clang_minor__ << "\",\n";
+#elif defined(__GNUC__)
+    ss << "    \"compiler\": \"gcc " << __GNUC__ << "." << __GNUC_MINOR__ << "\",\n";
+#elif defined(_MSC_VER)
+    ss << "    \"compiler\": \"msvc " << _MSC_VER << "\",\n";
+#else
+    ss << "    \"compiler\": \"unknown\",\n";
+#endif
+    ss << "    \"hardware_threads\": " << std::thread::hardware_concurrency() << ",\n";
+    ss << "    \"repetitions\": " << current.mRepetitions << ",\n";
+    ss << "    \"scale\": " << current.mScale << "\n";
+    ss << "  },\n";
+    ss << "  \"benchmarks\": [";
+
+    auto &all = results();
+    for (size_t index = 0; index < all.size(); ++index) {
+      const Result &result = all[index];
+
+      std::vector<zsLib::LONGLONG> sorted(result.mSamples);
+      std::sort(sorted.begin(), sorted.end());
+
+      double operations = static_cast<double>(result.mOperations > 0 ? result.mOperations : 1);
+      double median = static_cast<double>(sorted[sorted.size() / 2]);
+
+      ss << (0 == index ? "\n" : ",\n");
+      ss << "    {\n";
+      ss << "      \"name\": \"" << jsonEscape(result.mName) << "\",\n";
+      ss << "      \"unit\": \"" << jsonEscape(result.mUnit) << "\",\n";
+      ss << "      \"operations\": " << result.mOperations << ",\n";
+      ss << "      \"ns_per_op\": {\"min\": " << (static_cast<double>(sorted.front()) / operations)
+         << ", \"median\": " << (median / operations)
+         << ", \"max\": " << (static_cast<double>(sorted.back()) / operations) << "},\n";
+      ss << "      \"ops_per_sec\": " << (median > 0 ? (operations * 1000000000.0) / median : 0.0) << ",\n";
+      ss << "      \"samples_ns\": [";
+      for (size_t sample = 0; sample < result.mSamples.size(); ++sample) {
+        ss << (0 == sample ? "" : ", ") << result.mSamples[sample];
+      }
+      ss << "]\n";
+      ss << "    }";
+    }
+    ss << "\n  ]\n";
+    ss << "}\n";
+
+    if (current.mOutputPath.size() > 0) {
+      std::ofstream file(current.mOutputPath.c_str());
+      if (!file) {
+        std::cerr << "FAILED:       unable to write " << current.mOutputPath << "\n";
+        return -1;
+      }
+      file << ss.str();
+      return 0;
+    }
+
+    std::cout << ss.str();
+    return 0;
+  }
+}
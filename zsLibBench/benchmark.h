@@ -0,0 +1,96 @@
+/*
+
+ Copyright (c) 2014, Robin Raymond
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice, this
+ list of conditions and the following disclaimer.
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation
+ and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ The views and conclusions contained in the software and documentation are those
+ of the authors and should not be interpreted as representing official policies,
+ either expressed or implied, of the FreeBSD Project.
+
+ */
+
+#pragma once
+
+#include <zsLib/types.h>
+
+#include <chrono>
+#include <functional>
+#include <list>
+#include <string>
+
+namespace Benchmark
+{
+  //---------------------------------------------------------------------------
+  // PURPOSE: Handed to every benchmark body. The body performs operations()
+  //          units of work and may exclude setup / teardown from the timing
+  //          by calling start() and stop() around the measured region.
+  class Measure
+  {
+  public:
+    Measure(size_t operations) noexcept : mOperations(operations) {}
+
+    size_t operations() const noexcept {return mOperations;}
+    void setOperations(size_t operations) noexcept {mOperations = operations;}   // e.g. when fewer operations completed
+
+    void start() noexcept;
+    void stop() noexcept;
+
+    bool wasStarted() const noexcept {return mStarted;}
+    zsLib::Nanoseconds elapsed() const noexcept {return mElapsed;}
+
+  private:
+    size_t mOperations {};
+    bool mStarted {};
+    bool mRunning {};
+    std::chrono::steady_clock::time_point mStart;
+    zsLib::Nanoseconds mElapsed {};
+  };
+
+  typedef std::function<void(Measure &)> Body;
+
+  //---------------------------------------------------------------------------
+  // PURPOSE: Run one named benchmark (skipped unless it matches --filter).
+  //          The body runs once to warm up and then once per repetition;
+  //          the whole body is timed unless it calls start() / stop().
+  void run(
+           const char *name,
+           size_t operations,
+           Body body,
+           const char *unit = "op"                  // what one operation is (e.g. "byte")
+           ) noexcept;
+
+  typedef std::list<std::string> PathList;
+
+  size_t scaled(size_t operations) noexcept;    // applies --scale (never less than 1)
+  const PathList &corpusFiles() noexcept;       // every --corpus <file> given
+
+  // wait (bounded) for a condition to become true, returns the final result
+  bool waitFor(
+               std::function<bool()> condition,
+               zsLib::Milliseconds timeout = zsLib::Milliseconds(30000)
+               ) noexcept;
+
+  bool parseArguments(int argc, char * const argv[]) noexcept;
+  void runAllBenchmarks() noexcept;
+  int output() noexcept;
+}
@@ -31,6 +31,19 @@
 
 #include <zsLib/helpers.h>
 #include <zsLib/Stringize.h>
+#include <zsLib/IHelper.h>
+#include <zsLib/IMessageQueueStatistics.h>
+#include <zsLib/IMessageQueueThreadPool.h>
+#include <zsLib/Event.h>
+#include <zsLib/Singleton.h>
+
+#ifdef __linux__
+#include <sched.h>
+#endif //__linux__
+
+#include <set>
+#include <thread>
+#include <vector>
 
 #include "testing.h"
 #include "main.h"
@@ -87,6 +100,59 @@ namespace testing_helper
 
     TESTING_CHECK(sizeof(uuid1) == sizeof(zsLib::UUID))
     TESTING_CHECK(uuid1 != uuid2)
+
+    // PUIDs are unique across threads and increase within each thread
+    const size_t totalThreads = 4;
+    const size_t perThread = 10000;
+    std::vector< std::vector<zsLib::PUID> > created(totalThreads);
+    std::vector<std::thread> threads;
+    for (size_t index = 0; index < totalThreads; ++index) {
+      threads.push_back(std::thread([&created, index, perThread]() {
+        for (size_t loop = 0; loop < perThread; ++loop) {
+          created[index].push_back(zsLib::createPUID());
+        }
+      }));
+    }
+
+    std::set<zsLib::PUID> all;
+    bool increasing = true;
+    for (size_t index = 0; index < totalThreads; ++index) {
+      threads[index].join();
+      for (size_t loop = 0; loop < perThread; ++loop) {
+        if ((loop > 0) && (created[index][loop] <= created[index][loop - 1])) increasing = false;
+        all.insert(created[index][loop]);
+      }
+    }
+    TESTING_CHECK(increasing)
+    TESTING_EQUAL(all.size(), totalThreads * perThread);
+    TESTING_CHECK(all.end() == all.find(0))
+
+    // random UUIDs carry the version 4 / RFC 4122 variant bits
+    zsLib::UCHAR bytes[16];
+    uuid1.getBytes(bytes);
+    TESTING_EQUAL(bytes[6] >> 4, 4);
+    TESTING_EQUAL(bytes[8] >> 6, 2);
+
+    // bulk creation yields distinct values
+    const size_t totalBulk = 1000;
+    std::vector<zsLib::UUID> bulk(totalBulk);
+    zsLib::createUUIDs(&(bulk[0]), bulk.size());
+    std::set<zsLib::UUID> distinct(bulk.begin(), bulk.end());
+    TESTING_EQUAL(distinct.size(), totalBulk);
+
+    // time ordered UUIDs are version 7 and increase per thread
+    zsLib::createUUIDs(&(bulk[0]), bulk.size(), true);
+    bool ordered = true;
+    for (size_t index = 1; index < bulk.size(); ++index) {
+      if (!(bulk[index - 1] < bulk[index])) ordered = false;
+    }
+    TESTING_CHECK(ordered)
+
+    zsLib::UUID timeOrdered = zsLib::createTimeOrderedUUID();
+    TESTING_CHECK(bulk.back() < timeOrdered)
+    timeOrdered.getBytes(bytes);
+    TESTING_EQUAL(bytes[6] >> 4, 7);
+    TESTING_EQUAL(bytes[8] >> 6, 2);
   }
 
   void testAtomicIncDec()
@@ -115,6 +181,753 @@ namespace testing_helper
     value = 0xFFFFFFFF;
     TESTING_EQUAL(0xFFFFFFFF, value)
   }
+
+  void testMessageQueueStatistics()
+  {
+    typedef zsLib::IMessageQueueStatistics::Histogram Histogram;
+
+    for (zsLib::ULONGLONG value = 0; value < 100000; value = (value * 3) + 1) {
+      size_t bucket = Histogram::toBucket(value);
+      TESTING_CHECK(Histogram::fromBucket(bucket) <= value)
+      TESTING_CHECK(Histogram::fromBucket(bucket + 1) > value)
+    }
+
+    {
+      Histogram histogram;
+      for (zsLib::ULONGLONG value = 1; value <= 1000; ++value) {
+        histogram.record(value);
+      }
+      TESTING_EQUAL(histogram.mCount, 1000)
+      TESTING_EQUAL(histogram.mMin, 1)
+      TESTING_EQUAL(histogram.mMax, 1000)
+      TESTING_EQUAL(histogram.getMean(), 500)
+      TESTING_CHECK((histogram.getPercentile(50.0) >= 500) && (histogram.getPercentile(50.0) <= 500 + (500 / 16)))
+      TESTING_CHECK((histogram.getPercentile(99.0) >= 990) && (histogram.getPercentile(99.0) <= 1000))
+      TESTING_EQUAL(histogram.getPercentile(100.0), 1000)
+
+      Histogram merged;
+      merged.merge(histogram);
+      merged.merge(histogram);
+      TESTING_EQUAL(merged.mCount, 2000)
+      TESTING_EQUAL(merged.getPercentile(50.0), histogram.getPercentile(50.0))
+    }
+
+    zsLib::IMessageQueueStatistics::enable();
+    TESTING_CHECK(zsLib::IMessageQueueStatistics::isEnabled())
+
+    zsLib::IMessageQueueThreadPoolPtr pool = zsLib::IMessageQueueThreadPool::create();
+    pool->createThread("org.zsLib.test.statistics");
+
+    zsLib::IMessageQueuePtr queue = pool->createQueue();
+    zsLib::Event done;
+    const size_t total = 50;
+    std::atomic<size_t> processed {};
+    for (size_t index = 0; index < total; ++index) {
+      if (0 == (index % 2)) {
+        queue->postClosure([&processed, &done, total]() {
+          if (++processed == total) done.notify();
+        });
+        continue;
+      }
+      queue->postClosure([&processed, &done, total]() {   // a second closure type
+        if (++processed == total) done.notify();
+      });
+    }
+    done.wait();
+
+    // the last message records after notifying so give the dispatcher a moment
+    for (int loop = 0; (loop < 100) && (pool->hasPendingMessages() || queue->getTotalUnprocessedMessages() > 0); ++loop) {
+      std::this_thread::sleep_for(zsLib::Milliseconds(10));
+    }
+    std::this_thread::sleep_for(zsLib::Milliseconds(50));
+
+    zsLib::IMessageQueueStatistics::QueueStatisticsList statistics = zsLib::IMessageQueueStatistics::getSnapshot();
+    zsLib::ULONGLONG recorded = 0;
+    size_t closureQueues = 0;
+    for (auto iter = statistics.begin(); iter != statistics.end(); ++iter) {
+      size_t closureEntries = 0;
+      for (auto iterMethod = (*iter).mMethods.begin(); iterMethod != (*iter).mMethods.end(); ++iterMethod) {
+        recorded += (*iterMethod).mProcessingTime.mCount;
+        TESTING_CHECK((*iterMethod).mWaitTime.mCount == (*iterMethod).mProcessingTime.mCount)
+        if ("postClosure" == (*iterMethod).mMethodName) {
+          TESTING_EQUAL((*iterMethod).mDelegateName, "IMessageQueue")
+          ++closureEntries;
+        }
+      }
+      TESTING_CHECK(closureEntries < 2)   // every closure type on a queue shares one entry
+      if (closureEntries > 0) ++closureQueues;
+    }
+    TESTING_CHECK(recorded >= total)
+    TESTING_CHECK(closureQueues > 0)
+
+    zsLib::String json = zsLib::IHelper::getMessageQueueStatistics(true, true);
+    TESTING_CHECK(json.hasData())
+    TESTING_CHECK(std::string::npos != json.find("processing"))
+
+    zsLib::IMessageQueueStatistics::enable(false);
+    TESTING_CHECK(!zsLib::IMessageQueueStatistics::isEnabled())
+    TESTING_CHECK(zsLib::IMessageQueueStatistics::getSnapshot().size() < 1)
+
+    queue.reset();
+    pool->waitForShutdown();
+  }
+
+  void testEvent()
+  {
+    {
+      zsLib::Event manual(zsLib::Event::Reset_Manual);
+      manual.notify();
+      manual.wait();
+      manual.wait();    // stays notified until reset
+      manual.reset();
+      manual.notify();
+      manual.wait();
+    }
+
+    {
+      // an auto reset event remembers a notify that happened before the wait
+      zsLib::Event automatic(zsLib::Event::Reset_Auto);
+      automatic.notify();
+      automatic.notify();
+      automatic.wait();
+    }
+
+    {
+      zsLib::Event ping(zsLib::Event::Reset_Auto);
+      zsLib::Event pong(zsLib::Event::Reset_Auto);
+      const size_t total = 20000;
+      std::atomic<size_t> received {};
+
+      std::thread other([&ping, &pong, &received, total]() {
+        for (size_t index = 0; index < total; ++index) {
+          ping.wait();
+          ++received;
+          pong.notify();
+        }
+      });
+
+      for (size_t index = 0; index < total; ++index) {
+        ping.notify();
+        pong.wait();
+      }
+      other.join();
+
+      TESTING_EQUAL(received.load(), total)
+    }
+
+    {
+      zsLib::Event timed(zsLib::Event::Reset_Auto);
+      zsLib::Time start = zsLib::now();
+      TESTING_CHECK(!timed.waitUntil(start + zsLib::Milliseconds(20)))
+      TESTING_CHECK(zsLib::now() >= start + zsLib::Milliseconds(20))
+
+      timed.notify();
+      TESTING_CHECK(timed.waitUntil(zsLib::now() + zsLib::Seconds(10)))
+    }
+
+    {
+      zsLib::Event gate(zsLib::Event::Reset_Manual);
+      std::atomic<size_t> released {};
+      std::list<std::thread> threads;
+      for (int index = 0; index < 4; ++index) {
+        threads.emplace_back([&gate, &released]() { gate.wait(); ++released; });
+      }
+      std::this_thread::sleep_for(zsLib::Milliseconds(20));
+      gate.notify();
+      for (auto iter = threads.begin(); iter != threads.end(); ++iter) {
+        (*iter).join();
+      }
+      TESTING_EQUAL(released.load(), 4)
+    }
+  }
+
+  void testThreadAffinity()
+  {
+    TESTING_CHECK(zsLib::getTotalProcessors() >= 1)
+    TESTING_CHECK(zsLib::getTotalNUMANodes() >= 1)
+
+    zsLib::ThreadAffinity::ProcessorSet nodeProcessors = zsLib::getNUMANodeProcessors(0);
+    TESTING_CHECK(nodeProcessors.size() >= 1)
+    TESTING_CHECK(zsLib::getNUMANodeProcessors(-1).size() < 1)
+
+    zsLib::ThreadAffinity any;
+    TESTING_CHECK(!any.hasData())
+    TESTING_CHECK(any.resolve().size() < 1)
+    TESTING_EQUAL(any.toString(), "any")
+
+    zsLib::ThreadAffinity first = zsLib::ThreadAffinity::forProcessor(0);
+    TESTING_CHECK(first.hasData())
+    TESTING_EQUAL(first.resolve().size(), 1)
+    TESTING_EQUAL(first.toString(), "0")
+
+    zsLib::ThreadAffinity node = zsLib::ThreadAffinity::forNUMANode(0, true);
+    TESTING_CHECK(node.resolve() == nodeProcessors)
+    TESTING_CHECK(node != first)
+
+    {
+      zsLib::IMessageQueueThreadPtr thread = zsLib::IMessageQueueThread::createBasic("org.zsLib.test.affinity", zsLib::ThreadPriority_Normal, first);
+      zsLib::Event done;
+      thread->postClosure([&done]() { done.notify(); });
+      done.wait();
+
+      thread->setThreadAffinity(any);
+      zsLib::Event doneAgain;
+#ifdef __linux__
+      // "any" returns to the processors the process may use, not every processor
+      cpu_set_t processCPUs;
+      CPU_ZERO(&processCPUs);
+      sched_getaffinity(0, sizeof(processCPUs), &processCPUs);
+
+      bool restored = false;
+      thread->postClosure([&doneAgain, &restored, &processCPUs]() {
+        cpu_set_t threadCPUs;
+        CPU_ZERO(&threadCPUs);
+        restored = ((0 == sched_getaffinity(0, sizeof(threadCPUs), &threadCPUs)) && (CPU_EQUAL(&threadCPUs, &processCPUs)));
+        doneAgain.notify();
+      });
+      doneAgain.wait();
+      TESTING_CHECK(restored)
+#else
+      thread->postClosure([&doneAgain]() { doneAgain.notify(); });
+      doneAgain.wait();
+#endif //__linux__
+
+      thread->waitForShutdown();
+    }
+
+    {
+      zsLib::IMessageQueueThreadPoolPtr pool = zsLib::IMessageQueueThreadPool::create();
+      pool->setThreadAffinity(node);
+      pool->createThread("org.zsLib.test.affinity.pool.1");
+      pool->createThread("org.zsLib.test.affinity.pool.2");
+
+      zsLib::IMessageQueuePtr queue = pool->createQueue();
+      zsLib::Event done;
+      const size_t total = 20;
+      std::atomic<size_t> processed {};
+      for (size_t index = 0; index < total; ++index) {
+        queue->postClosure([&processed, &done, total]() { if (++processed == total) done.notify(); });
+      }
+      done.wait();
+
+      queue.reset();
+      pool->waitForShutdown();
+    }
+  }
+
+  void testMessagePriorities()
+  {
+    TESTING_EQUAL(zsLib::String(zsLib::toString(zsLib::MessagePriority_High)), "High")
+
+    zsLib::IMessageQueueThreadPtr thread = zsLib::IMessageQueueThread::createBasic("org.zsLib.test.priorities");
+
+    {
+      // hold the queue busy so everything below is waiting at once
+      zsLib::Event blocked;
+      zsLib::Event release;
+      thread->postClosure([&blocked, &release]() { blocked.notify(); release.wait(); });
+      blocked.wait();
+
+      std::vector<int> order;
+      zsLib::Event done;
+      thread->postClosure([&order]() { order.push_back(5); }, zsLib::MessagePriority_Low);
+      thread->postClosure([&order]() { order.push_back(3); });
+      thread->postClosure([&order]() { order.push_back(1); }, zsLib::MessagePriority_High);
+      thread->postClosure([&order]() { order.push_back(6); }, zsLib::MessagePriority_Low);
+      thread->postClosure([&order]() { order.push_back(4); }, zsLib::MessagePriority_Normal);
+      thread->postClosure([&order]() { order.push_back(2); }, zsLib::MessagePriority_High);
+      thread->postClosure([&done]() { done.notify(); }, zsLib::MessagePriority_Low);
+      TESTING_EQUAL(thread->getTotalUnprocessedMessages(), 7)
+
+      release.notify();
+      done.wait();
+
+      TESTING_EQUAL(order.size(), 6)
+      for (size_t index = 0; index < order.size(); ++index) {
+        TESTING_EQUAL(order[index], static_cast<int>(index + 1))
+      }
+    }
+
+    {
+      // a waiting low priority message is not starved by a stream of high priority messages
+      zsLib::Event blocked;
+      zsLib::Event release;
+      thread->postClosure([&blocked, &release]() { blocked.notify(); release.wait(); });
+      blocked.wait();
+
+      std::vector<int> order;
+      zsLib::Event done;
+      thread->postClosure([&order]() { order.push_back(-1); }, zsLib::MessagePriority_Low);
+      for (int index = 0; index < 100; ++index) {
+        thread->postClosure([&order, index]() { order.push_back(index); }, zsLib::MessagePriority_High);
+      }
+      thread->postClosure([&done]() { done.notify(); }, zsLib::MessagePriority_High);
+
+      release.notify();
+      done.wait();
+
+      TESTING_EQUAL(order.size(), 101)
+      size_t lowIndex = 0;
+      for (size_t index = 0; index < order.size(); ++index) {
+        if (-1 == order[index]) lowIndex = index;
+      }
+      TESTING_CHECK((lowIndex > 0) && (lowIndex < 50))
+    }
+
+    thread->waitForShutdown();
+  }
+
+  void testDelayedPost()
+  {
+    {
+      zsLib::IMessageQueueThreadPtr thread = zsLib::IMessageQueueThread::createBasic("org.zsLib.test.delayed");
+
+      std::vector<int> order;
+      std::vector<zsLib::Time> fired(3);
+      zsLib::Event done;
+      zsLib::Time start = zsLib::now();
+
+      thread->postClosureDelayed([&order, &fired, &done]() { order.push_back(3); fired[2] = zsLib::now(); done.notify(); }, zsLib::Milliseconds(60));
+      thread->postClosureDelayed([&order, &fired]() { order.push_back(1); fired[0] = zsLib::now(); }, zsLib::Milliseconds(20));
+      thread->postClosureAt([&order, &fired]() { order.push_back(2); fired[1] = zsLib::now(); }, start + zsLib::Milliseconds(40));
+      thread->postClosureAt([&order]() { order.push_back(0); }, start - zsLib::Seconds(1));    // already due
+
+      done.wait();
+
+      TESTING_EQUAL(order.size(), 4)
+      for (size_t index = 0; index < order.size(); ++index) {
+        TESTING_EQUAL(order[index], static_cast<int>(index))
+      }
+      TESTING_CHECK(fired[0] >= start + zsLib::Milliseconds(20))
+      TESTING_CHECK(fired[1] >= start + zsLib::Milliseconds(40))
+      TESTING_CHECK(fired[2] >= start + zsLib::Milliseconds(60))
+
+      // a delayed message is not unprocessed until its deadline
+      thread->postClosureDelayed([]() {}, zsLib::Seconds(3600));
+      TESTING_EQUAL(thread->getTotalUnprocessedMessages(), 0)
+
+      thread->waitForShutdown();
+    }
+
+    {
+      zsLib::IMessageQueueThreadPoolPtr pool = zsLib::IMessageQueueThreadPool::create();
+      pool->createThread("org.zsLib.test.delayed.pool.1");
+      pool->createThread("org.zsLib.test.delayed.pool.2");
+
+      zsLib::IMessageQueuePtr first = pool->createQueue();
+      zsLib::IMessageQueuePtr second = pool->createQueue();
+
+      const size_t total = 40;
+      std::atomic<size_t> processed {};
+      std::atomic<size_t> early {};
+      zsLib::Event done;
+
+      for (size_t index = 0; index < total; ++index) {
+        zsLib::IMessageQueuePtr queue = (0 == (index % 2) ? first : second);
+        zsLib::Time deadline = zsLib::now() + zsLib::Milliseconds(static_cast<zsLib::LONGLONG>(((total - index) * 7) % 50));
+        queue->postClosureAt([&processed, &early, &done, deadline, total]() {
+          if (zsLib::now() < deadline) ++early;
+          if (++processed == total) done.notify();
+        }, deadline);
+      }
+
+      // ordinary messages keep flowing while the delayed ones wait
+      zsLib::Event posted;
+      first->postClosure([&posted]() { posted.notify(); });
+      posted.wait();
+
+      done.wait();
+      TESTING_EQUAL(processed.load(), total)
+      TESTING_EQUAL(early.load(), 0)
+
+      first.reset();
+      second.reset();
+      pool->waitForShutdown();
+    }
+  }
+
+  void testBoundedQueues()
+  {
+    TESTING_EQUAL(zsLib::String(zsLib::toString(zsLib::MessageQueueOverflowPolicy_DropOldest)), "Drop oldest")
+
+    {
+      zsLib::IMessageQueueThreadPtr thread = zsLib::IMessageQueueThread::createBasic("org.zsLib.test.bounded.fail", zsLib::ThreadPriority_Normal, zsLib::ThreadAffinity(), zsLib::MessageQueueCapacity::bounded(2, zsLib::MessageQueueOverflowPolicy_Fail));
+      TESTING_EQUAL(thread->getCapacity().mMaxMessages, 2)
+
+      zsLib::Event blocked;
+      zsLib::Event release;
+      thread->postClosure([&blocked, &release]() { blocked.notify(); release.wait(); });
+      blocked.wait();
+
+      std::atomic<size_t> processed {};
+      thread->postClosure([&processed]() { ++processed; });
+      thread->postClosure([&processed]() { ++processed; });
+
+      bool thrown = false;
+      try {
+        thread->postClosure([&processed]() { ++processed; });
+      } catch (const zsLib::IMessageQueue::Exceptions::MessageQueueFull &) {
+        thrown = true;
+      }
+      TESTING_CHECK(thrown)
+
+      zsLib::Event done;
+      release.notify();
+      while (0 != thread->getTotalUnprocessedMessages()) { std::this_thread::yield(); }
+      thread->postClosure([&done]() { done.notify(); });
+      done.wait();
+
+      TESTING_EQUAL(processed.load(), 2)
+      zsLib::MessageQueueCounters counters = thread->getCounters();
+      TESTING_EQUAL(counters.mRejected, 1)
+      TESTING_EQUAL(counters.mHighWaterMark, 2)
+
+      thread->waitForShutdown();
+    }
+
+    {
+      zsLib::IMessageQueueThreadPtr thread = zsLib::IMessageQueueThread::createBasic("org.zsLib.test.bounded.drop");
+
+      zsLib::Event blocked;
+      zsLib::Event release;
+      thread->postClosure([&blocked, &release]() { blocked.notify(); release.wait(); });
+      blocked.wait();
+
+      // the newest three survive
+      thread->setCapacity(zsLib::MessageQueueCapacity::bounded(3, zsLib::MessageQueueOverflowPolicy_DropOldest));
+      std::vector<int> order;
+      for (int index = 0; index < 6; ++index) {
+        thread->postClosure([&order, index]() { order.push_back(index); });
+      }
+      TESTING_EQUAL(thread->getTotalUnprocessedMessages(), 3)
+      TESTING_EQUAL(thread->getCounters().mDropped, 3)
+
+      // only droppable messages are discarded when full
+      thread->setCapacity(zsLib::MessageQueueCapacity::bounded(3, zsLib::MessageQueueOverflowPolicy_DropDroppable));
+      thread->postDroppableClosure([&order]() { order.push_back(-1); });
+      thread->postClosure([&order]() { order.push_back(6); });
+      TESTING_EQUAL(thread->getTotalUnprocessedMessages(), 4)
+      TESTING_EQUAL(thread->getCounters().mDropped, 4)
+
+      zsLib::Event done;
+      thread->setCapacity(zsLib::MessageQueueCapacity());
+      thread->postClosure([&done]() { done.notify(); });
+      release.notify();
+      done.wait();
+
+      TESTING_EQUAL(order.size(), 4)
+      for (size_t index = 0; index < order.size(); ++index) {
+        TESTING_EQUAL(order[index], static_cast<int>(index + 3))
+      }
+
+      thread->waitForShutdown();
+    }
+
+    {
+      zsLib::IMessageQueueThreadPoolPtr pool = zsLib::IMessageQueueThreadPool::create();
+      pool->createThread("org.zsLib.test.bounded.pool.1");
+
+      zsLib::IMessageQueuePtr queue = pool->createQueue(zsLib::MessageQueueCapacity::bounded(4));
+
+      const size_t total = 200;
+      std::atomic<size_t> processed {};
+      zsLib::Event done;
+
+      // the producer is held back whenever it gets four messages ahead
+      std::thread producer([&queue, &processed, &done, total]() {
+        for (size_t index = 0; index < total; ++index) {
+          queue->postClosure([&processed, &done, total]() {
+            std::this_thread::sleep_for(zsLib::Microseconds(50));
+            if (++processed == total) done.notify();
+          });
+        }
+      });
+
+      done.wait();
+      producer.join();
+
+      zsLib::MessageQueueCounters counters = queue->getCounters();
+      TESTING_EQUAL(processed.load(), total)
+      TESTING_CHECK(counters.mHighWaterMark <= 4)
+      TESTING_CHECK(counters.mBlocked > 0)
+      TESTING_EQUAL(counters.mDropped, 0)
+
+      queue.reset();
+      pool->waitForShutdown();
+    }
+  }
+
+  class CoalescingMessage : public zsLib::IMessageQueueMessage
+  {
+  public:
+    CoalescingMessage(const void *target, std::vector<int> &received, int value) : mTarget(target), mReceived(received), mValue(value) {}
+
+    const char *getDelegateName() const noexcept override {return "CoalescingMessage";}
+    const char *getMethodName() const noexcept override {return "received";}
+    zsLib::MessageCoalesceKey getCoalesceKey() const noexcept override {return zsLib::MessageCoalesceKey {mTarget, &typeid(CoalescingMessage)};}
+    void processMessage() noexcept override {mReceived.push_back(mValue);}
+
+  private:
+    const void *mTarget;
+    std::vector<int> &mReceived;
+    int mValue;
+  };
+
+  void testCoalescing()
+  {
+    zsLib::IMessageQueueThreadPtr thread = zsLib::IMessageQueueThread::createBasic("org.zsLib.test.coalesce");
+
+    int first = 0;
+    int second = 0;
+    std::vector<int> received;
+
+    zsLib::Event blocked;
+    zsLib::Event release;
+    thread->postClosure([&blocked, &release]() { blocked.notify(); release.wait(); });
+    blocked.wait();
+
+    thread->post(zsLib::IMessageQueueMessageUniPtr(new CoalescingMessage(&first, received, 1)));
+    thread->postClosure([&received]() { received.push_back(0); });
+    thread->post(zsLib::IMessageQueueMessageUniPtr(new CoalescingMessage(&second, received, 10)));
+    for (int value = 2; value <= 5; ++value) {
+      thread->post(zsLib::IMessageQueueMessageUniPtr(new CoalescingMessage(&first, received, value)));
+    }
+    thread->post(zsLib::IMessageQueueMessageUniPtr(new CoalescingMessage(&second, received, 20)));
+
+    // only one message per key waits, in the position of the first post
+    TESTING_EQUAL(thread->getTotalUnprocessedMessages(), 3)
+    TESTING_EQUAL(thread->getCounters().mCoalesced, 5)
+
+    zsLib::Event done;
+    thread->postClosure([&done]() { done.notify(); });
+    release.notify();
+    done.wait();
+
+    TESTING_EQUAL(received.size(), 3)
+    TESTING_EQUAL(received[0], 5)
+    TESTING_EQUAL(received[1], 0)
+    TESTING_EQUAL(received[2], 20)
+
+    // a message already processed is never replaced
+    zsLib::Event doneAgain;
+    thread->post(zsLib::IMessageQueueMessageUniPtr(new CoalescingMessage(&first, received, 6)));
+    thread->postClosure([&doneAgain]() { doneAgain.notify(); });
+    doneAgain.wait();
+    TESTING_EQUAL(received.size(), 4)
+    TESTING_EQUAL(received[3], 6)
+
+    thread->waitForShutdown();
+  }
+
+  class CountingNotify : public zsLib::IMessageQueueNotify
+  {
+  public:
+    void notifyMessagePosted() noexcept override {++mPosted;}
+    bool isCurrentThread() const noexcept override {return false;}
+
+    std::atomic<size_t> mPosted {};
+  };
+
+  void testPostBatch()
+  {
+    {
+      std::shared_ptr<CountingNotify> notify = std::make_shared<CountingNotify>();
+      zsLib::IMessageQueuePtr queue = zsLib::IMessageQueue::create(notify);
+
+      // one wakeup for the whole batch
+      std::vector<std::function<void()>> closures(5, []() {});
+      queue->postClosureBatch(closures.begin(), closures.end());
+      TESTING_EQUAL(notify->mPosted.load(), 1)
+      TESTING_EQUAL(queue->getTotalUnprocessedMessages(), 5)
+
+      zsLib::IMessageQueue::MessageList empty;
+      queue->postBatch(empty);
+      TESTING_EQUAL(notify->mPosted.load(), 1)
+    }
+
+    {
+      std::shared_ptr<CountingNotify> notify = std::make_shared<CountingNotify>();
+      zsLib::IMessageQueuePtr queue = zsLib::IMessageQueue::create(notify, zsLib::MessageQueueCapacity::bounded(4, zsLib::MessageQueueOverflowPolicy_Fail));
+      queue->postClosure([]() {});
+      queue->postClosure([]() {});
+
+      // a batch that does not fit is rejected as a whole
+      zsLib::IMessageQueue::MessageList messages;
+      for (int index = 0; index < 3; ++index) {
+        messages.push_back(zsLib::IMessageQueueMessageUniPtr(new zsLib::IMessageQueueMessageClosure<std::function<void()>>([]() {})));
+      }
+
+      bool thrown = false;
+      try {
+        queue->postBatch(messages);
+      } catch (const zsLib::IMessageQueue::Exceptions::MessageQueueFull &) {
+        thrown = true;
+      }
+      TESTING_CHECK(thrown)
+      TESTING_EQUAL(messages.size(), 3)
+      TESTING_CHECK(NULL != messages.front().get())
+      TESTING_EQUAL(queue->getTotalUnprocessedMessages(), 2)
+      TESTING_EQUAL(queue->getCounters().mRejected, 1)
+    }
+
+    {
+      zsLib::IMessageQueueThreadPtr thread = zsLib::IMessageQueueThread::createBasic("org.zsLib.test.batch");
+
+      int target = 0;
+      std::vector<int> received;
+
+      zsLib::Event blocked;
+      zsLib::Event release;
+      thread->postClosure([&blocked, &release]() { blocked.notify(); release.wait(); });
+      blocked.wait();
+
+      // batched messages keep their order and still coalesce
+      zsLib::IMessageQueue::MessageList messages;
+      messages.push_back(zsLib::IMessageQueueMessageUniPtr(new CoalescingMessage(&target, received, 1)));
+      for (int value = 2; value <= 4; ++value) {
+        messages.push_back(zsLib::IMessageQueueMessageUniPtr(new zsLib::IMessageQueueMessageClosure<std::function<void()>>([&received, value]() { received.push_back(value); })));
+      }
+      messages.push_back(zsLib::IMessageQueueMessageUniPtr(new CoalescingMessage(&target, received, 100)));
+      thread->postBatch(messages);
+
+      TESTING_EQUAL(messages.size(), 0)
+      TESTING_EQUAL(thread->getTotalUnprocessedMessages(), 4)
+      TESTING_EQUAL(thread->getCounters().mCoalesced, 1)
+
+      zsLib::Event done;
+      thread->postClosure([&done]() { done.notify(); });
+      release.notify();
+      done.wait();
+
+      TESTING_EQUAL(received.size(), 4)
+      TESTING_EQUAL(received[0], 100)
+      TESTING_EQUAL(received[1], 2)
+      TESTING_EQUAL(received[2], 3)
+      TESTING_EQUAL(received[3], 4)
+
+      thread->waitForShutdown();
+    }
+
+    {
+      zsLib::IMessageQueueThreadPtr thread = zsLib::IMessageQueueThread::createBasic("org.zsLib.test.batch.block", zsLib::ThreadPriority_Normal, zsLib::ThreadAffinity(), zsLib::MessageQueueCapacity::bounded(4, zsLib::MessageQueueOverflowPolicy_Block));
+
+      // a batch larger than a blocking queue wakes the queue before waiting for room
+      std::atomic<size_t> processed {};
+      std::vector<std::function<void()>> closures(10, [&processed]() { ++processed; });
+      thread->postClosureBatch(closures.begin(), closures.end());
+
+      zsLib::Event done;
+      thread->postClosure([&done]() { done.notify(); });
+      done.wait();
+
+      TESTING_EQUAL(processed.load(), 10)
+
+      thread->waitForShutdown();
+    }
+  }
+
+  void testElasticThreadPool()
+  {
+    zsLib::IMessageQueueThreadPoolPtr pool = zsLib::IMessageQueueThreadPool::create();
+
+    zsLib::ThreadPoolScaling scaling = zsLib::ThreadPoolScaling::elastic(1, 4);
+    scaling.mGrowBacklog = 2;
+    scaling.mGrowWaitTime = zsLib::Milliseconds(5);
+    scaling.mGrowInterval = zsLib::Milliseconds(1);
+    scaling.mIdleTimeout = zsLib::Milliseconds(100);
+    scaling.mThreadNamePrefix = "org.zsLib.test.elastic";
+    pool->setScaling(scaling);
+
+    TESTING_EQUAL(pool->getScalingCounters().mThreads, 1)
+
+    // a burst of slow work on many queues grows the pool...
+    const size_t total = 16;
+    std::vector<zsLib::IMessageQueuePtr> queues;
+    std::atomic<size_t> processed {};
+    zsLib::Event done;
+
+    for (size_t index = 0; index < total; ++index) {
+      zsLib::IMessageQueuePtr queue = pool->createQueue();
+      queue->postClosure([&processed, &done, total]() {
+        std::this_thread::sleep_for(zsLib::Milliseconds(20));
+        if (++processed == total) done.notify();
+      });
+      queues.push_back(queue);
+    }
+    done.wait();
+
+    zsLib::ThreadPoolScalingCounters counters = pool->getScalingCounters();
+    TESTING_CHECK(counters.mGrown > 0)
+    TESTING_CHECK(counters.mPeakThreads > 1)
+    TESTING_CHECK(counters.mPeakThreads <= 4)
+
+    // ...and the surplus dispatchers retire once idle
+    zsLib::Time giveUp = zsLib::now() + zsLib::Seconds(10);
+    while ((pool->getScalingCounters().mThreads > 1) && (zsLib::now() < giveUp)) {
+      std::this_thread::sleep_for(zsLib::Milliseconds(10));
+    }
+
+    counters = pool->getScalingCounters();
+    TESTING_EQUAL(counters.mThreads, 1)
+    TESTING_EQUAL(counters.mRetired, counters.mPeakThreads - 1)
+
+    // the remaining dispatcher still serves the queues
+    zsLib::Event again;
+    queues.front()->postClosure([&again]() { again.notify(); });
+    again.wait();
+
+    queues.clear();
+    pool->waitForShutdown();
+  }
+
+  struct LazyObject
+  {
+    ~LazyObject() {mDestroyed = true;}
+
+    int mValue {7};
+    static std::atomic<bool> mDestroyed;
+  };
+
+  std::atomic<bool> LazyObject::mDestroyed {};
+
+  void testSingletonAccess()
+  {
+    typedef zsLib::SingletonLazySharedPtr<LazyObject> LazySingleton;
+
+    auto holder = std::make_unique<LazySingleton>(std::make_shared<LazyObject>());
+
+    {
+      LazySingleton::Access access(*holder);
+      TESTING_CHECK(NULL != access.get())
+      TESTING_EQUAL(access->mValue, 7);
+      TESTING_CHECK(access.lock().get() == access.get())
+      TESTING_CHECK(holder->singleton().get() == access.get())
+    }
+
+    // destroying the holder waits for scoped access on other threads
+    zsLib::Event accessed;
+    zsLib::Event release;
+    std::atomic<bool> destroyedWhileAccessed {};
+    std::thread reader([&]() {
+      LazySingleton::Access access(*holder);
+      accessed.notify();
+      release.wait();
+      destroyedWhileAccessed = LazyObject::mDestroyed.load();
+    });
+
+    accessed.wait();
+    std::thread destroyer([&holder]() { holder.reset(); });
+
+    std::this_thread::sleep_for(zsLib::Milliseconds(50));
+    TESTING_CHECK(!LazyObject::mDestroyed.load())
+    release.notify();
+
+    reader.join();
+    destroyer.join();
+
+    TESTING_CHECK(!destroyedWhileAccessed.load())
+    TESTING_CHECK(LazyObject::mDestroyed.load())
+  }
 }
 
 void testHelper()
@@ -125,4 +938,14 @@ void testHelper()
   testing_helper::testPuidGuid();
   testing_helper::testAtomicIncDec();
   testing_helper::testAtomicGetSet();
+  testing_helper::testMessageQueueStatistics();
+  testing_helper::testEvent();
+  testing_helper::testThreadAffinity();
+  testing_helper::testMessagePriorities();
+  testing_helper::testDelayedPost();
+  testing_helper::testBoundedQueues();
+  testing_helper::testCoalescing();
+  testing_helper::testPostBatch();
+  testing_helper::testElasticThreadPool();
+  testing_helper::testSingletonAccess();
 }
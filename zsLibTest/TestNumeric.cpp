@@ -126,6 +126,10 @@ namespace testing_numeric
       TESTING_EQUAL(zsLib::string(uuid), zsLib::string(uuid3));
     }
 
+    { bool thrown = false; try { zsLib::UUID val = zsLib::Numeric<zsLib::UUID>("b0a01e87-2be5-4daa-8155-1380c98400a"); (void)val; } catch(const zsLib::Numeric<zsLib::UUID>::ValueOutOfRange &) {thrown = true;} TESTING_CHECK(thrown); }
+    { bool thrown = false; try { zsLib::UUID val = zsLib::Numeric<zsLib::UUID>("b0a01e87-2be5-4daa-8155x1380c98400a1"); (void)val; } catch(const zsLib::Numeric<zsLib::UUID>::ValueOutOfRange &) {thrown = true;} TESTING_CHECK(thrown); }
+    { bool thrown = false; try { zsLib::UUID val = zsLib::Numeric<zsLib::UUID>("g0a01e87-2be5-4daa-8155-1380c98400a1"); (void)val; } catch(const zsLib::Numeric<zsLib::UUID>::ValueOutOfRange &) {thrown = true;} TESTING_CHECK(thrown); }
+
     { bool thrown = false; try { auto val = (char)zsLib::Numeric<char>("128"); (void)val; } catch(const zsLib::Numeric<char>::ValueOutOfRange &) {thrown = true;} TESTING_CHECK(thrown); }
     { bool thrown = false; try { auto val = (char)zsLib::Numeric<char>("-129"); (void)val; } catch(const zsLib::Numeric<char>::ValueOutOfRange &) {thrown = true;} TESTING_CHECK(thrown); }
     { bool thrown = false; try { auto val = (char)zsLib::Numeric<char>(" 7F ", false, 16); (void)val; } catch(const zsLib::Numeric<char>::ValueOutOfRange &) {thrown = true;} TESTING_CHECK(thrown); }
@@ -267,6 +271,48 @@ namespace testing_numeric
       TESTING_EQUAL(full, zsLib::string(fromStr2));
     }
   }
+
+  void testNumericFastPaths()
+  {
+    TESTING_EQUAL(12345678U, (unsigned int)zsLib::Numeric<unsigned int>("12345678"));
+    TESTING_EQUAL(123456789U, (unsigned int)zsLib::Numeric<unsigned int>("123456789"));
+    TESTING_EQUAL(12345678U, (unsigned int)zsLib::Numeric<unsigned int>(" 12345678 "));
+    TESTING_EQUAL(42U, (unsigned int)zsLib::Numeric<unsigned int>("0000000000000000000000042"));
+    TESTING_EQUAL(-87654321, (int)zsLib::Numeric<int>("-87654321"));
+    TESTING_EQUAL(1234567890123456789ULL, (ULONGLONG)zsLib::Numeric<ULONGLONG>("1234567890123456789"));
+    TESTING_EQUAL(-1234567890123456789LL, (LONGLONG)zsLib::Numeric<LONGLONG>("-1234567890123456789"));
+
+    { bool thrown = false; try { auto val = (ULONGLONG)zsLib::Numeric<ULONGLONG>("18446744073709551616"); (void)val; } catch(const zsLib::Numeric<ULONGLONG>::ValueOutOfRange &) {thrown = true;} TESTING_CHECK(thrown); }
+    { bool thrown = false; try { auto val = (ULONGLONG)zsLib::Numeric<ULONGLONG>("99999999999999999999"); (void)val; } catch(const zsLib::Numeric<ULONGLONG>::ValueOutOfRange &) {thrown = true;} TESTING_CHECK(thrown); }
+    { bool thrown = false; try { auto val = (unsigned int)zsLib::Numeric<unsigned int>("1234567a"); (void)val; } catch(const zsLib::Numeric<unsigned int>::ValueOutOfRange &) {thrown = true;} TESTING_CHECK(thrown); }
+    { bool thrown = false; try { auto val = (unsigned int)zsLib::Numeric<unsigned int>("12345678 ", false); (void)val; } catch(const zsLib::Numeric<unsigned int>::ValueOutOfRange &) {thrown = true;} TESTING_CHECK(thrown); }
+
+    TESTING_EQUAL(0.5f, (double)zsLib::Numeric<float>("+0.5"));
+    TESTING_EQUAL(0.25, (double)zsLib::Numeric<double>(" 0.25 "));
+
+    {
+      double values[] = {0.1, 1.0 / 3.0, 123456.789, -0.000001, 9007199254740993.0, 1e21};
+      for (size_t index = 0; index < (sizeof(values) / sizeof(values[0])); ++index) {
+        zsLib::String str = zsLib::string(values[index]);
+        double parsed = zsLib::Numeric<double>(str);
+        TESTING_EQUAL(values[index], parsed);
+        TESTING_CHECK(zsLib::String::npos == str.find('e'));
+      }
+    }
+
+    {
+      float value = 1.0f / 3.0f;
+      zsLib::String str = zsLib::string(value);
+      float parsed = zsLib::Numeric<float>(str);
+      TESTING_EQUAL(value, parsed);
+    }
+
+    TESTING_EQUAL(zsLib::string(-9223372036854775807LL - 1), "-9223372036854775808");
+    TESTING_EQUAL(zsLib::string(18446744073709551615ULL), "18446744073709551615");
+    TESTING_EQUAL(zsLib::string(static_cast<zsLib::INT>(-10)), "-10");
+    TESTING_EQUAL(zsLib::string(static_cast<zsLib::UINT>(0)), "0");
+    TESTING_EQUAL(zsLib::string(static_cast<zsLib::ULONGLONG>(0), 16), "0");
+  }
 }
 
 void testNumeric()
@@ -274,4 +320,5 @@ void testNumeric()
   if (!ZSLIB_TEST_NUMERIC) return;
 
   testing_numeric::testNumeric();
+  testing_numeric::testNumericFastPaths();
 }
@@ -30,7 +30,9 @@
  */
 
 #include <zsLib/Promise.h>
+#include <zsLib/Coroutine.h>
 #include <zsLib/IMessageQueueThread.h>
+#include <zsLib/Event.h>
 #include <zsLib/Stringize.h>
 #include <iostream>
 
@@ -644,10 +646,169 @@ namespace testing
 
 }
 
+namespace testing
+{
+  //---------------------------------------------------------------------------
+  static void testPromiseOf()
+  {
+    {
+      typedef zsLib::PromiseOf< std::unique_ptr<int> > MoveOnlyPromise;
+
+      std::atomic<int> settledValue {};
+      MoveOnlyPromise::PromiseOfTypePtr promise = MoveOnlyPromise::create();
+      PromisePtr generic = promise;
+      generic->thenClosure([generic, &settledValue]() {
+        auto typed = MoveOnlyPromise::convert(generic);
+        if ((typed) && (typed->value())) settledValue = *(*(typed->value()));
+      });
+
+      promise->resolve(std::unique_ptr<int>(new int(5)));
+      TESTING_CHECK(promise->isResolved())
+      TESTING_EQUAL(settledValue.load(), 5);
+      TESTING_CHECK(NULL == promise->reason())
+
+      auto taken = promise->takeValue();
+      TESTING_CHECK(taken.has_value())
+      TESTING_EQUAL(*(*taken), 5);
+      TESTING_CHECK(NULL == promise->value())
+    }
+
+    {
+      typedef zsLib::PromiseOf<int, std::string> IntPromise;
+
+      IntPromise::PromiseOfTypePtr resolved = IntPromise::createResolved(7);
+      IntPromise::PromiseOfTypePtr rejected = IntPromise::createRejected("failed");
+
+      TESTING_EQUAL(*(resolved->value()), 7);
+      TESTING_CHECK(NULL == resolved->reason())
+      TESTING_CHECK(rejected->isRejected())
+      TESTING_CHECK(NULL == rejected->value())
+      TESTING_EQUAL(*(rejected->reason()), "failed");
+
+      Promise::PromiseList promises;
+      promises.push_back(resolved);
+      promises.push_back(IntPromise::create());
+      PromisePtr all = Promise::all(promises);
+      TESTING_CHECK(!all->isSettled())
+
+      IntPromise::convert(promises.back())->resolve(8);
+      TESTING_CHECK(all->isResolved())
+
+      promises.push_back(rejected);
+      TESTING_CHECK(Promise::all(promises)->isRejected())
+    }
+
+    {
+      typedef zsLib::AnyHolder<int> IntHolder;
+      typedef zsLib::PromiseOf< std::shared_ptr<IntHolder> > HolderPromise;
+
+      auto holder = std::make_shared<IntHolder>();
+      holder->value_ = 9;
+
+      // pointer payloads are visible through the generic interface as well
+      PromisePtr generic = HolderPromise::createResolved(holder);
+      TESTING_CHECK(holder == generic->value<IntHolder>())
+    }
+  }
+}
+
+#ifdef ZSLIB_COROUTINES
+
+namespace testing
+{
+  typedef zsLib::AnyHolder<int> IntHolder;
+  ZS_DECLARE_PTR(IntHolder)
+
+  //---------------------------------------------------------------------------
+  static PromisePtr coroutineAdd(PromisePtr first, PromisePtr second, IMessageQueuePtr queue, std::atomic<bool> &onQueue)
+  {
+    co_await zsLib::resumeOn(queue);
+    onQueue = queue->isCurrentThread();
+
+    PromisePtr settledFirst = co_await first;
+    PromisePtr settledSecond = co_await second;
+    if (!queue->isCurrentThread()) onQueue = false;
+
+    IntHolderPtr result = std::make_shared<IntHolder>();
+    result->value_ = settledFirst->value<IntHolder>()->value_ + settledSecond->value<IntHolder>()->value_;
+    co_return result;
+  }
+
+  //---------------------------------------------------------------------------
+  static PromisePtr coroutineThrow(PromisePtr waitFor)
+  {
+    co_await waitFor;
+    throw std::runtime_error("coroutine");
+    co_return nullptr;
+  }
+
+  //---------------------------------------------------------------------------
+  static void waitForSettled(PromisePtr promise)
+  {
+    zsLib::Event settled;
+    promise->thenClosure([&settled]() { settled.notify(); });
+    settled.wait();
+  }
+
+  //---------------------------------------------------------------------------
+  static void testCoroutines()
+  {
+    zsLib::IMessageQueueThreadPtr thread = zsLib::IMessageQueueThread::createBasic();
+
+    {
+      std::atomic<bool> onQueue {};
+      PromisePtr first = Promise::create(thread);
+      PromisePtr second = Promise::create(thread);
+
+      PromisePtr sum = coroutineAdd(first, second, thread, onQueue);
+      TESTING_CHECK(!sum->isSettled())
+
+      IntHolderPtr one = std::make_shared<IntHolder>();
+      one->value_ = 1;
+      IntHolderPtr two = std::make_shared<IntHolder>();
+      two->value_ = 2;
+
+      // settling an awaited promise posts exactly one resume message
+      zsLib::Event blocked;
+      zsLib::Event release;
+      thread->postClosure([&blocked, &release]() { blocked.notify(); release.wait(); });
+      blocked.wait();
+
+      first->resolve(one);
+      TESTING_EQUAL(thread->getTotalUnprocessedMessages(), 1);
+      release.notify();
+
+      second->resolve(two);
+      waitForSettled(sum);
+
+      TESTING_CHECK(sum->isResolved())
+      TESTING_EQUAL(sum->value<IntHolder>()->value_, 3);
+      TESTING_CHECK(onQueue.load())
+    }
+
+    {
+      PromisePtr waitFor = Promise::create();
+      PromisePtr failed = coroutineThrow(waitFor);
+      TESTING_CHECK(!failed->isSettled())
+
+      waitFor->resolve();
+      TESTING_CHECK(failed->isRejected())
+      TESTING_CHECK(NULL != failed->reason< zsLib::AnyHolder<std::exception_ptr> >().get())
+    }
+
+    thread->waitForShutdown();
+  }
+}
+
+#endif //ZSLIB_COROUTINES
 
 void testPromise()
 {
   if (ZSLIB_TEST_PROMISE) {
     testing::TestPromise test;
+    testing::testPromiseOf();
+#ifdef ZSLIB_COROUTINES
+    testing::testCoroutines();
+#endif //ZSLIB_COROUTINES
   }
 }
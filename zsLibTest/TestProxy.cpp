@@ -34,8 +34,13 @@
 #include <zsLib/Proxy.h>
 #include <zsLib/ProxySubscriptions.h>
 #include <zsLib/IMessageQueueThread.h>
+#include <zsLib/IMessageQueueThreadPool.h>
 #include <zsLib/Stringize.h>
+#include <zsLib/Event.h>
+#include <zsLib/ISettings.h>
 #include <iostream>
+#include <thread>
+#include <vector>
 
 
 #include "testing.h"
@@ -52,12 +57,16 @@ namespace testing
       mCalledFunc1 = false;
       mCalledFunc2 = 0;
       mCalledSub1 = false;
+      mCalledFunc6 = 0;
+      mTotalCalledFunc6 = 0;
       mDestroyedTestProxyCallback = false;
     }
     bool mCalledFunc1;
     ULONG mCalledFunc2;
     zsLib::String mCalledFunc3;
     int mCalledFunc4;
+    int mCalledFunc6;
+    ULONG mTotalCalledFunc6;
 
     bool mCalledSub1;
     zsLib::String mCalledSub2;
@@ -81,6 +90,7 @@ namespace testing
     virtual void func3(zsLib::String) = 0;
     virtual void func4(int value) noexcept = 0;
     virtual zsLib::String func5(ULONG value1, ULONG value2) noexcept = 0;
+    virtual void func6(int value) = 0;
   };
 
   interaction ITestSubscriptionProxyDelegate
@@ -108,6 +118,7 @@ ZS_DECLARE_PROXY_METHOD(func2)
 ZS_DECLARE_PROXY_METHOD(func3, zsLib::String)
 ZS_DECLARE_PROXY_METHOD_SYNC(func4, int)
 ZS_DECLARE_PROXY_METHOD_SYNC_RETURN(func5, zsLib::String, ULONG, ULONG)
+ZS_DECLARE_PROXY_METHOD_COALESCE(func6, int)
 ZS_DECLARE_PROXY_END()
 
 ZS_DECLARE_PROXY_BEGIN(testing::ITestSubscriptionProxyDelegate)
@@ -158,6 +169,11 @@ namespace testing
     {
       return zsLib::Stringize<ULONG>(value1,16).string() + " " + zsLib::Stringize<ULONG>(value2,16).string();
     }
+    virtual void func6(int value)
+    {
+      getCheck().mCalledFunc6 = value;
+      ++(getCheck().mTotalCalledFunc6);
+    }
 
     virtual void sub1()
     {
@@ -175,6 +191,33 @@ namespace testing
     }
   };
 
+  ZS_DECLARE_CLASS_PTR(TestSubscriptionOrder)
+
+  class TestSubscriptionOrder : public ITestSubscriptionProxyDelegate,
+                                public zsLib::MessageQueueAssociator
+  {
+  private:
+    TestSubscriptionOrder(zsLib::IMessageQueuePtr queue, std::vector<int> &received, int index) : zsLib::MessageQueueAssociator(queue), mReceived(received), mIndex(index)
+    {
+    }
+  public:
+    static TestSubscriptionOrderPtr create(zsLib::IMessageQueuePtr queue, std::vector<int> &received, int index)
+    {
+      return TestSubscriptionOrderPtr(new TestSubscriptionOrder(queue, received, index));
+    }
+
+    virtual void sub1() {}
+
+    virtual void sub2(zsLib::String value)
+    {
+      if ("fanout" == value) mReceived.push_back(mIndex);
+    }
+
+  private:
+    std::vector<int> &mReceived;
+    int mIndex;
+  };
+
   class TestProxy
   {
   public:
@@ -213,12 +256,243 @@ namespace testing
 
       TESTING_EQUAL(delegate->func5(0xABC, 0xDEF), "abc def");
 
+      {
+        // calls made while the thread is busy collapse into the latest one
+        zsLib::Event blocked;
+        zsLib::Event release;
+        mThread->postClosure([&blocked, &release]() { blocked.notify(); release.wait(); });
+        blocked.wait();
+
+        for (int i = 1; i <= 100; ++i)
+        {
+          delegate->func6(i);
+        }
+        TESTING_EQUAL(mThread->getCounters().mCoalesced, 99);
+
+        zsLib::Event done;
+        mThread->postClosure([&done]() { done.notify(); });
+        release.notify();
+        done.wait();
+      }
+
       subscriptions.delegate()->sub1();
 
       subscriptions.delegate()->sub2("sub2");
 
       subscription->cancel();
       subscriptions.delegate()->sub2("post_sub2_cancelled");
+
+      {
+        // subscribers sharing a queue receive an event through one message, in subscription order
+        ITestSubscriptionProxyDelegateSubscriptions fanout;
+        std::vector<int> received;
+        std::vector<TestSubscriptionOrderPtr> subscribers;
+        std::vector<SubscriptionPtr> fanoutSubscriptions;
+        for (int index = 0; index < 50; ++index) {
+          subscribers.push_back(TestSubscriptionOrder::create(mThread, received, index));
+          fanoutSubscriptions.push_back(fanout.subscribe(subscribers.back()));
+        }
+        fanoutSubscriptions[10]->cancel();
+
+        zsLib::Event blocked;
+        zsLib::Event release;
+        mThread->postClosure([&blocked, &release]() { blocked.notify(); release.wait(); });
+        blocked.wait();
+
+        fanout.delegate()->sub2("fanout");
+        TESTING_EQUAL(mThread->getTotalUnprocessedMessages(), 1);
+
+        zsLib::Event done;
+        mThread->postClosure([&done]() { done.notify(); });
+        release.notify();
+        done.wait();
+
+        TESTING_EQUAL(received.size(), 49);
+        for (size_t index = 0; index < received.size(); ++index) {
+          TESTING_EQUAL(received[index], static_cast<int>(index < 10 ? index : index + 1));
+        }
+      }
+
+      {
+        // events keep reaching existing subscribers while others subscribe and cancel concurrently
+        ITestSubscriptionProxyDelegateSubscriptions churn;
+        std::vector<int> received;
+        TestSubscriptionOrderPtr stable = TestSubscriptionOrder::create(mThread, received, 0);
+        TestSubscriptionOrderPtr transient = TestSubscriptionOrder::create(mThread, received, 1);
+        SubscriptionPtr stableSubscription = churn.subscribe(stable);
+
+        std::thread churning([&churn, transient]() {
+          for (int loop = 0; loop < 1000; ++loop) {
+            churn.subscribe(transient)->cancel();
+          }
+        });
+        for (int loop = 0; loop < 1000; ++loop) {
+          churn.delegate()->sub2("fanout");
+        }
+        churning.join();
+
+        zsLib::Event done;
+        mThread->postClosure([&done]() { done.notify(); });
+        done.wait();
+
+        size_t total = 0;
+        for (auto iter = received.begin(); iter != received.end(); ++iter) {
+          if (0 == (*iter)) ++total;
+        }
+        TESTING_EQUAL(total, 1000);
+        TESTING_EQUAL(churn.size(), 1);
+      }
+
+      {
+        // a cancelled subscriber is released even when events were being fired during the cancel
+        ITestSubscriptionProxyDelegateSubscriptions firing;
+        std::vector<int> received;
+        std::atomic<bool> stop {};
+
+        std::thread events([&firing, &stop]() {
+          while (!stop) {
+            firing.delegate()->sub1();
+          }
+        });
+
+        std::vector<TestSubscriptionOrderWeakPtr> cancelled;
+        for (int loop = 0; loop < 200; ++loop) {
+          TestSubscriptionOrderPtr subscriber = TestSubscriptionOrder::create(mThread, received, loop);
+          cancelled.push_back(subscriber);
+          firing.subscribe(subscriber)->cancel();
+        }
+        stop = true;
+        events.join();
+
+        zsLib::Event drained;
+        mThread->postClosure([&drained]() { drained.notify(); });
+        drained.wait();
+
+        size_t alive = 0;
+        for (auto iter = cancelled.begin(); iter != cancelled.end(); ++iter) {
+          if ((*iter).lock()) ++alive;
+        }
+        TESTING_EQUAL(alive, 0);
+      }
+
+      {
+        // calls made on the delegate's own queue run inline unless messages are already waiting
+        std::vector<int> received;
+        TestSubscriptionOrderPtr target = TestSubscriptionOrder::create(mThread, received, 0);
+        ITestSubscriptionProxyDelegatePtr direct = ITestSubscriptionProxyDelegateProxy::createDirectWhenSameQueue(target);
+        TESTING_CHECK(ITestSubscriptionProxyDelegateProxy::isProxy(direct))
+
+        size_t afterIdleCall = 0;
+        size_t afterBusyCall = 0;
+        zsLib::Event done;
+        mThread->postClosure([&]() {
+          direct->sub2("fanout");
+          afterIdleCall = received.size();
+
+          mThread->postClosure([]() {});
+          direct->sub2("fanout");
+          afterBusyCall = received.size();
+
+          mThread->postClosure([&done]() { done.notify(); });
+        });
+        done.wait();
+
+        TESTING_EQUAL(afterIdleCall, 1);
+        TESTING_EQUAL(afterBusyCall, 1);
+        TESTING_EQUAL(received.size(), 2);
+
+        direct->sub2("fanout");
+        zsLib::Event drained;
+        mThread->postClosure([&drained]() { drained.notify(); });
+        drained.wait();
+        TESTING_EQUAL(received.size(), 3);
+      }
+
+      {
+        // the same holds for a queue dispatched by a thread pool
+        zsLib::IMessageQueueThreadPoolPtr pool = zsLib::IMessageQueueThreadPool::create();
+        pool->createThread("org.zsLib.test.proxy.pool");
+        zsLib::IMessageQueuePtr queue = pool->createQueue();
+        TESTING_CHECK(!queue->isCurrentThread())
+
+        std::vector<int> received;
+        TestSubscriptionOrderPtr target = TestSubscriptionOrder::create(queue, received, 0);
+        ITestSubscriptionProxyDelegatePtr direct = ITestSubscriptionProxyDelegateProxy::createDirectWhenSameQueue(target);
+
+        bool onQueue = false;
+        size_t afterIdleCall = 0;
+        zsLib::Event done;
+        queue->postClosure([&]() {
+          onQueue = queue->isCurrentThread();
+          direct->sub2("fanout");
+          afterIdleCall = received.size();
+          done.notify();
+        });
+        done.wait();
+
+        TESTING_CHECK(onQueue)
+        TESTING_EQUAL(afterIdleCall, 1);
+
+        target.reset();
+        direct.reset();
+        queue.reset();
+        pool->waitForShutdown();
+      }
+
+      {
+        // the call-site census counts proxies per creation site while enabled
+        zsLib::ISettings::setBool(ZSLIB_SETTING_PROXY_CENSUS, true);
+        zsLib::proxyCensus();
+
+        std::vector<int> received;
+        TestSubscriptionOrderPtr target = TestSubscriptionOrder::create(mThread, received, 0);
+        std::vector<ITestSubscriptionProxyDelegatePtr> proxies;
+        const int line = __LINE__;
+
+        auto findSite = [line]() -> zsLib::ProxyCensusEntry {
+          zsLib::ProxyCensusList census = zsLib::proxyCensus(1000);
+          for (auto iter = census.begin(); iter != census.end(); ++iter) {
+            if (((*iter).mFileName) && (zsLib::String((*iter).mFileName) == __FILE__) && ((*iter).mLine == line)) return (*iter);
+          }
+          return zsLib::ProxyCensusEntry();
+        };
+
+        zsLib::ULONGLONG before = findSite().mTotalCreated;   // totals accumulate over the process lifetime
+        for (int index = 0; index < 10; ++index) {
+          ITestSubscriptionProxyDelegatePtr proxy = ITestSubscriptionProxyDelegateProxy::create(target, false, true, line, __FILE__);
+          if (index < 4) proxies.push_back(proxy);
+        }
+
+        zsLib::ProxyCensusEntry site = findSite();
+        TESTING_EQUAL(site.mTotalCreated - before, 10);
+        TESTING_EQUAL(site.mTotalLive, 4);
+
+        // destroyed by a thread whose own table has no room left for the call site
+        std::thread destroying([&proxies, target]() {
+          for (int otherLine = 0; otherLine < 1000; ++otherLine) {
+            ITestSubscriptionProxyDelegateProxy::create(target, false, true, 100000 + otherLine, __FILE__);
+          }
+          proxies.clear();
+        });
+        destroying.join();
+
+        site = findSite();
+        TESTING_EQUAL(site.mTotalCreated - before, 10);
+        TESTING_EQUAL(site.mTotalLive, 0);
+
+        bool balanced = true;
+        zsLib::ProxyCensusList census = zsLib::proxyCensus(2000);
+        for (auto iter = census.begin(); iter != census.end(); ++iter) {
+          if ((*iter).mTotalLive < 0) balanced = false;
+        }
+        TESTING_CHECK(balanced)
+
+        zsLib::ISettings::setBool(ZSLIB_SETTING_PROXY_CENSUS, false);
+        zsLib::proxyCensus();
+
+        ITestSubscriptionProxyDelegateProxy::create(target, false, true, line, __FILE__);
+        TESTING_EQUAL(findSite().mTotalCreated - before, 10);
+      }
     }
 
     ~TestProxy()
@@ -238,6 +512,8 @@ namespace testing
 
       TESTING_EQUAL(getCheck().mCalledFunc3, "func3");
       TESTING_EQUAL(getCheck().mCalledFunc2, 1000);
+      TESTING_EQUAL(getCheck().mCalledFunc6, 100);
+      TESTING_EQUAL(getCheck().mTotalCalledFunc6, 1);
       TESTING_CHECK(getCheck().mCalledFunc1);
       TESTING_CHECK(getCheck().mCalledSub1);
       TESTING_EQUAL(getCheck().mCalledSub2, "sub2");
@@ -83,6 +83,8 @@ void testStringize()
   zsLib::UUID uuid = zsLib::Numeric<zsLib::UUID>("b0a01e87-2be5-4daa-8155-1380c98400a1");
   zsLib::String uuidStr = zsLib::Stringize<zsLib::UUID>(uuid);
   TESTING_EQUAL("b0a01e87-2be5-4daa-8155-1380c98400a1", uuidStr);
+  TESTING_EQUAL("b0a01e87-2be5-4daa-8155-1380c98400a1", zsLib::string((zsLib::UUID)zsLib::Numeric<zsLib::UUID>("{B0A01E87-2BE5-4DAA-8155-1380C98400A1}")));
+  TESTING_EQUAL("00000000-0000-0000-0000-000000000000", zsLib::string(zsLib::UUID()));
 
   TESTING_EQUAL(IPAddress("192.168.1.10:5060").string(), string(IPAddress("192.168.1.10:5060")))
 
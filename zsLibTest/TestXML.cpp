@@ -30,7 +30,9 @@
  */
 
 #include <zsLib/XML.h>
+#include <zsLib/IMessageQueueThreadPool.h>
 #include <set>
+#include <sstream>
 
 
 
@@ -2276,6 +2278,9 @@ public:
     parse(get_gXMLResults19());
     parse(get_gXMLResults20());
     generate();
+    pathTest();
+    escapeTest();
+    batchParseTest();
     parserPosTest();
     {int i = 0; ++i;}
   }
@@ -3130,6 +3135,213 @@ public:
     TESTING_CHECK(0 == length1a)
   }
 
+  void pathTest()
+  {
+    static CSTR gDocument =
+    "<root><a><b>1</b><b>2</b><c><b>3</b></c></a><a><b>4</b></a><x><y><b>5</b></y></x></root>";
+
+    zsLib::XML::ParserPtr parser = zsLib::XML::Parser::createXMLParser();
+    zsLib::XML::DocumentPtr document = parser->parse(gDocument);
+    zsLib::XML::ElementPtr root = document->getFirstChildElementChecked();
+
+    {
+      zsLib::XML::PathPtr path = zsLib::XML::Path::create("a/b");
+      TESTING_CHECK((bool)path)
+      TESTING_EQUAL(path->getStepCount(), 2)
+      TESTING_EQUAL(path->findFirstChecked(root)->getTextDecoded(), "1")
+
+      zsLib::XML::Path::ElementList found;
+      TESTING_EQUAL(path->findAll(root, found), 3)
+      TESTING_EQUAL(found.back()->getTextDecoded(), "4")
+    }
+
+    TESTING_EQUAL(zsLib::XML::Path::create("/root/a[1]/b")->findFirstChecked(document)->getTextDecoded(), "4")
+    TESTING_EQUAL(zsLib::XML::Path::create("a/b[1]")->findFirstChecked(root)->getTextDecoded(), "2")
+    TESTING_EQUAL(zsLib::XML::Path::create("*/*/b")->findFirstChecked(root)->getTextDecoded(), "3")
+    TESTING_CHECK(!zsLib::XML::Path::create("a/b[2]")->findFirst(root))
+    TESTING_CHECK(!zsLib::XML::Path::create("a/b/"))
+    TESTING_CHECK(!zsLib::XML::Path::create("a/b[x]"))
+    TESTING_CHECK(zsLib::XML::Path::create("")->findFirst(root) == root)
+
+    TESTING_EQUAL(zsLib::XML::Path::createFromJSONPointer("/root/a/0/c/b")->findFirstChecked(document)->getTextDecoded(), "3")
+    TESTING_EQUAL(zsLib::XML::Path::createFromJSONPointer("/a/1/b")->findFirstChecked(root)->getTextDecoded(), "4")
+    TESTING_CHECK(!zsLib::XML::Path::createFromJSONPointer("a"))
+    TESTING_CHECK(!zsLib::XML::Path::createFromJSONPointer("/a/~2"))
+
+    {
+      zsLib::XML::Path::PathList paths;
+      paths.push_back(zsLib::XML::Path::create("x/y/b"));
+      paths.push_back(zsLib::XML::Path::create("a/c/b"));
+      paths.push_back(zsLib::XML::Path::create("missing"));
+      paths.push_back(zsLib::XML::Path::create("a[1]"));
+
+      zsLib::XML::Path::ElementVector results;
+      zsLib::XML::Path::findFirst(root, paths, results);
+      TESTING_EQUAL(results.size(), 4)
+      TESTING_EQUAL(results[0]->getTextDecoded(), "5")
+      TESTING_EQUAL(results[1]->getTextDecoded(), "3")
+      TESTING_CHECK(!results[2])
+      TESTING_EQUAL(results[3]->getTextDecoded(), "4")
+    }
+  }
+
+  static std::string referenceEscape(const std::string &input, int mode)
+  {
+    // mode 0 = text, 1 = text with 0xD, 2 = double quoted attribute, 3 = JSON
+    std::string result;
+    for (size_t index = 0; index < input.length(); ++index)
+    {
+      char ch = input[index];
+      const char *escape = NULL;
+      switch (ch)
+      {
+        case '&':   if (mode < 3) escape = "&amp;"; break;
+        case '<':   if (mode < 3) escape = "&lt;"; break;
+        case '>':   if (mode < 3) escape = "&gt;"; break;
+        case '\"':  escape = (2 == mode ? "&quot;" : (3 == mode ? "\\\"" : NULL)); break;
+        case '\x9': escape = (2 == mode ? "&#x9;" : (3 == mode ? "\\t" : NULL)); break;
+        case '\xA': escape = (2 == mode ? "&#xA;" : (3 == mode ? "\\n" : NULL)); break;
+        case '\xD': escape = ((1 == mode) || (2 == mode) ? "&#xD;" : (3 == mode ? "\\r" : NULL)); break;
+        case '\\':  if (3 == mode) escape = "\\\\"; break;
+        case '\b':  if (3 == mode) escape = "\\b"; break;
+        case '\f':  if (3 == mode) escape = "\\f"; break;
+        default:    break;
+      }
+      if (escape)
+        result += escape;
+      else
+        result += ch;
+    }
+    return result;
+  }
+
+  void escapeTest()
+  {
+    static const char gAlphabet[] = "abcXYZ019 &<>\"'\\\t\n\r\b\f\x01\x1F\x7F\x80\xC3\xA9\xFF";
+
+    zsLib::ULONG seed = 0x12345678;
+    for (size_t length = 0; length < 80; ++length)
+    {
+      for (size_t round = 0; round < 20; ++round)
+      {
+        std::string input;
+        for (size_t index = 0; index < length; ++index)
+        {
+          seed = (seed * 1103515245) + 12345;
+          // mostly plain characters so runs cross the vector boundaries
+          size_t pick = (seed >> 16) % (sizeof(gAlphabet) - 1);
+          input += ((seed >> 8) % 4 == 0 ? gAlphabet[pick] : 'a' + static_cast<char>(pick % 26));
+        }
+
+        zsLib::String value(input);
+        TESTING_EQUAL(std::string(zsLib::XML::Parser::makeTextEntitySafe(value)), referenceEscape(input, 0))
+        TESTING_EQUAL(std::string(zsLib::XML::Parser::makeTextEntitySafe(value, true)), referenceEscape(input, 1))
+        TESTING_EQUAL(std::string(zsLib::XML::Parser::makeAttributeEntitySafe(value, '\"')), referenceEscape(input, 2))
+        TESTING_EQUAL(std::string(zsLib::XML::Parser::convertToJSONEncoding(value)), referenceEscape(input, 3))
+        TESTING_EQUAL(std::string(zsLib::XML::Parser::convertFromJSONEncoding(zsLib::XML::Parser::convertToJSONEncoding(value))), input)
+      }
+    }
+
+    // text heavy payload through the generators
+    {
+      std::string payload;
+      for (size_t index = 0; index < 4096; ++index)
+      {
+        payload += "Hello there, this is a chat message with a \"quote\" & an <angle>\n";
+      }
+
+      zsLib::XML::ElementPtr element = zsLib::XML::Element::create("message");
+      zsLib::XML::TextPtr text = zsLib::XML::Text::create();
+      text->setValue(payload, zsLib::XML::Text::Format_CDATA);
+      element->adoptAsLastChild(text);
+
+      zsLib::XML::GeneratorPtr generatorXML = zsLib::XML::Generator::createXMLGenerator(zsLib::XML::Generator::XMLWriteFlag_NormalizeCDATA);
+      zsLib::XML::GeneratorPtr generatorJSON = zsLib::XML::Generator::createJSONGenerator();
+
+      const size_t iterations = 50;
+      size_t total = 0;
+
+      zsLib::Time start = zsLib::now();
+      for (size_t index = 0; index < iterations; ++index) {
+        size_t length = 0;
+        generatorXML->write(element, &length);
+        total += length;
+      }
+      zsLib::Microseconds xmlTime = zsLib::toMicroseconds(zsLib::now() - start);
+
+      start = zsLib::now();
+      for (size_t index = 0; index < iterations; ++index) {
+        size_t length = 0;
+        std::unique_ptr<char[]> output = generatorJSON->write(element, &length);
+        TESTING_CHECK(length == strlen(output.get()))
+        total += length;
+      }
+      zsLib::Microseconds jsonTime = zsLib::toMicroseconds(zsLib::now() - start);
+
+      std::unique_ptr<char[]> outputXML = generatorXML->write(element);
+      TESTING_EQUAL(std::string(outputXML.get()), "<message>" + referenceEscape(payload, 0) + "</message>")
+
+      TESTING_STDOUT() << "ESCAPE PERFORMANCE: " << payload.length() << " byte text (" << iterations << " iterations, checksum=" << total << ")\n";
+      TESTING_STDOUT() << "  XML=" << xmlTime.count() << "us, JSON=" << jsonTime.count() << "us\n";
+    }
+  }
+
+  void batchParseTest()
+  {
+    std::vector<std::string> sources;
+    for (size_t index = 0; index < 300; ++index)
+    {
+      std::stringstream ss;
+      switch (index % 3)
+      {
+        case 0: ss << "<doc id=\"" << index << "\"><item>" << index << "</item><item>&amp;" << index << "</item></doc>"; break;
+        case 1: ss << "{\"doc\":{\"$id\":\"" << index << "\",\"item\":[\"" << index << "\",\"x\"]}}"; break;
+        default: ss << "<doc><open>" << index << "</mismatch></doc>"; break;   // produces warnings
+      }
+      sources.push_back(ss.str());
+    }
+
+    zsLib::XML::Parser::BatchInputVector inputs;
+    for (auto iter = sources.begin(); iter != sources.end(); ++iter) {
+      inputs.push_back((*iter).c_str());
+    }
+
+    zsLib::IMessageQueueThreadPoolPtr pool = zsLib::IMessageQueueThreadPool::create();
+    for (size_t index = 0; index < 4; ++index) {
+      pool->createThread("org.zsLib.test.xml.batch");
+    }
+
+    zsLib::XML::ParserPtr parser = zsLib::XML::Parser::createAutoDetectParser("#text", '$');
+    zsLib::XML::GeneratorPtr generator = zsLib::XML::Generator::createXMLGenerator();
+
+    zsLib::XML::Parser::BatchResultVector results = parser->parseBatch(pool, inputs);
+    TESTING_EQUAL(results.size(), inputs.size())
+
+    for (size_t index = 0; index < inputs.size(); ++index)
+    {
+      zsLib::XML::ParserPtr serialParser = zsLib::XML::Parser::createAutoDetectParser("#text", '$');
+      zsLib::XML::DocumentPtr expected = serialParser->parse(inputs[index]);
+
+      TESTING_CHECK((bool)results[index].mDocument)
+      if (!results[index].mDocument) continue;
+
+      std::unique_ptr<char[]> expectedOutput = generator->write(expected);
+      std::unique_ptr<char[]> actualOutput = generator->write(results[index].mDocument);
+      TESTING_EQUAL(std::string(actualOutput.get()), std::string(expectedOutput.get()))
+      TESTING_EQUAL(results[index].mWarnings.size(), serialParser->getWarnings().size())
+      TESTING_EQUAL(results[index].mWarnings.size() > 0, (2 == (index % 3)))
+    }
+
+    // without a pool the calling thread parses everything
+    zsLib::XML::Parser::BatchResultVector serialResults = parser->parseBatch(zsLib::IMessageQueueThreadPoolPtr(), inputs);
+    TESTING_EQUAL(serialResults.size(), inputs.size())
+    TESTING_EQUAL(std::string(generator->write(serialResults[1].mDocument).get()), std::string(generator->write(results[1].mDocument).get()))
+
+    TESTING_EQUAL(parser->parseBatch(pool, zsLib::XML::Parser::BatchInputVector()).size(), 0)
+
+    pool->waitForShutdown();
+  }
+
   void parserPosTest()
   {
     static CSTR gParse =
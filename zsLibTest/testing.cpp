@@ -35,6 +35,7 @@
 #include <zsLib/helpers.h>
 #include "testing.h"
 
+void testHelper();
 void testIPAddress();
 void testNumeric();
 void testPromise();
@@ -119,6 +120,7 @@ namespace Testing
   {
     setup();
 
+    TESTING_RUN_TEST_CASE(testHelper)
     TESTING_RUN_TEST_CASE(testIPAddress)
     TESTING_RUN_TEST_CASE(testNumeric)
     TESTING_RUN_TEST_CASE(testPromise)